@@ -0,0 +1,46 @@
+#pragma once
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "SimThread.h"
+#include "TransformHierarchy.h"
+
+// Stanice ispred autobusa koje se crtaju; prva je sledeca stanica
+const int VISIBLE_STATIONS = 5;
+
+// ========== GRAF SCENE ==========
+// Sve sto se pomera u 3D sceni kao jedna hijerarhija transformacija: kabina (ljuljanje) sa
+// volanom, vratima i putnicima, stanice ispred autobusa i guzva na peronu. Agenti guzve su
+// u prostoru stanice i zauzimaju neprekidan blok cvorova, pa njihove world matrice idu pravo
+// u instance bafer (jedan instancirani poziv po stanici). Main i SoftwareRenderer pune istu
+// scenu iz snimka; dok autobus stoji a guzva miruje, update ne preracunava nista.
+
+class BusScene {
+public:
+    void update(const SimSnapshot& snap, float stationDistance);
+
+    const glm::mat4& cabin() const { return transforms.world(cabinNode); }
+    const glm::mat4& wheel() const { return transforms.world(wheelNode); }
+    const glm::mat4& door() const { return transforms.world(doorNode); }
+    const glm::mat4& station(int index) const { return transforms.world(stationNodes[index]); }
+    const glm::mat4& passenger(int index) const { return transforms.world(passengerNodes[index]); }
+
+    // crowdCount matrica (snimak iz poslednjeg update-a), u prostoru stanice
+    const glm::mat4* crowdInstances() const { return crowdCount > 0 ? transforms.worlds(firstCrowdNode) : nullptr; }
+    int crowdSize() const { return crowdCount; }
+    // Instance guzve su se promenile u poslednjem update-u (treba ponovo poslati bafer)
+    bool crowdChanged() const { return crowdDirty; }
+    int lastRecomputed() const { return recomputed; }
+
+private:
+    void build(int crowdSize);
+
+    TransformHierarchy transforms;
+    int cabinNode = -1, wheelNode = -1, doorNode = -1;
+    int stationNodes[VISIBLE_STATIONS];
+    int firstCrowdNode = 0, crowdCount = -1;
+    std::vector<int> passengerNodes;
+    bool crowdDirty = true;
+    int recomputed = 0;
+};
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "NavGrid.h"
+#include "Passenger.h"
+#include "SeatMap.h"
+#include "CrowdSim.h"
+#include "Random.h"
+#include "Telemetry.h"
+
+// ========== KONSTANTE SIMULACIJE ==========
+const int NUM_STATIONS = 10;
+const float BUS_SPEED = 0.15f;
+const float STATION_WAIT_TIME = 10.0f;
+const int MAX_PASSENGERS = 50;
+
+const float doorSpeed = 0.02f;
+const float doorMaxOffset = 0.4f;
+
+const float wheelRotationSpeed = 2.0f;
+const float wheelMaxRotation = 45.0f;
+
+const float busShakeSpeed = 3.0f;
+const float busShakeAmplitude = 0.005f;
+
+const float passengerAnimDuration = 0.8f;
+const float DOOR_STEP_OUTSIDE = 0.15f;     // Putnik se pojavljuje/nestaje ovoliko ispred ulaza (+x)
+
+// Guzva na peronu (lokalne koordinate stanice, humanoidi su uvecani CROWD_SCALE puta)
+const float CROWD_SCALE = 2.0f;
+const int STATION_CROWD_SIZE = 12;
+
+// Zahtevi korisnika (ili generatora dogadjaja) za jedan korak simulacije
+struct SimInput {
+    bool addPassenger = false;      // Levi klik
+    bool removePassenger = false;   // Desni klik
+    bool sendInspector = false;     // Taster K
+};
+
+// ========== SIMULACIJA AUTOBUSA ==========
+// Autobus, vrata, putnici i kontrola - bez ikakve zavisnosti od OpenGL-a/GLFW-a,
+// tako da se isti kod koristi i u aplikaciji i u headless pokretanju.
+class BusSimulation {
+public:
+    explicit BusSimulation(const SeatLayout& layout = makeSoloBusLayout());
+
+    void seed(uint64_t value);
+    void step(float dt, const SimInput& input);
+
+    // Kretanje putnika kroz vrata do mesta i nazad (deo step-a, javno zbog benchmark-a)
+    void updatePassengers(float dt);
+    // Tacka ka kojoj putnik trenutno ide (ispred vrata ili tacka putanje)
+    glm::vec3 waypointPosition(const Passenger& p) const;
+
+    // ===== Stanje autobusa =====
+    int currentStation = 0;
+    int nextStation = 1;
+    float busProgress = 0.0f;
+    bool busAtStation = true;
+    float stationTimer = 0.0f;
+    int stationsVisited = 0;
+
+    // ===== Putnici i kontrola =====
+    int passengers = 0;
+    bool isInspectorInBus = false;
+    int totalFines = 0;
+    int inspectorExitStation = -1;
+    std::vector<Passenger> activePassengers;
+    SeatMap seatMap;
+    NavGrid navGrid;                       // Putanje od ulaza do mesta, iz seatMap rasporeda
+    bool passengerEntering = false;
+    bool passengerExiting = false;
+    float passengerAnimTimer = 0.0f;
+
+    // ===== Animacije =====
+    float doorOffset = 0.4f;
+    bool doorOpening = false;
+    bool doorClosing = false;
+    float wheelRotation = 0.0f;
+    float busShakeOffset = 0.0f;
+    float busShakeTime = 0.0f;
+
+    // ===== Guzva na peronu =====
+    bool crowdEnabled = true;
+    CrowdSim stationCrowd;
+
+    double simTime = 0.0;                  // double: float prestaje da raste posle ~3 dana simulacije
+    uint32_t stepCount = 0;
+    Pcg32 rng;
+    bool logToConsole = true;
+    TelemetryWriter* telemetry = nullptr;  // Ako je postavljen, svaki dogadjaj ide i u binarni dnevnik
+
+private:
+    bool addPassenger(bool isInsp);
+    bool removePassenger(bool removeInspector);
+    void updateBus(float dt, const SimInput& input);
+    void updateDoor();
+    void emit(uint16_t type, int station, int32_t value = 0);
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "BusSimulation.h"
+#include "MappedFile.h"
+
+// ========== CHECKPOINT SIMULACIJE ==========
+// Celo stanje simulacije (autobus, putnici, kontrola, kazne, tajmeri, rng, guzva) u jednom
+// ravnom binarnom fajlu, little-endian: zaglavlje sa tabelom sekcija (pomeraj, velicina), pa
+// sekcije poravnate na 16 bajtova. Putnici su jedan neprekidan niz Passenger struktura, pa je
+// ucitavanje mapiranje fajla i pretvaranje pomeraja u pokazivace, a u simulaciju idu jednim
+// kopiranjem. Zaglavlje cuva velicinu Passenger-a i broj mesta i ulaza rasporeda, pa se
+// checkpoint drugog build-a ili rasporeda odbija umesto da se pogresno procita.
+// NavGrid i SeatMap se ne cuvaju: racunaju se iz rasporeda, a zauzeta mesta iz putnika.
+
+const uint32_t CHECKPOINT_VERSION = 1;
+
+enum CheckpointSectionType : uint32_t {
+    CHECKPOINT_BUS = 0,             // CheckpointBusState
+    CHECKPOINT_PASSENGERS = 1,      // Passenger[]
+    CHECKPOINT_CROWD = 2,           // CrowdSim::writeState
+    CHECKPOINT_DRIVER = 3,          // CheckpointDriverState
+    CHECKPOINT_SECTION_COUNT = 4
+};
+
+struct CheckpointSection {
+    uint64_t offset;                // Od pocetka fajla
+    uint64_t bytes;
+};
+
+struct CheckpointHeader {
+    char magic[4];                  // "KCHK"
+    uint32_t version;
+    uint32_t passengerSize;         // sizeof(Passenger) pri upisu
+    uint32_t placeCount;            // Raspored mesta pri upisu
+    uint32_t doorCount;
+    uint32_t reserved;
+    uint64_t totalBytes;
+    CheckpointSection sections[CHECKPOINT_SECTION_COUNT];
+};
+static_assert(sizeof(CheckpointHeader) == 96, "CheckpointHeader mora biti 96 bajtova");
+
+// Skalarno stanje BusSimulation; polja fiksne sirine, bez praznina
+struct CheckpointBusState {
+    double simTime;
+    uint64_t rngState;
+    uint64_t rngInc;
+    uint32_t stepCount;
+    int32_t currentStation;
+    int32_t nextStation;
+    int32_t stationsVisited;
+    int32_t passengers;
+    int32_t totalFines;
+    int32_t inspectorExitStation;
+    float busProgress;
+    float stationTimer;
+    float passengerAnimTimer;
+    float doorOffset;
+    float wheelRotation;
+    float busShakeOffset;
+    float busShakeTime;
+    uint8_t busAtStation;
+    uint8_t isInspectorInBus;
+    uint8_t passengerEntering;
+    uint8_t passengerExiting;
+    uint8_t doorOpening;
+    uint8_t doorClosing;
+    uint8_t crowdEnabled;
+    uint8_t reserved;
+};
+static_assert(sizeof(CheckpointBusState) == 88, "CheckpointBusState mora biti 88 bajtova");
+
+// Stanje onoga ko pokrece simulaciju: kamera i prekidaci prikaza (SimThread) ili generator
+// dogadjaja (headless_sim). Polja koja pokretac ne koristi ostaju podrazumevana.
+struct CheckpointDriverState {
+    uint32_t frame = 0;
+    float yaw = -90.0f;
+    float pitch = -5.0f;
+    float fov = 60.0f;
+    glm::vec3 cameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    uint8_t depthTestEnabled = 1;
+    uint8_t faceCullingEnabled = 0;
+    uint8_t reserved[2] = { 0, 0 };
+    int32_t lastStation = -1;
+    uint32_t reserved2 = 0;
+    uint64_t eventRngState = 0;
+    uint64_t eventRngInc = 0;
+};
+static_assert(sizeof(CheckpointDriverState) == 56, "CheckpointDriverState mora biti 56 bajtova");
+
+// Celo stanje u bafer (nit simulacije; bez alokacija kad bafer vec ima kapacitet).
+// false samo na big-endian masini (format je little-endian).
+bool writeCheckpoint(const BusSimulation& sim, const CheckpointDriverState& driver, std::vector<uint8_t>& out);
+
+// Checkpoint mapiran iz fajla; sekcije su pokazivaci u mapiranu memoriju
+class CheckpointFile {
+public:
+    // Mapira fajl i proverava zaglavlje i granice sekcija
+    bool open(const std::string& path);
+    void close();
+
+    const CheckpointHeader& header() const { return *(const CheckpointHeader*)file.data(); }
+    const CheckpointBusState& bus() const { return *busState; }
+    const Passenger* passengers() const { return passengerData; }
+    size_t passengerCount() const { return passengerTotal; }
+    const CheckpointDriverState& driver() const { return *driverState; }
+
+    // sim mora biti napravljen sa istim rasporedom mesta; false (sim nepromenjen) ako raspored
+    // ili putnici ne odgovaraju. driver moze biti nullptr.
+    bool restore(BusSimulation& sim, CheckpointDriverState* driver) const;
+
+private:
+    MappedFile file;
+    std::string path;
+    const CheckpointBusState* busState = nullptr;
+    const Passenger* passengerData = nullptr;
+    size_t passengerTotal = 0;
+    const uint8_t* crowdData = nullptr;
+    size_t crowdBytes = 0;
+    const CheckpointDriverState* driverState = nullptr;
+};
+
+// Sinhrono cuvanje i ucitavanje (--restore, alati)
+bool saveCheckpoint(const std::string& path, const BusSimulation& sim, const CheckpointDriverState& driver);
+bool loadCheckpoint(const std::string& path, BusSimulation& sim, CheckpointDriverState* driver);
+
+// ========== PERIODICNI CHECKPOINT ==========
+// Nit simulacije samo serijalizuje stanje u bafer (nekoliko KB), a pozadinska nit ga upisuje
+// u <path>.tmp i preimenuje u path, pa na disku uvek ostaje ceo poslednji checkpoint.
+// Ako prethodni upis jos traje, checkpoint se preskace i broji umesto da koci korak.
+class CheckpointWriter {
+public:
+    ~CheckpointWriter();
+
+    bool open(const std::string& path, double intervalSeconds);
+    // Ceka upis u toku
+    void close();
+    bool isOpen() const { return opened; }
+
+    // Posle svakog koraka; checkpoint na svakih intervalSeconds vremena simulacije
+    void update(const BusSimulation& sim, const CheckpointDriverState& driver);
+
+    uint64_t writtenCount() const { return written.load(std::memory_order_relaxed); }
+    uint64_t skippedCount() const { return skipped.load(std::memory_order_relaxed); }
+
+private:
+    void writerLoop();
+
+    std::string path;
+    double interval = 0.0;
+    double nextTime = -1.0;
+    bool opened = false;
+
+    // Bafer pripada niti simulacije dok busy nije postavljen, a posle toga niti za upis
+    std::vector<uint8_t> buffer;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool busy = false;              // Pod mutex-om
+    bool quitting = false;
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<uint64_t> skipped{ 0 };
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <GL/glew.h>
+
+#include "GLRenderBackend.h"
+#include "LightGrid.h"
+
+// ========== KLASTEROVANO OSVETLJENJE (GPU) ==========
+// Tri texture buffer-a za basic3d.frag: podaci svetala (RGBA32F), opseg liste po klasteru
+// (RG32UI) i indeksi svetala (R32UI). Sadrzaj se menja svaki frejm (updateBuffer u listi).
+// Uniforme postoje samo u varijanti basic3d sa CLUSTERED_LIGHTS. Bafere i teksture drzi backend.
+
+class ClusteredLighting {
+public:
+    // Jedinice tekstura za uLightData/uLightClusters/uLightIndices (0 ostaje za uTex)
+    static const int FIRST_TEXTURE_UNIT = 1;
+
+    void init(GLRenderBackend& backend);
+    void destroy(GLRenderBackend& backend);
+
+    // Zapisuje upload mreze, vezivanje tekstura i uniforme; viewport je velicina ekrana u
+    // pikselima. Podaci se citaju iz grid pri izvrsavanju liste.
+    void record(RenderCommandList& list, uint32_t shader3D, int viewportWidth, int viewportHeight, const LightGrid& grid);
+
+private:
+    struct TextureBuffer {
+        uint32_t buffer = RENDER_NONE;
+        uint32_t texture = RENDER_NONE;
+    };
+
+    void createBuffer(GLRenderBackend& backend, TextureBuffer& tb, GLenum format);
+
+    TextureBuffer lightData, clusterRanges, lightIndices;
+};
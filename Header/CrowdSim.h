@@ -0,0 +1,96 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Random.h"
+
+class JobSystem;
+
+// ========== SIMULACIJA GUZVE NA STANICI ==========
+// Putnici koji cekaju na peronu (lokalne koordinate stanice iz setupStation3D).
+// Podaci su u SoA nizovima, susedi se traze preko uniformne mreze celija (spatial hash
+// nad ogranicenom povrsinom perona), a integracija se radi SIMD kernelima (AVX2 / SSE2 / skalarno).
+// Posle svakog razvrstavanja po celijama agenti se preurede u memoriji, pa su susedi
+// uvek blizu jedni drugima i pretraga 3x3 celije cita uzastopne opsege.
+// Iz svake celije se za razdvajanje uzima najvise MAX_CELL_NEIGHBORS agenata. Celija je
+// precnik agenta, pa u nju bez preklapanja stanu 4; kad se mnogo agenata nagura na mali
+// peron, pretraga ostaje najvise 9 * MAX_CELL_NEIGHBORS provera po agentu umesto da raste
+// kvadratno sa gustinom.
+
+struct CrowdParams {
+    glm::vec2 areaMin = glm::vec2(-1.3f, -0.6f);   // Granice perona (x, z)
+    glm::vec2 areaMax = glm::vec2(1.3f, 0.1f);
+    float groundY = -0.62f;                          // Visina na kojoj stoje (stopala na platformi)
+    float agentRadius = 0.12f;
+    float maxSpeed = 0.35f;
+    float goalRadius = 0.1f;                         // Kad je cilj ovoliko blizu, bira se novi
+    float separationWeight = 3.0f;
+    float goalWeight = 2.0f;
+    float wallWeight = 4.0f;
+};
+
+class CrowdSim {
+public:
+    explicit CrowdSim(const CrowdParams& params = CrowdParams());
+
+    void seed(uint64_t value) { rng.seed(value); }
+    // Upravljanje velikih guzvi ide kroz jobs (nullptr = na niti koja poziva update)
+    void setJobSystem(JobSystem* value) { jobs = value; }
+    void spawn(int count);
+    void clear();
+    void update(float dt);
+
+    // 4 float-a po agentu (x, y, z, ugao oko Y ose) - direktno u instance VBO
+    void writeInstances(std::vector<float>& out);
+    // 2 float-a po agentu, istim redom: vreme klipa hoda i udeo hoda (0 = stoji, 1 = punom brzinom)
+    void writeAnimation(std::vector<float>& out) const;
+
+    int size() const { return (int)posX.size(); }
+    const CrowdParams& getParams() const { return params; }
+
+    // Stanje za checkpoint (Checkpoint.h): broj agenata i rng, pa SoA nizovi kao uzastopni
+    // blokovi. Sile i mreza celija se racunaju iz njih u sledecem update-u.
+    static size_t stateBytes(int count);
+    void writeState(uint8_t* out) const;
+    bool readState(const uint8_t* in, size_t bytes);
+
+private:
+    static const int PARALLEL_THRESHOLD = 4096;
+    static const int STEERING_BATCH = 1024;
+    static const uint32_t MAX_CELL_NEIGHBORS = 8;
+
+    void spawnArrays(int total);    // Svi nizovi na total agenata (novi agenti miruju)
+    void buildSpatialHash();
+    void computeSteering(int first, int last);
+    void integrate(float dt);
+    void advanceWalk(float dt);
+    void pickGoal(int i);
+
+    int cellX(float x) const;
+    int cellZ(float z) const;
+
+    CrowdParams params;
+    Pcg32 rng;
+    JobSystem* jobs = nullptr;
+    float cellSize;
+    float invCellSize;
+
+    // SoA stanje agenata
+    std::vector<float> posX, posZ;
+    std::vector<float> velX, velZ;
+    std::vector<float> goalX, goalZ;
+    std::vector<float> steerX, steerZ;
+    std::vector<float> heading;         // Poslednji smer kretanja (za crtanje)
+    std::vector<float> walkTime;        // Klip hoda; tece brze sto je agent brzi
+    std::vector<uint8_t> needsGoal;     // Agent je stigao do cilja, bira se novi posle prolaza
+
+    // Mreza celija: brojanje po celijama pa prefiksna suma (counting sort)
+    int gridW, gridH;
+    std::vector<uint32_t> cellStart;    // gridW * gridH + 1 elemenata
+    std::vector<uint32_t> cellCursor;
+    std::vector<uint32_t> agentCell;
+    std::vector<uint32_t> order;        // Novi redosled agenata (sortirano po celiji)
+    std::vector<float> scratch;         // Privremeni niz za preuredjivanje SoA nizova
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+// ========== DINAMICKA REZOLUCIJA ==========
+// Kontroler razmere 3D scene: scena se crta u umanjen viewport van-ekranskog cilja i
+// razvlaci na ekran. Posle svakog frejma dobija izmereno vreme scene (GPU tajmer, ili CPU
+// vreme crtanja ako GPU merenje nije dostupno) i menja razmeru tako da vreme stane u
+// budzet. Cena scene se uzima kao srazmerna broju piksela (razmera^2). Bez OpenGL zavisnosti.
+
+class DynamicResolution {
+public:
+    // budgetMs - ciljano vreme scene; razmera ostaje u [minScale, 1]
+    void init(float budgetMs, float minScale);
+    // Iskljucuje kontroler; razmera ostaje scale
+    void setFixed(float scale);
+    // gpuMs < 0 = GPU merenje jos nije stiglo
+    void update(float gpuMs, float cpuMs);
+
+    float scale() const { return current; }
+    bool isFixed() const { return fixed; }
+    // Dimenzije umanjenog viewport-a (najmanje MIN_SIZE piksela)
+    int scaledWidth(int width) const { return scaled(width); }
+    int scaledHeight(int height) const { return scaled(height); }
+
+private:
+    static const int MIN_SIZE = 16;
+    // Merenja kasne nekoliko frejmova (prsten upita), pa se posle promene ceka
+    static const int SETTLE_FRAMES = 8;
+
+    int scaled(int size) const;
+
+    float budget = 10.0f;
+    float minScale = 0.5f;
+    float current = 1.0f;
+    float smoothedMs = -1.0f;
+    int framesSinceChange = 0;
+    bool fixed = false;
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+
+// ========== STATISTIKA FREJMOVA ==========
+// Kruzni bafer poslednjih FRAME_STATS_WINDOW frejmova: ukupno trajanje frejma,
+// CPU vreme simulacije i CPU vreme crtanja (ms). Bez OpenGL zavisnosti.
+
+const int FRAME_STATS_WINDOW = 240;
+
+struct FrameSummary {
+    int count = 0;
+    float p50 = 0.0f, p95 = 0.0f, p99 = 0.0f, max = 0.0f;  // Trajanje frejma
+    float simAvg = 0.0f, simMax = 0.0f;
+    float renderAvg = 0.0f, renderMax = 0.0f;
+};
+
+class FrameStats {
+public:
+    void push(float frameMs, float simMs, float renderMs);
+    void summarize(FrameSummary& out) const;
+
+    int size() const { return count; }
+    // i = 0 je najstariji frejm u prozoru
+    float frameAt(int i) const { return frameMs[(head + FRAME_STATS_WINDOW - count + i) % FRAME_STATS_WINDOW]; }
+
+private:
+    float frameMs[FRAME_STATS_WINDOW] = {};
+    float simMs[FRAME_STATS_WINDOW] = {};
+    float renderMs[FRAME_STATS_WINDOW] = {};
+    int head = 0;
+    int count = 0;
+};
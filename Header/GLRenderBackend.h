@@ -0,0 +1,184 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "GLStats.h"
+#include "GpuMemory.h"
+#include "RenderCommands.h"
+#include "ShaderCache.h"
+
+// ========== GL BACKEND ==========
+// Tabele resursa na koje komande pokazuju indeksima i izvrsavanje RenderCommandList-e.
+// Bafere, mreze (VAO), teksture i ciljeve (FBO) pravi backend; teksture ucitane sa strane
+// (loadImageToTexture) se preuzimaju sa addTexture. Sejderi (ShaderCache) se samo
+// registruju, osim onih koje napravi loadCapture.
+//
+// Vlasnik resursa ga vraca sa release*; destroy() ispisuje sve sto je ostalo (curenje) i
+// brise ga. Zauzeta memorija se procenjuje po kategoriji (GpuMemory). Kad se predje budzet,
+// izbacuju se teksture ucitane iz fajlova (loadTexture) i ponovo ucitavaju pri vezivanju.
+//
+// Stanje (depth test, blending, culling, cilj) se pamti, pa se isto stanje ne salje ponovo.
+// Crtanje, stanje, vezivanje i upload idu kroz omotace iz GLStats.h i ulaze u brojace
+// prolaza zapisanog sa beginPass.
+
+const uint32_t RENDER_NONE = 0xffffffffu;
+const uint32_t RENDER_SCREEN = 0;      // Cilj 0 je ekran (ili zamena iz setScreenTarget)
+
+struct MeshAttribute {
+    uint32_t location;
+    uint32_t buffer;
+    int components;     // float komponente
+    int stride;         // bajtova
+    int offset;         // bajtova
+    int divisor;        // 0 = po temenu, 1 = po instanci
+};
+
+enum RenderBufferUsage : uint8_t {
+    BUFFER_STATIC,
+    BUFFER_STREAM       // Sadrzaj se menja svaki frejm (updateBuffer)
+};
+
+class GLRenderBackend {
+public:
+    // Postavlja i nepromenljivo stanje: blend funkciju i culling zadnjih lica (CCW je prednje)
+    void init(int screenWidth, int screenHeight);
+    void destroy();
+
+    uint32_t addShader(ShaderCache* shaders);
+    // Bafer za temena, indekse ili texture buffer; data moze biti NULL
+    uint32_t createBuffer(const void* data, size_t bytes, RenderBufferUsage usage);
+    uint32_t createMesh(const std::vector<MeshAttribute>& attributes, uint32_t indexBuffer = RENDER_NONE);
+    void addAttribute(uint32_t mesh, const MeshAttribute& attribute);
+
+    // Preuzima teksturu i postavlja joj LINEAR filtriranje i CLAMP_TO_EDGE
+    uint32_t addTexture(GLuint texture);
+    // loadImageToTexture + addTexture; RENDER_NONE ako slika nije ucitana. Tekstura se moze
+    // izbaciti kad je memorija preko budzeta i tada se ponovo ucitava pri prvom vezivanju.
+    uint32_t loadTexture(const char* path);
+    uint32_t createTexture(int width, int height, GLenum internalFormat, GLenum format, GLenum type,
+                           const void* pixels, GLenum filter);
+    uint32_t createBufferTexture(uint32_t buffer, GLenum format);
+    // Boja (RGBA8 tekstura) + depth24/stencil8 renderbuffer
+    uint32_t createTarget(int width, int height);
+    uint32_t targetTexture(uint32_t target) const { return targets[target].colorTexture; }
+    GLuint framebuffer(uint32_t target) const { return targets[target].framebuffer; }
+
+    // Cilj 0 crta u dati framebuffer umesto u ekran (replay bez prozora)
+    void setScreenTarget(GLuint framebuffer);
+
+    // ========== GPU TAJMERI ==========
+    // GL_TIME_ELAPSED upiti u prstenu od GPU_TIMER_QUERIES, pa se rezultat cita frejm-dva
+    // kasnije bez cekanja na GPU. Ako su svi upiti jos u letu, merenje se preskace.
+    uint32_t createTimer();
+    // Poslednje zavrseno merenje u ms; -1 dok nijedno nije gotovo
+    float timerMs(uint32_t timer);
+
+    // ========== OSLOBADJANJE ==========
+    // Indeks se ne koristi ponovo; ponovno oslobadjanje ne radi nista. Mreza oslobadja i
+    // svoje bafere (temena, instance, indeksi), cilj i svoju teksturu boje. Texture buffer
+    // ne oslobadja bafer.
+    void releaseBuffer(uint32_t buffer);
+    void releaseMesh(uint32_t mesh);
+    void releaseTexture(uint32_t texture);
+    void releaseTarget(uint32_t target);
+
+    void execute(const RenderCommandList& list);
+    // Posle poslednje liste u frejmu: preko budzeta se izbacuju teksture iz fajlova koje
+    // nisu vezane u ovom frejmu, najdavnije koriscene prve
+    void endFrame();
+
+    GpuMemory& memory() { return gpuMemory; }
+    const GpuMemory& memory() const { return gpuMemory; }
+
+    // ========== SNIMAK FREJMA (RenderCapture.cpp) ==========
+    // Lista + svi resursi (sadrzaj bafera i tekstura se cita sa GPU-a, sejderi kao putanje)
+    bool saveCapture(const std::string& path, const RenderCommandList& list);
+    // Pravi resurse i sejdere iz snimka; backend mora biti prazan (posle init)
+    bool loadCapture(const std::string& path, RenderCommandList& list);
+
+    int screenWidth() const { return targets[RENDER_SCREEN].width; }
+    int screenHeight() const { return targets[RENDER_SCREEN].height; }
+    GLuint glTexture(uint32_t texture) const { return textures[texture].id; }
+
+private:
+    struct Buffer {
+        GLuint id;
+        size_t bytes;       // Trenutna velicina skladista
+        RenderBufferUsage usage;
+        bool released;
+    };
+    struct Mesh {
+        GLuint vao;
+        std::vector<MeshAttribute> attributes;
+        uint32_t indexBuffer;
+        bool released;
+    };
+    struct Texture {
+        GLuint id;              // 0 dok je izbacena
+        GLenum target;          // GL_TEXTURE_2D ili GL_TEXTURE_BUFFER
+        GLenum internalFormat;
+        int width, height;
+        uint32_t buffer;        // Samo za GL_TEXTURE_BUFFER
+        GLenum filter;
+        GpuMemoryCategory category;     // Tekstura boje cilja se racuna u ciljeve
+        std::string path;       // Prazno = ne moze se ponovo ucitati
+        bool resident;
+        bool released;
+        uint64_t lastUsed;      // Frejm poslednjeg vezivanja + 1
+    };
+    struct Target {
+        GLuint framebuffer;
+        GLuint depthStencil;
+        uint32_t colorTexture;
+        int width, height;
+        bool released;
+    };
+    struct Shader {
+        ShaderCache* cache;
+        bool owned;
+    };
+    static const int GPU_TIMER_QUERIES = 4;
+    struct Timer {
+        GLuint queries[GPU_TIMER_QUERIES];
+        int next;           // Sledeci slobodan upit
+        int pending;        // Zapoceti upiti ciji rezultat nije procitan
+        bool running;       // Upit je zapocet u ovoj listi (preskocen ako je prsten pun)
+        float lastMs;
+    };
+
+    uint32_t createTargetFor(uint32_t colorTexture);
+    uint32_t pushTexture(GLuint id, GLenum target, GLenum internalFormat, int width, int height, uint32_t buffer, GLenum filter);
+    static size_t textureBytes(const Texture& texture);
+    void makeResident(uint32_t texture);
+    void enforceBudget();
+    void reportLeaks() const;
+    void applyAttribute(const MeshAttribute& attribute);
+    void uploadBuffer(Buffer& buffer, const void* data, size_t bytes);
+    void setState(RenderState state, bool enabled);
+    void setStencil(RenderStencilMode mode, int ref);
+    void bindTarget(uint32_t target);
+    void pollTimer(Timer& timer);
+
+    std::vector<Shader> shaders;
+    std::deque<ShaderCache> ownedShaders;   // Deque - pokazivaci ostaju vazeci
+    std::vector<Buffer> buffers;
+    std::vector<Mesh> meshes;
+    std::vector<Texture> textures;
+    std::vector<Target> targets;
+    std::vector<Timer> timers;
+
+    // Poslednje postavljeno stanje; -1 = nepoznato
+    int states[3] = { -1, -1, -1 };
+    int stencilMode = -1, stencilRef = -1;
+    uint32_t boundTarget = RENDER_NONE;
+    uint32_t boundMesh = RENDER_NONE;
+    float lineWidth = -1.0f;
+
+    GpuMemory gpuMemory;
+    uint64_t frame = 0;
+    bool budgetWarned = false;
+    bool fromCapture = false;   // Resursi iz loadCapture pripadaju backend-u - nisu curenje
+};
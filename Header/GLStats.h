@@ -0,0 +1,213 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+
+// ========== BROJAC GL POZIVA ==========
+// Omotaci oko gl* poziva iz frejma (crtanje, stanje, programi, uniforme, vezivanje i
+// upload bafera/tekstura) koji broje pozive i poslate bajtove u tekucem frejmu. Brojaci se
+// vode po prolazu (beginPass - npr. "display", "scene"); pozivi pre prvog prolaza idu u
+// prolaz bez imena. total() je zbir svih prolaza. Budzet (GLBudget) proverava PerfReport.
+
+struct GLCounters {
+    uint64_t drawCalls = 0;
+    uint64_t triangles = 0;
+    uint64_t stateChanges = 0;      // glEnable/glDisable, framebuffer, viewport, debljina linije
+    uint64_t programBinds = 0;
+    uint64_t uniformUploads = 0;
+    uint64_t textureBinds = 0;
+    uint64_t vertexArrayBinds = 0;
+    uint64_t bufferUploads = 0;
+    uint64_t bufferBytes = 0;
+    uint64_t textureUploads = 0;
+    uint64_t textureBytes = 0;
+
+    uint64_t uploadBytes() const { return bufferBytes + textureBytes; }
+    void add(const GLCounters& other);
+};
+
+// Tabela brojaca za izvestaje (ime u JSON-u + polje)
+struct GLCounterInfo {
+    const char* name;
+    uint64_t GLCounters::*field;
+};
+
+const int GL_COUNTER_COUNT = 11;
+extern const GLCounterInfo GL_COUNTERS[GL_COUNTER_COUNT];
+
+const int GL_STATS_MAX_PASSES = 8;
+
+struct GLPassStats {
+    char name[24];      // "" = van prolaza
+    GLCounters counters;
+};
+
+struct GLStats {
+    GLPassStats passes[GL_STATS_MAX_PASSES];
+    int passCount = 0;
+    GLCounters* current = nullptr;
+
+    void reset();
+    // Prolaz sa istim imenom u istom frejmu nastavlja postojeci; preko GL_STATS_MAX_PASSES ide u poslednji
+    void beginPass(const char* name);
+    GLCounters total() const;
+};
+
+extern GLStats glStats;
+
+// Budzet frejma; 0 = bez ogranicenja
+struct GLBudget {
+    uint64_t drawCalls = 300;
+    uint64_t uploadBytes = 1 << 20;
+
+    bool drawsOver(const GLCounters& c) const { return drawCalls != 0 && c.drawCalls > drawCalls; }
+    bool uploadOver(const GLCounters& c) const { return uploadBytes != 0 && c.uploadBytes() > uploadBytes; }
+};
+
+inline GLCounters& glCounters() {
+    if (glStats.current == nullptr) glStats.beginPass("");
+    return *glStats.current;
+}
+
+inline uint64_t trianglesFor(GLenum mode, GLsizei count) {
+    switch (mode) {
+    case GL_TRIANGLES: return (uint64_t)(count / 3);
+    case GL_TRIANGLE_FAN:
+    case GL_TRIANGLE_STRIP: return count > 2 ? (uint64_t)(count - 2) : 0;
+    default: return 0;  // Linije i tacke
+    }
+}
+
+// Bajtova po pikselu za format/tip iz glTexImage2D (redovi bez poravnanja)
+inline uint64_t pixelBytes(GLenum format, GLenum type) {
+    uint64_t components = 4;
+    switch (format) {
+    case GL_RED: case GL_RED_INTEGER: components = 1; break;
+    case GL_RG: case GL_RG_INTEGER: components = 2; break;
+    case GL_RGB: case GL_RGB_INTEGER: components = 3; break;
+    }
+    switch (type) {
+    case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+    case GL_HALF_FLOAT: case GL_UNSIGNED_SHORT: case GL_SHORT: return components * 2;
+    default: return components * 4;
+    }
+}
+
+// ========== CRTANJE ==========
+inline void drawArrays(GLenum mode, GLint first, GLsizei count) {
+    glDrawArrays(mode, first, count);
+    GLCounters& c = glCounters();
+    c.drawCalls++;
+    c.triangles += trianglesFor(mode, count);
+}
+
+inline void drawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint baseVertex) {
+    glDrawElementsBaseVertex(mode, count, type, indices, baseVertex);
+    GLCounters& c = glCounters();
+    c.drawCalls++;
+    c.triangles += trianglesFor(mode, count);
+}
+
+inline void drawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+    glDrawArraysInstanced(mode, first, count, instances);
+    GLCounters& c = glCounters();
+    c.drawCalls++;
+    c.triangles += trianglesFor(mode, count) * (uint64_t)instances;
+}
+
+// ========== STANJE ==========
+inline void setCapability(GLenum capability, bool enabled) {
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+    glCounters().stateChanges++;
+}
+
+inline void bindFramebuffer(GLuint framebuffer) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glCounters().stateChanges++;
+}
+
+inline void setViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    glViewport(x, y, width, height);
+    glCounters().stateChanges++;
+}
+
+// Funkcija, referentna vrednost i upis zajedno - jedna promena stanja
+inline void setStencil(GLenum func, GLint ref, GLenum passOp, GLuint writeMask) {
+    glStencilFunc(func, ref, 0xff);
+    glStencilOp(GL_KEEP, GL_KEEP, passOp);
+    glStencilMask(writeMask);
+    glCounters().stateChanges++;
+}
+
+inline void setLineWidth(GLfloat width) {
+    glLineWidth(width);
+    glCounters().stateChanges++;
+}
+
+// Razvlacenje cilja preko drugog cilja je prolaz preko celog ekrana, pa se broji kao crtanje
+inline void blitFramebuffer(GLuint source, GLint sourceWidth, GLint sourceHeight,
+                            GLuint destination, GLint destinationWidth, GLint destinationHeight) {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, source);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, destination);
+    glBlitFramebuffer(0, 0, sourceWidth, sourceHeight, 0, 0, destinationWidth, destinationHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glCounters().drawCalls++;
+}
+
+// ========== PROGRAMI I UNIFORME ==========
+inline void useProgram(GLuint program) {
+    glUseProgram(program);
+    glCounters().programBinds++;
+}
+
+inline void uniform1i(GLint location, GLint x) { glUniform1i(location, x); glCounters().uniformUploads++; }
+inline void uniform1f(GLint location, GLfloat x) { glUniform1f(location, x); glCounters().uniformUploads++; }
+inline void uniform3i(GLint location, GLint x, GLint y, GLint z) { glUniform3i(location, x, y, z); glCounters().uniformUploads++; }
+inline void uniform2f(GLint location, GLfloat x, GLfloat y) { glUniform2f(location, x, y); glCounters().uniformUploads++; }
+inline void uniform3fv(GLint location, const GLfloat* v) { glUniform3fv(location, 1, v); glCounters().uniformUploads++; }
+inline void uniformMatrix4fv(GLint location, const GLfloat* m) { glUniformMatrix4fv(location, 1, GL_FALSE, m); glCounters().uniformUploads++; }
+
+// ========== VEZIVANJE ==========
+inline void bindTexture(GLenum target, GLuint texture) {
+    glBindTexture(target, texture);
+    glCounters().textureBinds++;
+}
+
+inline void bindVertexArray(GLuint vao) {
+    glBindVertexArray(vao);
+    glCounters().vertexArrayBinds++;
+}
+
+// ========== UPLOAD ==========
+// data == NULL samo rezervise skladiste i ne broji se u bajtove
+inline void bufferData(GLenum target, size_t bytes, const void* data, GLenum usage) {
+    glBufferData(target, (GLsizeiptr)bytes, data, usage);
+    if (data == NULL) return;
+    GLCounters& c = glCounters();
+    c.bufferUploads++;
+    c.bufferBytes += bytes;
+}
+
+inline void bufferSubData(GLenum target, size_t offset, size_t bytes, const void* data) {
+    glBufferSubData(target, (GLintptr)offset, (GLsizeiptr)bytes, data);
+    GLCounters& c = glCounters();
+    c.bufferUploads++;
+    c.bufferBytes += bytes;
+}
+
+inline void texImage2D(GLenum target, GLint internalFormat, GLsizei width, GLsizei height,
+                       GLenum format, GLenum type, const void* pixels) {
+    glTexImage2D(target, 0, internalFormat, width, height, 0, format, type, pixels);
+    if (pixels == NULL) return;
+    GLCounters& c = glCounters();
+    c.textureUploads++;
+    c.textureBytes += (uint64_t)width * height * pixelBytes(format, type);
+}
+
+inline void texSubImage2D(GLenum target, GLint x, GLint y, GLsizei width, GLsizei height,
+                          GLenum format, GLenum type, const void* pixels) {
+    glTexSubImage2D(target, 0, x, y, width, height, format, type, pixels);
+    GLCounters& c = glCounters();
+    c.textureUploads++;
+    c.textureBytes += (uint64_t)width * height * pixelBytes(format, type);
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Passenger.h"
+
+// ========== GEOMETRIJA ==========
+// Generisanje temena za putanju, krug, put, stanicu, kabinu i ljude, svetla duz puta i matrice putnika.
+// Nema OpenGL poziva - Main samo salje rezultat u VBO, a isti kod koriste i alati bez prozora.
+
+struct Vec2 {
+    float x, y;
+    Vec2(float x = 0, float y = 0) : x(x), y(y) {}
+};
+
+struct Station {
+    Vec2 position;
+    int number;
+};
+
+Vec2 lerp(Vec2 a, Vec2 b, float t);
+Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t);
+
+// Raspored stanica na 2D mapi (count mora biti NUM_STATIONS)
+void initStationPositions(Station* stations, int count);
+
+// Kontrolna tacka krive izmedju stanice index i sledece
+Vec2 pathControlPoint(Vec2 p0, Vec2 p2, int index);
+
+// 2D putanja: (segmentsPerEdge + 1) tacaka (x, y) po ivici
+void buildPathVertices(const Station* stations, int count, int segmentsPerEdge, std::vector<float>& out);
+// Jedinicni krug: (segments + 1) tacaka (x, y)
+void buildCircleVertices(int segments, std::vector<float>& out);
+
+// 3D temena: pozicija (3), boja (4), UV (2), normala (3) - po 4 temena za svaki TRIANGLE_FAN
+const int VERTEX_3D_FLOATS = 3 + 4 + 2 + 3;
+void buildRoadVertices(float roadLength, std::vector<float>& out);
+void buildStationVertices(std::vector<float>& out);
+// Poster na zadnjem zidu stanice (isti koordinatni sistem kao stanica), UV preko cele slike
+void buildPosterVertices(std::vector<float>& out);
+
+// Kabina (23 kvadra: 11 volan, 12 displej, 20 vrata, ostali staticni), humanoid (glava 0-5,
+// trup 6-11, ruke 12-19, leva noga 20-23, desna noga 24-27), kosa (5) i kapica kontrolora (4)
+void buildCabinVertices(std::vector<float>& out);
+void buildHumanoidVertices(std::vector<float>& out);
+void buildHairVertices(std::vector<float>& out);
+void buildCapVertices(std::vector<float>& out);
+// Dodaje kvadre (TRIANGLE_FAN po 4 temena) kao listu trouglova
+void appendQuadsAsTriangles(const float* quads, int quadCount, std::vector<float>& out);
+
+// Tackasto svetlo u svetu (boja moze biti > 1); doseg je ograniceni radijus
+struct PointLight {
+    glm::vec3 position;
+    float radius;
+    glm::vec3 color;
+};
+
+// Nocna svetla duz puta: svetlo na svakoj nadstresnici, ulicne lampe sa obe strane
+// i farovi vozila iz suprotnog smera. stationOffsetZ je z najblize stanice ispred
+// autobusa (svet se pomera ka kameri), time pomera vozila. Ukupno count svetala.
+void buildRouteLights(float stationOffsetZ, float stationDistance, float roadLength, double time,
+                      int count, std::vector<PointLight>& out);
+
+// Model matrica putnika (polozaj i smer); udove pomera skelet (SkeletalAnimation.h)
+glm::mat4 passengerModelMatrix(const glm::mat4& parent, const Passenger& p);
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// ========== GPU MEMORIJA ==========
+// Procena memorije koju drze GL objekti backend-a, po kategoriji: teksture, baferi
+// (temena, indeksi, texture buffer-i) i ciljevi crtanja (boja + depth/stencil). Velicina
+// je ono sto je zatrazeno od drajvera (sirina * visina * bajtova po texelu, velicina
+// bafera); poravnanje i mipmape drajvera se ne vide. Bez OpenGL zavisnosti.
+
+enum GpuMemoryCategory {
+    GPU_MEMORY_TEXTURES,
+    GPU_MEMORY_BUFFERS,
+    GPU_MEMORY_TARGETS,
+    GPU_MEMORY_CATEGORIES
+};
+
+struct GpuMemory {
+    size_t current[GPU_MEMORY_CATEGORIES] = {};
+    size_t highWater[GPU_MEMORY_CATEGORIES] = {};
+    int objects[GPU_MEMORY_CATEGORIES] = {};
+    size_t totalHighWater = 0;
+    size_t budget = 256u << 20;     // 0 = bez ogranicenja
+    int evictions = 0;
+    int reloads = 0;
+
+    void add(GpuMemoryCategory category, size_t bytes);
+    void remove(GpuMemoryCategory category, size_t bytes);
+    // Isti objekat, nova velicina (bafer koji raste)
+    void resize(GpuMemoryCategory category, size_t from, size_t to);
+
+    size_t total() const;
+    bool overBudget() const { return budget != 0 && total() > budget; }
+
+    // Jedan red po kategoriji + ukupno, budzet i izbacivanja
+    void print() const;
+
+    static const char* categoryName(GpuMemoryCategory category);
+};
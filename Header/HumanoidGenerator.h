@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "SkeletalAnimation.h"
+
+// ========== VARIJANTE PUTNIKA ==========
+// Parametarski humanoid: visina (gornji deo tela), gradja (sirina trupa i ramena), frizura
+// i kapica. Sve varijante se pri ucitavanju peku u jedan niz temena (raspored iz Geometry.h)
+// i jedan niz indeksa (trouglovi); varijanta je baseVertex + opseg indeksa po delu tela.
+// Putnik se crta sa po jednim drawIndexed po delu (boja dela je uniforma), pa raznolikost
+// ne dodaje pozive crtanja ni promene mreze. Svako teme pripada jednoj kosti (bones), a
+// varijanta ima svoj skelet jer visina i gradja pomeraju zglobove. Bez OpenGL zavisnosti.
+//
+// Passenger::characterModel je indeks varijante: 0-14 obicni putnici, 15 kontrolor.
+
+enum HairStyle {
+    HAIR_SHORT,
+    HAIR_LONG,
+    HAIR_BALD,
+    HAIR_MOHAWK,
+    HAIR_BUN,
+    HAIR_STYLES
+};
+
+// Delovi redom kojim se crtaju; kosti pomeraju delove unutar jednog poziva (SKINNED)
+enum HumanoidPart {
+    HUMANOID_SKIN,          // Glava i vrat
+    HUMANOID_SHIRT,         // Trup i rukavi
+    HUMANOID_LEFT_LEG,
+    HUMANOID_RIGHT_LEG,
+    HUMANOID_HEADWEAR,      // Kosa ili kapica; prazno za HAIR_BALD bez kapice
+    HUMANOID_PARTS
+};
+
+const int HUMANOID_VARIANTS = 16;
+const int INSPECTOR_VARIANT = 15;
+
+struct HumanoidParams {
+    float height;       // Razmera gornjeg dela tela (od kukova); noge ostaju iste zbog sedista i zgloba kuka
+    float build;        // Razmera sirine trupa; ruke se pomeraju uz ramena
+    HairStyle hair;
+    bool cap;           // Kapica kontrolora umesto kose
+};
+
+struct HumanoidIndexRange {
+    int first;          // Prvi indeks
+    int count;
+};
+
+struct HumanoidVariant {
+    HumanoidParams params;
+    Skeleton skeleton;
+    int baseVertex;
+    int vertexCount;
+    HumanoidIndexRange parts[HUMANOID_PARTS];
+};
+
+struct HumanoidMeshes {
+    std::vector<float> vertices;        // VERTEX_3D_FLOATS po temenu
+    std::vector<float> bones;           // HumanoidBone po temenu (float, kao atribut temena)
+    std::vector<uint32_t> indices;      // Relativni na baseVertex varijante
+    HumanoidVariant variants[HUMANOID_VARIANTS];
+};
+
+// Parametri varijante (characterModel); van opsega se svodi na 0
+HumanoidParams humanoidVariantParams(int variant);
+int clampHumanoidVariant(int variant);
+
+// Osnovni humanoid (srednja visina i gradja, kratka kosa) - isti oblik kao buildHumanoidVertices
+HumanoidParams defaultHumanoidParams();
+void buildHumanoidSkeleton(const HumanoidParams& params, Skeleton& out);
+
+void buildHumanoidVariants(HumanoidMeshes& out);
+// Jedna varijanta kao lista trouglova (instancirana guzva), sa kosti po temenu
+void buildHumanoidTriangles(const HumanoidParams& params, std::vector<float>& vertices, std::vector<float>& bones);
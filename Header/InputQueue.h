@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "InputRecorder.h"
+#include "SpscRing.h"
+
+// ========== RED ULAZNIH DOGADJAJA ==========
+// GLFW callback-ovi (glavna nit) upisuju svaki klik, taster, pomeraj misa i tockica
+// sa vremenskom oznakom u SPSC prsten; nit simulacije ih preuzima i primenjuje u koraku
+// ciji je trenutak dosao posle dogadjaja. Tipovi su isti kao u snimku ulaza (InputEventType).
+
+typedef std::chrono::steady_clock InputClock;
+
+struct TimedInputEvent {
+    int64_t timeNs;         // InputClock, nanosekunde
+    uint16_t type;
+    uint16_t key;
+    float x;
+    float y;
+};
+
+class InputQueue {
+public:
+    InputQueue() : ring(4096) {}
+
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(InputClock::now().time_since_epoch()).count();
+    }
+
+    // Proizvodjac (glavna nit). Pun red odbacuje dogadjaj umesto da blokira.
+    void push(uint16_t type, uint16_t key = 0, float x = 0.0f, float y = 0.0f) {
+        TimedInputEvent e;
+        e.timeNs = now();
+        e.type = type;
+        e.key = key;
+        e.x = x;
+        e.y = y;
+        if (!ring.push(e)) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Potrosac (nit simulacije): dodaje sve pristigle dogadjaje na kraj out
+    void drain(std::vector<TimedInputEvent>& out) {
+        TimedInputEvent batch[256];
+        size_t n;
+        while ((n = ring.popBatch(batch, 256)) > 0) {
+            out.insert(out.end(), batch, batch + n);
+        }
+    }
+
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    SpscRing<TimedInputEvent> ring;
+    std::atomic<uint64_t> dropped{ 0 };
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ========== SNIMANJE I REPRODUKCIJA ULAZA ==========
+// Binarni fajl: zaglavlje (magic, verzija, seed) pa niz InputEvent zapisa fiksne velicine.
+// Svaki frejm se zavrsava FrameTick dogadjajem koji nosi dt, pa reprodukcija
+// koraca simulaciju potpuno isto kao u snimljenom pokretanju.
+
+enum InputEventType : uint16_t {
+    INPUT_FRAME_TICK = 0,   // x = dt frejma
+    INPUT_LEFT_CLICK = 1,
+    INPUT_RIGHT_CLICK = 2,
+    INPUT_KEY = 3,          // key = GLFW kod tastera (K, 1-4)
+    INPUT_MOUSE_DELTA = 4,  // x, y = pomeraj misa u pikselima
+    INPUT_SCROLL = 5        // y = pomeraj tockica
+};
+
+struct InputEvent {
+    uint32_t frame;
+    float time;             // Vreme simulacije u sekundama
+    uint16_t type;
+    uint16_t key;
+    float x;
+    float y;
+};
+
+// Sav ulaz koji simulacija potrosi u jednom frejmu
+struct FrameInput {
+    float dt = 0.0f;
+    bool leftClick = false;
+    bool rightClick = false;
+    bool keyK = false;
+    bool numberKeys[4] = { false, false, false, false };   // Pritisnut taster 1-4 (ivica)
+    float mouseDx = 0.0f;
+    float mouseDy = 0.0f;
+    float scroll = 0.0f;
+};
+
+class InputRecorder {
+public:
+    ~InputRecorder();
+
+    bool open(const char* path, uint64_t seed);
+    void recordFrame(uint32_t frame, float time, const FrameInput& input);
+    void close();
+    bool isOpen() const { return file.is_open(); }
+
+private:
+    void push(uint32_t frame, float time, uint16_t type, uint16_t key, float x, float y);
+    void flush();
+
+    std::ofstream file;
+    std::vector<InputEvent> pending;
+};
+
+class InputReplayer {
+public:
+    bool open(const char* path);
+    bool nextFrame(FrameInput& out);    // false kada je snimak potrosen
+    bool finished() const { return cursor >= events.size(); }
+    uint64_t getSeed() const { return seed; }
+    size_t frameCount() const { return frames; }
+
+private:
+    std::vector<InputEvent> events;
+    size_t cursor = 0;
+    size_t frames = 0;
+    uint64_t seed = 0;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ========== SISTEM POSLOVA ==========
+// Jedine stalne radne niti u programu, za paralelne petlje nad nezavisnim elementima: poze
+// agenata, plocice softverskog rasterizera, upravljanje guzvom i redove pecenja osvetljenja.
+// parallelFor deli opseg na serije; niti, ukljucujuci onu koja poziva, uzimaju sledecu
+// seriju preko atomicnog brojaca, pa spora serija ne zadrzava ostale. Poziv se vraca kad
+// su sve serije gotove. Niti cekaju na uslovu i bude se novom generacijom posla.
+// Istu instancu koriste i glavna nit i nit simulacije: dok jedna petlja radi, poziv sa druge
+// niti (ili iz tela petlje) izvrsava ceo opseg na niti koja poziva, umesto da ceka.
+
+class JobSystem {
+public:
+    ~JobSystem() { destroy(); }
+
+    // threads = 0 -> hardware_concurrency (ukljucujuci nit koja poziva parallelFor)
+    void init(int threads);
+    void destroy();
+
+    // body(first, last) za serije od najvise batchSize elemenata iz [0, count); jedna
+    // serija (ili bez radnih niti, ili dok je druga petlja u toku) se izvrsava odmah na
+    // niti koja poziva
+    void parallelFor(int count, int batchSize, const std::function<void(int, int)>& body);
+
+    int threadCount() const { return (int)workers.size() + 1; }
+
+private:
+    void workerLoop(uint64_t seen);
+    void runBatches();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable startCondition, doneCondition;
+    uint64_t generation = 0;
+    int busyWorkers = 0;
+    bool quitting = false;
+
+    // Tekuca petlja; vazi dok parallelFor ne vrati
+    const std::function<void(int, int)>* body = nullptr;
+    int count = 0;
+    int batchSize = 1;
+    std::atomic<int> nextBatch{ 0 };
+    std::atomic<bool> dispatching{ false };     // Petlja koristi radne niti
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class JobSystem;
+
+// ========== PECENJE OSVETLJENJA ==========
+// Staticki kvadri (put, kabina) se pri ucitavanju osvetle na CPU-u istim Phong modelom kao
+// basic3d.frag i rezultat se upise u lightmap atlas. Svetlo i kamera su nepomicni (kamera se
+// samo okrece), pa se pece i spekularna komponenta. Opciono se ambijentalni deo mnozi
+// okluzijom racunatom bacanjem zraka kroz sve kvadre, na nitima JobSystem-a.
+// Nema OpenGL poziva - Main salje atlas u teksturu i UV-ove u poseban VBO.
+
+struct BakeLight {
+    glm::vec3 position;
+    glm::vec3 kA, kD, kS;
+};
+
+struct BakeMaterial {
+    glm::vec3 kA, kD, kS;
+    float shine;
+};
+
+struct BakeSettings {
+    glm::vec3 viewPos = glm::vec3(0.0f);
+    float texelsPerUnit = 16.0f;    // Gustina texela, ogranicena sa min/maxResolution po kvadru
+    int minResolution = 4;
+    int maxResolution = 512;
+    int atlasWidth = 2048;
+    int aoRays = 0;                 // 0 = bez ambijentalne okluzije
+    float aoDistance = 1.0f;        // Prepreke dalje od ovoga ne zatamnjuju
+    JobSystem* jobs = nullptr;      // Redovi texela; nullptr = sve na niti koja poziva bake
+};
+
+class LightBaker {
+public:
+    // quadCount TRIANGLE_FAN kvadrata po 4 temena (VERTEX_3D_FLOATS float-ova po temenu);
+    // model prevodi temena u svet kao uM u sejderu. Vraca id mesh-a za lightmapUVs.
+    int addMesh(const float* vertices, int quadCount, const glm::mat4& model,
+                const BakeLight& light, const BakeMaterial& material);
+
+    void bake(const BakeSettings& settings);
+
+    // 2 float-a po temenu (UV u atlasu), istim redom kao temena prosledjena u addMesh
+    const std::vector<float>& lightmapUVs(int mesh) const { return meshes[mesh].uvs; }
+
+    // RGB float po texelu (vrednosti mogu biti > 1)
+    const std::vector<float>& atlas() const { return texels; }
+    int atlasWidth() const { return width; }
+    int atlasHeight() const { return height; }
+
+private:
+    struct Quad {
+        glm::vec3 p[4];
+        glm::vec3 n[4];
+        glm::vec3 boundsMin, boundsMax;
+        int mesh;
+        int resU, resV;
+        int x, y;       // Pocetak plocice u atlasu
+    };
+
+    struct Mesh {
+        BakeLight light;
+        BakeMaterial material;
+        std::vector<float> uvs;
+        int firstQuad, quadCount;
+    };
+
+    void packAtlas(const BakeSettings& settings);
+    void bakeRow(int quadIndex, int row, const BakeSettings& settings);
+    float ambientOcclusion(int quadIndex, const glm::vec3& origin, const glm::vec3& normal, uint64_t seed,
+                           const BakeSettings& settings, std::vector<int>& candidates) const;
+    bool occluded(const std::vector<int>& candidates, const glm::vec3& origin, const glm::vec3& dir, float maxDistance) const;
+
+    std::vector<Quad> quads;
+    std::vector<Mesh> meshes;
+    std::vector<float> texels;
+    int width = 0, height = 0;
+};
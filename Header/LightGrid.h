@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Geometry.h"
+
+// ========== KLASTEROVANA MREZA SVETALA ==========
+// Frustum kamere je podeljen na LIGHT_GRID_X x LIGHT_GRID_Y plocica na ekranu i LIGHT_GRID_Z
+// slojeva po dubini (eksponencijalno, kao perspektiva). Svako svetlo se na CPU-u upise u
+// klastere koje njegova sfera dodiruje, pa fragment sejder obilazi samo listu svog klastera
+// umesto svih svetala. Nema OpenGL poziva - upload radi ClusteredLighting.
+
+const int LIGHT_GRID_X = 16;
+const int LIGHT_GRID_Y = 9;
+const int LIGHT_GRID_Z = 24;
+const int LIGHT_GRID_CLUSTERS = LIGHT_GRID_X * LIGHT_GRID_Y * LIGHT_GRID_Z;
+const int LIGHT_GRID_MAX_PER_CLUSTER = 64;     // Visak svetala u jednom klasteru se odbacuje
+const float LIGHT_GRID_NEAR = 1.0f;            // Sloj 0 je [zNear, LIGHT_GRID_NEAR]
+
+class LightGrid {
+public:
+    // view/fovY/aspect/zNear/zFar moraju biti isti kao za projekciju scene
+    void build(const std::vector<PointLight>& lights, const glm::mat4& view,
+               float fovY, float aspect, float zNear, float zFar);
+
+    // Vidljiva svetla: 8 float-ova po svetlu - (pozicija u svetu, radijus), (boja, 0)
+    const std::vector<float>& lightData() const { return data; }
+    // (pocetak u lightIndices, broj) po klasteru; klaster = (z * Y + y) * X + x
+    const std::vector<uint32_t>& clusterRanges() const { return ranges; }
+    const std::vector<uint32_t>& lightIndices() const { return indices; }
+
+    int visibleLights() const { return (int)(data.size() / 8); }
+    float sliceScale() const { return scale; }     // sloj = 1 + log(d / LIGHT_GRID_NEAR) * scale
+
+private:
+    struct Span {
+        uint32_t light;
+        uint8_t slice, x0, x1, y0, y1;
+    };
+
+    int sliceFor(float depth) const;
+    float sliceNearDepth(int slice, float zNear) const;
+    float sliceFarDepth(int slice) const;
+
+    std::vector<float> data;
+    std::vector<uint32_t> ranges;
+    std::vector<uint32_t> indices;
+    std::vector<uint32_t> counts;
+    std::vector<Span> spans;
+    float scale = 1.0f;
+};
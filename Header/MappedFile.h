@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ========== FAJL MAPIRAN U MEMORIJU ==========
+// Ceo fajl samo za citanje (mmap / MapViewOfFile); podaci se citaju direktno iz kesa
+// stranica, bez kopiranja. Koriste ga citac telemetrije i ucitavanje checkpoint-a.
+
+class MappedFile {
+public:
+    MappedFile() {}
+    ~MappedFile();
+    MappedFile(MappedFile&& other);
+    MappedFile& operator=(MappedFile&& other);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // sequential - fajl se cita redom od pocetka (savet kernelu za read-ahead)
+    bool open(const std::string& path, bool sequential = false);
+    void close();
+    bool isOpen() const { return mapping != nullptr; }
+
+    const uint8_t* data() const { return (const uint8_t*)mapping; }
+    size_t size() const { return mappedBytes; }
+
+private:
+    const void* mapping = nullptr;
+    size_t mappedBytes = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mapHandle = nullptr;
+#endif
+};
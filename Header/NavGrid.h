@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "SeatMap.h"
+
+// ========== NAVIGACIONA MREZA KABINE ==========
+// Pod kabine (x, z) podeljen na celije; sediste zauzima celije ispod svog otiska, pa se
+// oko njega obilazi, a zona za stajanje je prohodna. Granice su obuhvat mesta i ulaza iz
+// rasporeda, sa marginom. Geometrija kabine (zidovi, panel, okvir vrata) se ne upisuje u
+// mrezu: model kabine je samo vozacev deo (z od -0.6 do 0.5), a sva mesta su iza njegovog
+// zadnjeg zida, pa bi taj zid odsekao svaku putanju. Zato margina pored ulaza zalazi i
+// malo van desnog zida (x > 1.0), a zidova putnickog dela nema ni u modelu. Putanje se traze A*-om (8 suseda, bez secenja uglova) i
+// ispravljaju po liniji vidljivosti, pa ostaju samo tacke gde se skrece.
+//
+// build() racuna putanje za sve parove (ulaz, mesto) odjednom; posle toga je path() samo
+// citanje iz tabele. Ponovo se racuna samo kad se raspored promeni (novi build).
+// Bez OpenGL zavisnosti.
+
+const float NAV_CELL_SIZE = 0.05f;
+const float NAV_SEAT_FOOTPRINT = 0.16f;     // Stranica kvadrata sedista (x, z)
+const float NAV_MARGIN = 0.15f;             // Prohodan pojas oko obuhvata rasporeda
+
+class NavGrid {
+public:
+    void build(const SeatLayout& layout, float cellSize = NAV_CELL_SIZE);
+
+    // Tacke od ulaza do mesta: prva je ulaz, poslednja mesto (bar 2 tacke)
+    const std::vector<glm::vec3>& path(int door, int place) const { return paths[door * placeCount + place]; }
+    float pathLength(int door, int place) const { return lengths[door * placeCount + place]; }
+    // Ulaz sa najkracom putanjom do mesta
+    int nearestDoor(int place) const;
+
+    int doorCount() const { return (int)doors.size(); }
+    const glm::vec3& door(int index) const { return doors[index]; }
+    int width() const { return gridW; }
+    int height() const { return gridH; }
+    bool walkable(int x, int z, int place) const;
+
+    // A* od tacke do mesta; false ako mesto nije dostizno (out je tada prava linija)
+    bool findPath(const glm::vec3& from, int place, std::vector<glm::vec3>& out) const;
+
+private:
+    int cellOf(float x, float z) const;
+    glm::vec3 cellCenter(int cell, float y) const;
+    bool lineOfSight(const glm::vec3& a, const glm::vec3& b, int place) const;
+
+    float cellSize = NAV_CELL_SIZE;
+    float invCellSize = 1.0f / NAV_CELL_SIZE;
+    glm::vec2 origin = glm::vec2(0.0f);
+    int gridW = 0, gridH = 0;
+    std::vector<int> owner;             // Po celiji: -1 prohodno, inace indeks sedista
+    std::vector<glm::vec3> places;
+    std::vector<glm::vec3> doors;
+
+    int placeCount = 0;
+    std::vector<std::vector<glm::vec3>> paths;  // door * placeCount + place
+    std::vector<float> lengths;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <glm/glm.hpp>
+
+#include "SkeletalAnimation.h"
+
+struct Passenger {
+    glm::vec3 position;
+    glm::vec3 targetPosition;
+    glm::vec3 finalPosition;
+    float moveSpeed;
+    bool isMoving;
+    int characterModel;
+    bool isInspector;
+    int seatIndex;      // Mesto iz SeatMap-a (-1 = nema mesta)
+    int door;           // Ulaz iz rasporeda; putanja je NavGrid::path(door, seatIndex)
+    int waypointIndex;  // Tacka putanje ka kojoj ide (-1 = ispred vrata, spolja)
+    bool exiting;       // Putanja se prolazi unazad, pa napolje
+
+    // Random boje za putnika
+    glm::vec3 shirtColor;
+    glm::vec3 pantsColor;
+    glm::vec3 hairColor;
+
+    // Klip i pretapanje (SkeletalAnimation.h); napreduje u simulaciji
+    AnimationState animation;
+
+    Passenger() : position(0), targetPosition(0), finalPosition(0), moveSpeed(1.0f),
+                  isMoving(false), characterModel(0), isInspector(false), seatIndex(-1), door(0), waypointIndex(0), exiting(false),
+                  shirtColor(0.3f, 0.5f, 0.8f), pantsColor(0.2f, 0.2f, 0.6f), hairColor(0.2f, 0.15f, 0.1f) {}
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+
+#include "FrameStats.h"
+#include "GLRenderBackend.h"
+#include "GLStats.h"
+
+// ========== OVERLAY PERFORMANSI ==========
+// Panel u gornjem levom uglu: grafik trajanja frejmova, p50/p95/p99/max, CPU vreme
+// simulacije i crtanja, razmera 3D scene (dinamicka rezolucija), GL brojaci frejma (crveno preko budzeta) i pozivi/upload po
+// prolazu. Sve (pozadina, stubici grafika, slova 3x5) su obojeni pravougaonici u jednom
+// baferu, crtani jednim pozivom crtanja kroz basic.frag varijantu sa bojom po temenu
+// (VERTEX_COLOR).
+
+class PerfOverlay {
+public:
+    void init(GLRenderBackend& backend);
+    void destroy(GLRenderBackend& backend);
+
+    // aspect = sirina / visina ekrana; targetFrameMs je linija na grafiku
+    void build(const FrameStats& stats, const GLStats& gl, const GLBudget& budget, float aspect, float targetFrameMs);
+    // Red sa razmerom scene, velicinom viewport-a i GPU vremenom scene (< 0 = nepoznato);
+    // vazi od sledeceg build(). Bez poziva red se ne prikazuje.
+    void setResolution(float scale, int width, int height, float sceneGpuMs);
+    // shader2D: indeks shaders2D u backend-u; vertexColorKey: kljuc varijante sa bojom po temenu.
+    // Temena se citaju pri izvrsavanju liste, pa build() ne sme izmedju.
+    void record(RenderCommandList& list, uint32_t shader2D, uint32_t vertexColorKey);
+
+private:
+    void addRect(float x0, float y0, float x1, float y1, float r, float g, float b, float a);
+    float addText(const char* text, float x, float y, float r, float g, float b);
+
+    uint32_t mesh = RENDER_NONE, buffer = RENDER_NONE;
+    std::vector<float> vertices;    // x, y, u, v, r, g, b, a
+    float pixelW = 0.0f, pixelH = 0.0f;
+    float resolutionScale = -1.0f;
+    int resolutionWidth = 0, resolutionHeight = 0;
+    float sceneGpuMs = -1.0f;
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FrameStats.h"
+#include "GLStats.h"
+#include "GpuMemory.h"
+
+// ========== IZVESTAJ PERFORMANSI ==========
+// Sabira brojace GL poziva svakog frejma (ukupno i po prolazu: prosek i maksimum) i broj
+// frejmova preko budzeta. Kad frejm predje budzet, na konzolu ide upozorenje sa prolazom
+// koji je najvise doprineo; sledece upozorenje za isti budzet tek kad se frejm vrati ispod
+// budzeta, a najcesce jednom u WARN_INTERVAL frejmova. write() upisuje JSON (--perf-report)
+// zajedno sa procenom GPU memorije.
+
+class PerfReport {
+public:
+    GLBudget budget;
+
+    // Poziva se jednom po frejmu, posle izvrsavanja svih lista komandi
+    void addFrame(const GLStats& gl);
+
+    // memory: procena GPU memorije backend-a (trenutno i najvise, po kategoriji)
+    bool write(const char* path, const FrameSummary& frames, const GpuMemory& memory) const;
+
+    uint64_t frameCount() const { return frames; }
+
+private:
+    static const int WARN_INTERVAL = 300;
+
+    struct Totals {
+        uint64_t sum[GL_COUNTER_COUNT] = {};
+        uint64_t max[GL_COUNTER_COUNT] = {};
+        void add(const GLCounters& c);
+    };
+    struct PassTotals {
+        std::string name;
+        uint64_t frames = 0;    // Frejmova u kojima je prolaz postojao
+        Totals totals;
+    };
+
+    // upload = false: prolaz sa najvise poziva crtanja, true: sa najvise poslatih bajtova
+    void warn(const GLStats& gl, const char* text, bool upload);
+
+    Totals frame;
+    std::vector<PassTotals> passes;
+    uint64_t frames = 0;
+    uint64_t drawsOverFrames = 0, uploadOverFrames = 0;
+    bool drawsOver = false, uploadOver = false;
+    int64_t lastDrawsWarning = -WARN_INTERVAL, lastUploadWarning = -WARN_INTERVAL;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+// ========== PCG32 GENERATOR SLUCAJNIH BROJEVA ==========
+// Mali, brz i deterministicki generator (PCG-XSH-RR, 64 bita stanja).
+// Svaka simulacija drzi sopstveni primerak, pa je ista seed vrednost
+// uvek ista sekvenca - nezavisno od rand()/srand() i platforme.
+class Pcg32 {
+public:
+    explicit Pcg32(uint64_t seedValue = 0x853c49e6748fea9bull, uint64_t stream = 0xda3e39cb94b95bdbull) {
+        seed(seedValue, stream);
+    }
+
+    void seed(uint64_t seedValue, uint64_t stream = 0xda3e39cb94b95bdbull) {
+        state = 0u;
+        inc = (stream << 1u) | 1u;
+        next();
+        state += seedValue;
+        next();
+    }
+
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ull + inc;
+        uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = (uint32_t)(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31u));
+    }
+
+    // Ravnomerno u [0, bound) bez pristrasnosti modula
+    uint32_t nextBelow(uint32_t bound) {
+        if (bound == 0) return 0;
+        uint32_t threshold = (0u - bound) % bound;
+        for (;;) {
+            uint32_t r = next();
+            if (r >= threshold) return r % bound;
+        }
+    }
+
+    // Ravnomerno u [0, 1)
+    float nextFloat() {
+        return (next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    float range(float lo, float hi) {
+        return lo + (hi - lo) * nextFloat();
+    }
+
+    uint64_t state;
+    uint64_t inc;
+};
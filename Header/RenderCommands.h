@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// ========== KOMANDE CRTANJA ==========
+// Frejm se ne crta direktno gl* pozivima: kod frejma zapisuje komande (cilj, stanje,
+// program, konstante, mreza, teksture, crtanje) u RenderCommandList, a GLRenderBackend ih
+// izvrsava. Lista ne zna za OpenGL - resursi su indeksi u tabelama backend-a, pa se lista
+// moze snimiti na disk (RenderCapture), izvrsiti ponovo bez simulacije ili pregledati.
+//
+// Konstante (uniforme) se kopiraju u listu. Podaci za updateBuffer/updateTexture se NE
+// kopiraju: pokazivac mora da vazi do izvrsavanja liste (npr. nizovi iz snimka simulacije).
+// Imena uniformi se pamte jednom; reset() ih zadrzava, pa posle prvog frejma nema alokacija.
+
+enum RenderCommandType : uint8_t {
+    RENDER_SET_TARGET,          // a = cilj (0 = ekran); postavlja i viewport na velicinu cilja
+    RENDER_CLEAR,               // boja u values[data..data+3], brise boju, dubinu i stencil
+    RENDER_SET_STATE,           // sub = RenderState, a = ukljuceno
+    RENDER_SET_LINE_WIDTH,      // values[data]
+    RENDER_USE_PIPELINE,        // slot = sejder, a = kljuc varijante
+    RENDER_SET_CONSTANT,        // slot = sejder, sub = RenderConstantType, a = ime, values[data..]
+    RENDER_BIND_MESH,           // a = mreza
+    RENDER_BIND_TEXTURE,        // slot = jedinica, a = tekstura (RENDER_NONE = nulta tekstura)
+    RENDER_UPDATE_BUFFER,       // a = bafer, b = blob
+    RENDER_UPDATE_TEXTURE,      // a = tekstura, b = blob, c = duzina reda u pikselima
+    RENDER_DRAW,                // sub = RenderPrimitive, a = prvo teme, b = broj temena
+    RENDER_DRAW_INDEXED,        // sub = RenderPrimitive, a = prvi indeks, b = broj indeksa, c = base vertex
+    RENDER_DRAW_INSTANCED,      // sub = RenderPrimitive, a = prvo teme, b = broj temena, c = instance
+    RENDER_BEGIN_PASS,          // a = ime; gl pozivi do sledeceg prolaza se broje pod tim imenom (GLStats)
+    RENDER_SET_VIEWPORT,        // a = sirina, b = visina (od donjeg levog ugla tekuceg cilja)
+    RENDER_BLIT,                // a = izvor, b = odrediste, values[data..data+1] = sirina i visina dela izvora
+    RENDER_BEGIN_TIMER,         // a = GPU tajmer
+    RENDER_END_TIMER,           // a = GPU tajmer
+    RENDER_SET_STENCIL          // sub = RenderStencilMode, a = referentna vrednost
+};
+
+enum RenderState : uint8_t {
+    STATE_DEPTH_TEST,
+    STATE_BLEND,
+    STATE_CULL_FACE
+};
+
+enum RenderStencilMode : uint8_t {
+    STENCIL_OFF,
+    STENCIL_WRITE,      // Svaki fragment koji prodje test dubine upisuje ref
+    STENCIL_EQUAL,      // Crta se samo gde je vrednost == ref; stencil se ne menja
+    STENCIL_NOT_EQUAL
+};
+
+enum RenderConstantType : uint8_t {
+    CONSTANT_INT,       // Celi brojevi se cuvaju kao float (jedinice tekstura, dimenzije mreze)
+    CONSTANT_FLOAT,
+    CONSTANT_IVEC3,
+    CONSTANT_VEC2,
+    CONSTANT_VEC3,
+    CONSTANT_MAT4
+};
+
+enum RenderPrimitive : uint8_t {
+    PRIMITIVE_TRIANGLES,
+    PRIMITIVE_TRIANGLE_FAN,
+    PRIMITIVE_LINE_STRIP
+};
+
+// Fiksna velicina, bez pokazivaca - snima se u fajl kakva jeste
+struct RenderCommand {
+    RenderCommandType type;
+    uint8_t sub;
+    uint16_t slot;
+    uint32_t a, b, c;
+    uint32_t data;      // Pocetak u values()
+};
+
+struct RenderBlob {
+    const void* data;
+    size_t bytes;
+};
+
+int constantComponents(RenderConstantType type);
+
+class RenderCommandList {
+public:
+    // Brise komande, vrednosti i blob-ove; tabela imena ostaje
+    void reset();
+
+    // Imenovani deo frejma za brojace GL poziva i budzete ("display", "scene", ...)
+    void beginPass(const char* name);
+    void setTarget(uint32_t target);
+    void clear(const glm::vec4& color);
+    void setState(RenderState state, bool enabled);
+    void setStencil(RenderStencilMode mode, int ref = 1);
+    void setLineWidth(float width);
+    // Crtanje samo u donji levi deo cilja; vazi do sledeceg setTarget
+    void setViewport(int width, int height);
+    // Donji levi deo izvora (width x height) se bilinearno razvlaci preko celog odredista
+    void blit(uint32_t source, int width, int height, uint32_t destination);
+    // Vreme izvrsavanja komandi izmedju begin i end na GPU-u; tajmeri se ne ugnezdavaju
+    void beginTimer(uint32_t timer);
+    void endTimer(uint32_t timer);
+
+    void usePipeline(uint32_t shader, uint32_t variant);
+    void setInt(uint32_t shader, const char* name, int value);
+    void setFloat(uint32_t shader, const char* name, float value);
+    void setIVec3(uint32_t shader, const char* name, int x, int y, int z);
+    void setVec2(uint32_t shader, const char* name, float x, float y);
+    void setVec3(uint32_t shader, const char* name, const glm::vec3& value);
+    void setVec3(uint32_t shader, const char* name, float x, float y, float z) { setVec3(shader, name, glm::vec3(x, y, z)); }
+    void setMat4(uint32_t shader, const char* name, const float* value);
+    void setMat4(uint32_t shader, const char* name, const glm::mat4& value);
+
+    void bindMesh(uint32_t mesh);
+    void bindTexture(uint32_t unit, uint32_t texture);
+    // bytes == 0 ne menja bafer
+    void updateBuffer(uint32_t buffer, const void* data, size_t bytes);
+    // Cela tekstura; rowLength = razmak redova u pikselima (0 = sirina teksture)
+    void updateTexture(uint32_t texture, const void* pixels, size_t bytes, int rowLength);
+
+    void draw(RenderPrimitive primitive, int first, int count);
+    // Indeksi [first, first + count); baseVertex se dodaje svakom indeksu (vise mreza u jednom baferu)
+    void drawIndexed(RenderPrimitive primitive, int count, int first = 0, int baseVertex = 0);
+    void drawInstanced(RenderPrimitive primitive, int first, int count, int instances);
+
+    const std::vector<RenderCommand>& commands() const { return commandList; }
+    const std::vector<float>& values() const { return valueList; }
+    const std::vector<std::string>& names() const { return nameList; }
+    const std::vector<RenderBlob>& blobs() const { return blobList; }
+
+    // Binarni oblik liste (bez resursa); procitani blob-ovi pripadaju listi
+    void write(std::ostream& out) const;
+    bool read(std::istream& in);
+
+private:
+    void push(RenderCommandType type, uint8_t sub, uint16_t slot, uint32_t a, uint32_t b, uint32_t c, uint32_t data);
+    void setConstant(uint32_t shader, const char* name, RenderConstantType type, const float* values);
+    uint32_t nameIndex(const char* name);
+
+    std::vector<RenderCommand> commandList;
+    std::vector<float> valueList;
+    std::vector<RenderBlob> blobList;
+    std::vector<std::string> nameList;
+    std::unordered_map<std::string, uint32_t> nameLookup;
+    std::vector<std::vector<uint8_t>> ownedBlobs;   // Samo posle read()
+};
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// ========== RASPORED MESTA U VOZILU ==========
+enum class PlaceType {
+    Seat,       // Sedece mesto
+    Standing    // Mesto u zoni za stajanje
+};
+
+struct SeatPlace {
+    glm::vec3 position;
+    PlaceType type;
+};
+
+// Opis rasporeda mesta jednog vozila (sedista + zone za stajanje) i ulaza
+struct SeatLayout {
+    std::string name;
+    std::vector<SeatPlace> places;
+    std::vector<glm::vec3> doors;       // Tacka na podu odmah iza praga; spolja je +x
+};
+
+// Dodaje mrezu sedista: rows x cols, pocevsi od origin, razmak spacing (x, z)
+void addSeatRows(SeatLayout& layout, glm::vec3 origin, int rows, int cols, glm::vec2 spacing);
+// Popunjava pravougaonu zonu za stajanje [minXZ, maxXZ] mestima na razmaku spacing
+void addStandingZone(SeatLayout& layout, float y, glm::vec2 minXZ, glm::vec2 maxXZ, float spacing);
+
+SeatLayout makeSoloBusLayout();         // Standardni autobus (52 mesta)
+SeatLayout makeArticulatedBusLayout();  // Zglobni autobus (100+ mesta)
+
+// ========== SEAT MAP ==========
+// Dodela i oslobadjanje mesta u O(1): dvonivoska bitmapa slobodnih mesta
+// (zbirna rec + do 64 reci po 64 bita) i find-first-set nad njima.
+// Sedista imaju prednost, zona za stajanje se koristi tek kad su sva sedista zauzeta.
+class SeatMap {
+public:
+    static const int MAX_PLACES_PER_TYPE = 64 * 64;
+
+    explicit SeatMap(const SeatLayout& layout);
+
+    int acquire();                      // Indeks mesta ili -1 ako je vozilo puno
+    int acquire(PlaceType type);        // Samo mesto odredjenog tipa
+    bool occupy(int place);             // Zauzima bas to mesto (vracanje checkpoint-a); false ako je zauzeto
+    void release(int place);
+    void reset();                       // Oslobadja sva mesta
+
+    bool isFree(int place) const;
+    int capacity() const { return (int)layout.places.size(); }
+    int freeCount() const { return freeSeats.count + freeStanding.count; }
+    const SeatPlace& place(int index) const { return layout.places[index]; }
+    const SeatLayout& getLayout() const { return layout; }
+
+private:
+    struct FreeBits {
+        uint64_t summary = 0;           // Bit w je 1 ako words[w] ima bar jedno slobodno mesto
+        std::vector<uint64_t> words;
+        std::vector<int> slotToPlace;   // Slot u bitmapi -> indeks mesta u rasporedu
+        int count = 0;
+
+        int take();
+        void remove(int slot);
+        void put(int slot);
+    };
+
+    SeatLayout layout;
+    FreeBits freeSeats;
+    FreeBits freeStanding;
+    std::vector<int> placeToSlot;
+};
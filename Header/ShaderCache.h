@@ -0,0 +1,95 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class RenderCommandList;
+
+// ========== VARIJANTE SEJDERA ==========
+// Jedan par izvornih fajlova, vise specijalizovanih programa: bit i kljuca permutacije
+// ukljucuje #define defineNames[i] (preko preambule u compileShader), pa sejder nema grananja
+// po uniformama koje su konstantne za ceo poziv crtanja. Varijante se prevode pri prvom
+// koriscenju; ako drajver podrzava ARB_get_program_binary, prevedeni program se cuva u
+// fajl (binaryCachePrefix + ime + kljuc) i sledece pokretanje ga samo ucita.
+//
+// Uniforme su zajednicke za sve varijante: set* odmah postavlja vezani program, a ostale
+// varijante preuzimaju promene pri sledecem use(). Ista vrednost se ne salje ponovo.
+// Svi programi se vezuju kroz use() (ne direktno glUseProgram), da bi se znalo koji je aktivan.
+
+class ShaderCache {
+public:
+    // binaryCachePrefix moze biti nullptr (bez kesa na disku)
+    void init(const char* vsPath, const char* fsPath, const std::vector<std::string>& defineNames,
+              const char* binaryCachePrefix);
+    void destroy();
+
+    // Vezuje varijantu za kljuc (prevodi je ako jos ne postoji) i vraca program
+    unsigned int use(uint32_t key);
+    // Prevodi varijante unapred (npr. one koje se koriste u prvom frejmu)
+    void warm(const std::vector<uint32_t>& keys);
+
+    void setInt(const char* name, int value);
+    void setFloat(const char* name, float value);
+    void setIVec3(const char* name, int x, int y, int z);
+    void setVec2(const char* name, float x, float y);
+    void setVec3(const char* name, const glm::vec3& value);
+    void setVec3(const char* name, float x, float y, float z) { setVec3(name, glm::vec3(x, y, z)); }
+    void setMat4(const char* name, const float* value);
+    void setMat4(const char* name, const glm::mat4& value);
+
+    // Trenutne vrednosti svih uniformi kao komande za sejder sa datim indeksom (snimak frejma)
+    void recordUniforms(RenderCommandList& list, uint32_t shader) const;
+
+    const std::string& vertexPath() const { return vsPath; }
+    const std::string& fragmentPath() const { return fsPath; }
+    const std::vector<std::string>& defines() const { return defineNames; }
+    int variantCount() const { return (int)variants.size(); }
+    int binaryHits() const { return cacheHits; }
+
+private:
+    enum UniformType { UNIFORM_INT, UNIFORM_FLOAT, UNIFORM_IVEC3, UNIFORM_VEC2, UNIFORM_VEC3, UNIFORM_MAT4 };
+
+    struct Uniform {
+        std::string name;
+        UniformType type;
+        float f[16];
+        int i[3];
+        uint64_t version;
+    };
+
+    struct Variant {
+        uint32_t key;
+        GLuint program;
+        uint64_t syncedVersion;
+        std::vector<GLint> locations;   // Po indeksu uniforme; -2 = jos nije trazena
+    };
+
+    int variantFor(uint32_t key);
+    GLuint build(uint32_t key);
+    GLuint loadBinary(const std::string& path);
+    void saveBinary(const std::string& path, GLuint program);
+    std::string binaryPath(uint32_t key) const;
+
+    Uniform& uniformFor(const char* name, UniformType type);
+    void changed(Uniform& u);
+    void upload(Variant& v, int index);
+
+    std::string vsPath, fsPath;
+    std::vector<std::string> defineNames;
+    std::string cachePrefix;
+    uint64_t sourceHash = 0;
+
+    std::vector<Variant> variants;
+    std::unordered_map<uint32_t, int> variantIndex;
+    int bound = -1;
+    static GLuint activeProgram;    // Poslednji program vezan kroz bilo koji ShaderCache
+
+    std::vector<Uniform> uniforms;
+    std::unordered_map<std::string, int> uniformIndex;
+    uint64_t version = 0;
+    int cacheHits = 0;
+};
@@ -0,0 +1,107 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "BusSimulation.h"
+#include "Checkpoint.h"
+#include "InputQueue.h"
+#include "InputRecorder.h"
+#include "TripleBuffer.h"
+
+// ========== NIT SIMULACIJE ==========
+// Simulacija (autobus, vrata, putnici, guzva), kamera i snimanje/reprodukcija ulaza
+// rade na posebnoj niti fiksnim korakom. Posle svakog koraka nit objavi nepromenljiv
+// SimSnapshot kroz TripleBuffer; nit za crtanje cita samo snimke, pa spor korak
+// simulacije ne kasni prikaz frejma i obrnuto.
+
+struct SimSnapshot {
+    uint32_t frame = 0;
+    double simTime = 0.0;
+    float simCpuMs = 0.0f;          // CPU vreme poslednjeg koraka
+
+    // Autobus i displej
+    int currentStation = 0;
+    int nextStation = 1;
+    float busProgress = 0.0f;
+    bool busAtStation = true;
+    int passengers = 0;
+    int totalFines = 0;
+    bool isInspectorInBus = false;
+
+    // Animacije
+    float doorOffset = 0.4f;
+    float wheelRotation = 0.0f;
+    float busShakeOffset = 0.0f;
+
+    // Instance za crtanje
+    std::vector<Passenger> activePassengers;
+    std::vector<float> crowdInstances;      // 4 float-a po agentu
+    std::vector<float> crowdAnimation;      // 2 float-a po agentu (CrowdSim::writeAnimation)
+    int crowdCount = 0;
+
+    // Kamera i prekidaci prikaza (menjaju se ulazom, pa se i snimaju)
+    glm::vec3 cameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    float fov = 60.0f;
+    bool depthTestEnabled = true;
+    bool faceCullingEnabled = false;
+};
+
+// Stanje simulacije (bez kamere i prekidaca prikaza) u snimak; koriste ga i alati bez niti.
+// Nije const: guzva pri upisu instanci azurira smer agenata.
+void copySimulationState(BusSimulation& sim, SimSnapshot& out);
+
+class SimThread {
+public:
+    SimThread(BusSimulation& sim, float stepSeconds);
+    ~SimThread();
+
+    // recorder/replayer mogu biti nullptr
+    void start(InputRecorder* recorder, InputReplayer* replayer);
+    void stop();
+
+    // Pre start(): periodicni checkpoint posle koraka i kamera/prekidaci iz ucitanog checkpoint-a
+    void setCheckpointWriter(CheckpointWriter* writer) { checkpoints = writer; }
+    void restoreDriver(const CheckpointDriverState& driver);
+
+    // Glavna nit (GLFW callback-ovi) upisuje dogadjaje, nit simulacije ih trosi
+    InputQueue& inputQueue() { return queue; }
+
+    // Nit za crtanje: najnoviji objavljeni snimak (vazi do sledeceg poziva)
+    const SimSnapshot& acquireSnapshot();
+
+private:
+    void run();
+    void collectInput(FrameInput& out, int64_t deadlineNs);
+    void tick(FrameInput input);
+    void applyMouseLook(float xoffset, float yoffset);
+    void applyScroll(float yoffset);
+    void writeSnapshot(SimSnapshot& out, float cpuMs);
+    CheckpointDriverState driverState() const;
+
+    BusSimulation& sim;
+    float stepSeconds;
+    std::thread thread;
+    std::atomic<bool> running{ false };
+
+    // Dogadjaji preuzeti iz reda koji jos nisu primenjeni (samo nit simulacije)
+    InputQueue queue;
+    std::vector<TimedInputEvent> pendingEvents;
+
+    TripleBuffer<SimSnapshot> snapshots;
+
+    // Stanje niti simulacije
+    InputRecorder* recorder = nullptr;
+    InputReplayer* replayer = nullptr;
+    CheckpointWriter* checkpoints = nullptr;
+    bool replayActive = false;
+    uint32_t frame = 0;
+    float yaw = -90.0f, pitch = -5.0f;
+    glm::vec3 cameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    float fov = 60.0f;
+    bool depthTestEnabled = true;
+    bool faceCullingEnabled = false;
+};
@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+class JobSystem;
+
+// ========== SKELETNA ANIMACIJA ==========
+// Humanoid ima 7 kostiju; svaka se okrece oko svog zgloba (pivot u prostoru modela, poza
+// mirovanja nema rotacija), a karlica nosi i vertikalni pomak (sedanje). Klipovi imaju
+// kljuceve na jednakim razmacima; rotacija kljuca je kvantizovan kvaternion (najveca
+// komponenta se izostavlja, ostale tri su int16), pa kljuc kosti zauzima 8 bajtova.
+//
+// Agent (AnimationState) pusta jedan klip i pretapa se iz prethodnog (cross-fade). Stanje
+// putnika napreduje u simulaciji; poze svih agenata se racunaju pri crtanju, paralelno po
+// nitima (JobSystem), u paletu matrica: 3 reda matrice 3x4 po kosti, redom po agentima.
+// Paleta ide u texture buffer (SKINNED varijanta basic3d) ili u SoftRasterizer.
+// Bez OpenGL zavisnosti.
+
+enum HumanoidBone {
+    BONE_PELVIS,            // Koren; nosi i vertikalni pomak
+    BONE_SPINE,             // Trup, savija se u kukovima
+    BONE_HEAD,              // Glava, kosa i kapica
+    BONE_LEFT_ARM,
+    BONE_RIGHT_ARM,
+    BONE_LEFT_LEG,
+    BONE_RIGHT_LEG,
+    HUMANOID_BONES
+};
+
+enum AnimationClipId {
+    CLIP_IDLE,
+    CLIP_WALK,
+    CLIP_SIT_DOWN,          // Prelazi u CLIP_SEATED
+    CLIP_SEATED,
+    CLIP_STAND_UP,          // Prelazi u CLIP_WALK
+    CLIP_CHECK_TICKETS,     // Kontrolor
+    ANIMATION_CLIPS
+};
+
+const float PELVIS_OFFSET_SCALE = 8192.0f;   // int16 -> +-4 jedinice
+const int PALETTE_FLOATS_PER_BONE = 12;     // Redovi matrice 3x4
+const int PALETTE_FLOATS_PER_AGENT = HUMANOID_BONES * PALETTE_FLOATS_PER_BONE;
+
+struct Skeleton {
+    int parent[HUMANOID_BONES];         // -1 za koren; roditelj je uvek pre deteta
+    glm::vec3 pivot[HUMANOID_BONES];    // Zglob u prostoru modela (poza mirovanja)
+};
+
+// Kvaternion sa izostavljenom najvecom komponentom (koja je >= 0 posle promene znaka)
+struct PackedQuat {
+    int16_t v[3];
+    uint16_t largest;
+};
+
+PackedQuat packQuat(const glm::quat& q);
+glm::quat unpackQuat(const PackedQuat& p);
+
+struct AnimationClip {
+    float duration;                     // Sekundi
+    bool loop;
+    int next;                           // Klip koji sledi kad se ovaj zavrsi (-1 = drzi poslednji kljuc)
+    int keyCount;                       // Jednaki razmaci; u petlji posle poslednjeg kljuca ide kljuc 0
+    std::vector<PackedQuat> rotations;  // keyCount * HUMANOID_BONES
+    std::vector<int16_t> pelvisOffset;  // Vertikalni pomak karlice po kljucu, u 1/PELVIS_OFFSET_SCALE
+};
+
+struct AnimationLibrary {
+    AnimationClip clips[ANIMATION_CLIPS];
+};
+
+// Klipovi humanoida; prave se jednom, pri prvom pozivu
+const AnimationLibrary& humanoidAnimations();
+
+struct AnimationState {
+    uint8_t clip = CLIP_IDLE;
+    uint8_t previousClip = CLIP_IDLE;
+    float time = 0.0f;
+    float previousTime = 0.0f;
+    float blend = 1.0f;                 // Udeo tekuceg klipa; 1 = pretapanje zavrseno
+    float fadeSeconds = 0.0f;
+};
+
+// Pretapanje u klip; isti klip se ne pokrece ponovo
+void playClip(AnimationState& state, int clip, float fadeSeconds);
+void advanceAnimation(AnimationState& state, float dt);
+
+struct Pose {
+    glm::quat rotation[HUMANOID_BONES];
+    float pelvisOffset;
+};
+
+void sampleClip(const AnimationClip& clip, float time, Pose& out);
+void evaluatePose(const AnimationState& state, Pose& out);
+// Matrice kostiju (poza mirovanja -> prostor modela) kao 3 reda po kosti
+void poseToPalette(const Skeleton& skeleton, const Pose& pose, float* out);
+
+struct AnimatedAgent {
+    const Skeleton* skeleton;
+    AnimationState state;
+};
+
+// out = PALETTE_FLOATS_PER_AGENT po agentu; jobs == nullptr racuna na niti koja poziva
+void evaluatePalettes(const std::vector<AnimatedAgent>& agents, JobSystem* jobs, std::vector<float>& out);
+
+// Agent guzve: hod pretopljen sa mirovanjem po brzini (walkWeight 0..1)
+AnimationState crowdAnimationState(float walkTime, float walkWeight);
+
+inline glm::mat4 paletteMatrix(const float* rows) {
+    return glm::mat4(rows[0], rows[4], rows[8], 0.0f,
+                     rows[1], rows[5], rows[9], 0.0f,
+                     rows[2], rows[6], rows[10], 0.0f,
+                     rows[3], rows[7], rows[11], 1.0f);
+}
@@ -0,0 +1,157 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "LightBaker.h"
+
+class JobSystem;
+
+// ========== SOFTVERSKI RASTERIZER ==========
+// Crtanje bez GPU-a, sa istim pravilima kao GL putanja: odsecanje u homogenim koordinatama,
+// perspektivno ispravni atributi, depth test LESS, blending SRC_ALPHA / ONE_MINUS_SRC_ALPHA
+// (i za alfa kanal) i Phong iz basic3d.frag. Pozivi crtanja samo obrade temena i zapamte
+// trouglove; flush() ih rasporedi po plocicama 64x64, a plocice se crtaju kroz
+// JobSystem::parallelFor. Plocica se crta redom kojim su trouglovi poslati, pa blending ostaje
+// isti kao u GL-u.
+// Ivicne funkcije se racunaju SSE2 instrukcijama, 4 piksela odjednom.
+// Nema OpenGL poziva - Main salje gotovu sliku u teksturu, alat SoftRender je pise u fajl.
+
+const int SOFT_TILE_SIZE = 64;
+
+// RGBA8 tekstura; red 0 je dole, kao posle stbi__vertical_flip i glTexImage2D
+struct SoftTexture {
+    int width = 0, height = 0;
+    std::vector<uint8_t> rgba;
+
+    // GL_LINEAR + GL_CLAMP_TO_EDGE
+    glm::vec4 sample(float u, float v) const;
+};
+
+// Boja i dubina; red 0 je dole (kao glReadPixels). Sirina i visina bafera su zaokruzene
+// na SOFT_TILE_SIZE, pa plocice nemaju poseban slucaj na ivici.
+struct SoftFramebuffer {
+    int width = 0, height = 0;
+    int stride = 0, rows = 0;
+    std::vector<uint32_t> color;    // R, G, B, A bajtovi redom
+    std::vector<float> depth;
+
+    void resize(int w, int h);
+    // Zbijeni RGBA8 redovi bez zaokruzivanja
+    void readPixels(std::vector<uint8_t>& out) const;
+    void toTexture(SoftTexture& out) const;
+};
+
+// Stanje jednog poziva crtanja - isto sto Main postavlja kroz uniforme i varijantu sejdera
+struct SoftDrawState {
+    glm::mat4 model = glm::mat4(1.0f);     // uM (3D) ili uModel (2D)
+    glm::mat4 viewProjection = glm::mat4(1.0f);
+
+    bool lit = true;                        // basic3d (Phong) ili basic (2D, bez svetla)
+    BakeLight light;
+    BakeMaterial material;
+    glm::vec3 viewPos = glm::vec3(0.0f);
+
+    const SoftTexture* texture = nullptr;   // TEXTURED / 2D tekstura
+    bool transparent = false;               // TRANSPARENT - alfa iz teksture
+    bool customColor = false;               // CUSTOM_COLOR / UNIFORM_COLOR
+    glm::vec3 color = glm::vec3(1.0f);
+    float alpha = 1.0f;                     // uAlpha (2D)
+
+    // SKINNED: kost po temenu (od prvog temena poziva) i paleta agenta (SkeletalAnimation.h);
+    // samo za drawTriangles i drawIndexed
+    const float* bones = nullptr;
+    const float* palette = nullptr;
+
+    bool depthTest = true;
+    bool cullBack = false;
+};
+
+class SoftRasterizer {
+public:
+    // jobs = nullptr -> sve plocice na niti koja poziva flush
+    void init(JobSystem* jobs);
+
+    // Crtanje ide u target do sledeceg begin(); clear se izvrsava po plocicama u flush()
+    void begin(SoftFramebuffer& target);
+    void clear(const glm::vec4& color);
+    void setState(const SoftDrawState& state);
+
+    // 3D temena u rasporedu iz Geometry.h; svaki kvadar je TRIANGLE_FAN od 4 temena
+    void drawQuads(const float* vertices, int firstQuad, int quadCount);
+    // 3D lista trouglova (npr. guzva)
+    void drawTriangles(const float* vertices, int vertexCount);
+    // 3D trouglovi po indeksima; vertices je prvo teme mreze (base vertex)
+    void drawIndexed(const float* vertices, const uint32_t* indices, int indexCount);
+    // 2D temena (x, y, u, v) sa indeksima trouglova
+    void drawIndexed2D(const float* vertices, const unsigned int* indices, int indexCount);
+    // 2D TRIANGLE_FAN tacaka (x, y)
+    void drawFan2D(const float* points, int count);
+    // 2D LINE_STRIP tacaka (x, y), sirina u pikselima kao glLineWidth
+    void drawLineStrip2D(const float* points, int count, float width);
+
+    // Rasterizuje sve poslato od poslednjeg flush()-a
+    void flush();
+
+    int threadCount() const;
+    uint64_t triangleCount() const { return trianglesDrawn; }
+
+private:
+    static const int ATTRIBUTES = 12;      // Pozicija u svetu (3), normala (3), boja (4), UV (2)
+
+    struct ClipVertex {
+        glm::vec4 position;
+        float attr[ATTRIBUTES];
+    };
+
+    // Trougao posle odsecanja, u pikselima; atributi su vec podeljeni sa w, a z, invW i attr
+    // temena 1 i 2 su razlike u odnosu na teme 0
+    struct Triangle {
+        float A[3], B[3], C[3];     // Ivicna funkcija i: A*x + B*y + C, naspram temena i
+        bool topLeft[3];
+        float z[3], invW[3];
+        float attr[3][ATTRIBUTES];
+        float invArea;
+        int minX, minY, maxX, maxY;
+        uint32_t state;
+    };
+
+    void submit(const ClipVertex* v0, const ClipVertex* v1, const ClipVertex* v2);
+    void setup(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c);
+    void processVertex3D(const float* v, const glm::mat4& model, ClipVertex& out) const;
+    glm::mat4 skinnedModel(uint32_t vertex) const;
+    void processVertex2D(float x, float y, float u, float w, ClipVertex& out) const;
+
+    void renderTile(int tile);
+    glm::vec4 shade(const SoftDrawState& state, const float* attr) const;
+
+    SoftFramebuffer* target = nullptr;
+    bool clearPending = false;
+    uint32_t clearColor = 0;
+
+    std::vector<SoftDrawState> states = std::vector<SoftDrawState>(1);
+    std::vector<Triangle> triangles;
+    std::vector<std::vector<uint32_t>> bins;
+    int tilesX = 0, tilesY = 0;
+    uint64_t trianglesDrawn = 0;
+
+    JobSystem* jobs = nullptr;
+};
+
+// ========== SLIKE ==========
+// Binarni PPM (P6); redovi se okrecu, jer je red 0 u baferu dole
+bool writePPM(const std::string& path, int width, int height, const std::vector<uint8_t>& rgba);
+bool readPPM(const std::string& path, int& width, int& height, std::vector<uint8_t>& rgba);
+
+struct ImageDiff {
+    double meanError = 0.0;     // Prosecna apsolutna razlika po kanalu (0-255)
+    int maxError = 0;
+    double badPixels = 0.0;     // Udeo piksela kojima se neki kanal razlikuje vise od praga
+    double maskedPixels = 0.0;  // Udeo piksela preskocenih maskom
+};
+// RGB kanali, slike iste velicine. Pikseli za koje je mask[i] != 0 se preskacu; srednja
+// greska i udeo losih piksela racunaju se samo od poredjenih.
+ImageDiff compareImages(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int pixelCount, int threshold,
+                        const std::vector<uint8_t>* mask = nullptr);
@@ -0,0 +1,85 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "BusScene.h"
+#include "BusSimulation.h"
+#include "Geometry.h"
+#include "HumanoidGenerator.h"
+#include "SimThread.h"
+#include "SkeletalAnimation.h"
+#include "SoftRasterizer.h"
+
+// ========== SOFTVERSKO CRTANJE SCENE ==========
+// Ista scena kao GL putanja u Main-u (put, stanice, guzva, kabina, putnici, 2D displej na
+// kabini i potpis autora), istim redosledom crtanja, kroz SoftRasterizer. Displej se prvo
+// nacrta u svoj 800x600 bafer, pa se koristi kao tekstura kvadra 12 kabine.
+// Razlike u odnosu na GPU: nocna svetla (--night) nisu podrzana, a put i kabina se sencaju po
+// pikselu umesto iz pecenog atlasa (isti Phong, razlika je samo u interpolaciji).
+
+// Vrednosti su iste kao u Main-u
+struct SoftSceneSettings {
+    glm::vec3 cameraPos = glm::vec3(0.0f, 0.0f, 0.15f);
+    glm::vec3 cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    BakeLight light = { glm::vec3(0.0f, 0.4f, 0.0f), glm::vec3(0.6f), glm::vec3(1.0f), glm::vec3(1.0f) };
+    BakeMaterial material = { glm::vec3(0.4f), glm::vec3(0.8f), glm::vec3(0.5f), 32.0f };
+    float zNear = 0.05f, zFar = 1000.0f;
+    float roadLength = 500.0f;
+    float stationDistance = 50.0f;
+    glm::vec4 clearColor = glm::vec4(0.53f, 0.81f, 0.92f, 1.0f);
+};
+
+class SoftwareRenderer {
+public:
+    // Ucitava teksture iz "Resource Files/Textures" i pravi geometriju; plocice i poze agenata
+    // idu kroz jobs (nullptr = sve na niti koja poziva render)
+    bool init(int width, int height, const SoftSceneSettings& settings, JobSystem* jobs);
+    void destroy();
+    bool ready() const { return initialized; }
+
+    void render(const SimSnapshot& snap);
+
+    // Poslednji frejm; red 0 je dole
+    const SoftFramebuffer& frame() const { return framebuffer; }
+    // Pikseli poslednjeg frejma koje pokriva kontrolni panel kabine (1, inace 0), red 0 je
+    // dole. Dva kvadra panela leze u istoj ravni, pa se na GPU-u bore za dubinu i pruge
+    // zavise od formata dubine; poredjenje sa GL snimkom ih preskace.
+    void panelMask(std::vector<uint8_t>& mask);
+    float lastRenderMs() const { return renderMs; }
+    int threadCount() const { return rasterizer.threadCount(); }
+
+private:
+    void renderDisplay(const SimSnapshot& snap);
+    void drawTexture2D(const SoftTexture& texture, float x, float y, float w, float h);
+    void drawCircle2D(float x, float y, float radius, const glm::vec3& color);
+    void setModel(const glm::mat4& model);
+    void evaluateAnimation(const SimSnapshot& snap);
+    // model je world matrica putnika iz BusScene
+    void drawPassenger(const Passenger& p, const glm::mat4& model, const float* palette);
+
+    SoftRasterizer rasterizer;
+    JobSystem* jobs = nullptr;
+    SoftFramebuffer framebuffer, displayFramebuffer, maskFramebuffer;
+    SoftTexture displayTexture;
+    SoftDrawState state;
+    SoftSceneSettings scene;
+    bool initialized = false;
+    float renderMs = 0.0f;
+    glm::mat4 panelModel = glm::mat4(1.0f), panelViewProjection = glm::mat4(1.0f);
+
+    SoftTexture busTexture, controlTexture, doorClosedTexture, doorOpenTexture, authorTexture;
+    SoftTexture passengersLabelTexture, finesLabelTexture;
+    SoftTexture numberTextures[10];
+
+    Station stations[NUM_STATIONS];
+    BusScene busScene;
+    std::vector<float> roadVertices, stationVertices, cabinVertices;
+    std::vector<float> crowdVertices, crowdBones;
+    HumanoidMeshes passengerMeshes;
+    Skeleton crowdSkeleton;
+    std::vector<AnimatedAgent> animatedAgents;
+    std::vector<float> bonePalette;         // Vazi do flush-a (stanja crtanja cuvaju pokazivace)
+    std::vector<float> pathVertices, circleVertices;
+};
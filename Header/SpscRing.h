@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// ========== SPSC PRSTEN ==========
+// Red bez zakljucavanja za tacno jednog proizvodjaca i jednog potrosaca.
+// Kapacitet je stepen dvojke, glava i rep su u posebnim kes linijama
+// da se niti ne bi otimale oko iste linije.
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacityPow2 = 4096)
+        : buffer(capacityPow2), mask(capacityPow2 - 1) {}
+
+    // Proizvodjac. Vraca false ako je red pun (dogadjaj se odbacuje).
+    bool push(const T& value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cachedTail >= buffer.size()) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail >= buffer.size()) return false;
+        }
+        buffer[h & mask] = value;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Potrosac. Prepisuje najvise maxCount elemenata u out, vraca koliko je procitano.
+    size_t popBatch(T* out, size_t maxCount) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t available = head.load(std::memory_order_acquire) - t;
+        size_t n = available < maxCount ? available : maxCount;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = buffer[(t + i) & mask];
+        }
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return buffer.size(); }
+
+private:
+    std::vector<T> buffer;
+    size_t mask;
+
+    alignas(64) std::atomic<size_t> head{ 0 };
+    size_t cachedTail = 0;                      // Samo proizvodjac
+    alignas(64) std::atomic<size_t> tail{ 0 };
+};
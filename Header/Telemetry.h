@@ -0,0 +1,89 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "SpscRing.h"
+
+// ========== TELEMETRIJA ==========
+// Tipizovani binarni dnevnik dogadjaja simulacije. Frame petlja samo upise zapis
+// fiksne velicine u SPSC prsten, a pozadinska nit ga prazni u segmente na disku:
+// <prefiks>_000.ktl, <prefiks>_001.ktl, ... Svaki segment pocinje zaglavljem,
+// pa se moze citati (mapirati u memoriju) nezavisno od ostalih.
+
+enum TelemetryEventType : uint16_t {
+    TELEMETRY_BOARD = 0,            // Usao putnik (value = mesto iz SeatMap-a)
+    TELEMETRY_ALIGHT = 1,           // Krenuo ka izlazu
+    TELEMETRY_DEPART = 2,           // Autobus krenuo (station = sledeca stanica)
+    TELEMETRY_ARRIVE = 3,           // Autobus stigao
+    TELEMETRY_INSPECTOR_BOARD = 4,
+    TELEMETRY_INSPECTOR_EXIT = 5,   // value = broj naplacenih kazni
+    TELEMETRY_INSPECTOR_REJECTED = 6 // Autobus pun, kontrola nije usla
+};
+
+struct TelemetryEvent {
+    double time;            // Vreme simulacije u sekundama
+    uint32_t step;          // Redni broj koraka simulacije
+    uint16_t type;
+    uint16_t station;
+    uint16_t passengers;    // Broj putnika posle dogadjaja
+    uint16_t reserved;
+    int32_t value;
+};
+static_assert(sizeof(TelemetryEvent) == 24, "TelemetryEvent mora biti 24 bajta");
+
+struct TelemetrySegmentHeader {
+    char magic[4];          // "KTEL"
+    uint32_t version;
+    uint32_t segmentIndex;
+    uint32_t recordSize;
+    uint64_t runId;         // Vreme pokretanja upisa; isti za sve segmente jednog dnevnika
+};
+static_assert(sizeof(TelemetrySegmentHeader) == 24, "TelemetrySegmentHeader mora biti 24 bajta");
+
+const uint32_t TELEMETRY_VERSION = 2;
+
+const char* telemetryEventName(uint16_t type);
+std::string telemetrySegmentPath(const std::string& prefix, uint32_t index);
+
+class TelemetryWriter {
+public:
+    TelemetryWriter() : ring(8192) {}
+    ~TelemetryWriter();
+
+    // segmentBytes - velicina posle koje se prelazi na novi segment
+    // maxSegments  - koliko poslednjih segmenata se cuva (0 = svi)
+    bool open(const std::string& prefix, size_t segmentBytes = 4 << 20, uint32_t maxSegments = 0);
+    void close();
+    bool isOpen() const { return running.load(std::memory_order_relaxed); }
+
+    // Poziva se iz niti simulacije. Ne blokira; pun prsten odbacuje zapis.
+    void push(const TelemetryEvent& e) {
+        if (!ring.push(e)) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+    uint64_t writtenCount() const { return written.load(std::memory_order_relaxed); }
+
+private:
+    void writerLoop();
+    bool openSegment(uint32_t index);
+    void writeBatch(const TelemetryEvent* events, size_t count);
+
+    SpscRing<TelemetryEvent> ring;
+    std::thread writer;
+    std::atomic<bool> running{ false };
+    std::atomic<uint64_t> dropped{ 0 };
+    std::atomic<uint64_t> written{ 0 };
+
+    // Stanje pozadinske niti
+    std::string prefix;
+    size_t segmentBytes = 0;
+    uint32_t maxSegments = 0;
+    uint32_t segmentIndex = 0;
+    uint64_t runId = 0;
+    size_t segmentSize = 0;
+    std::ofstream file;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "Telemetry.h"
+
+// ========== CITANJE TELEMETRIJE ==========
+// Segment se mapira u memoriju (mmap / MapViewOfFile), pa se zapisi citaju
+// direktno iz kesa stranica, bez kopiranja i parsiranja.
+
+class TelemetrySegment {
+public:
+    bool open(const std::string& path);
+    void close();
+
+    const TelemetryEvent* events() const { return records; }
+    size_t size() const { return count; }
+    uint32_t index() const { return segmentIndex; }
+    uint64_t run() const { return runId; }
+
+    const TelemetryEvent* begin() const { return records; }
+    const TelemetryEvent* end() const { return records + count; }
+
+private:
+    MappedFile file;
+    const TelemetryEvent* records = nullptr;
+    size_t count = 0;
+    uint32_t segmentIndex = 0;
+    uint64_t runId = 0;
+};
+
+// Svi segmenti jednog dnevnika: <prefiks>_NNN.ktl redom, od prvog postojeceg.
+// Posle rotacije prvi segmenti mogu nedostajati, pa se trazi do maxMissing praznina.
+// Niz se prekida na prvom segmentu drugog pokretanja (runId) ili pogresnog rednog
+// broja - to su ostaci starijeg, duzeg dnevnika sa istim prefiksom.
+class TelemetryLog {
+public:
+    bool open(const std::string& prefix, uint32_t maxMissing = 1024);
+
+    const std::vector<TelemetrySegment>& getSegments() const { return segments; }
+    size_t totalEvents() const;
+
+    template <typename F>
+    void forEach(F&& fn) const {
+        for (const auto& segment : segments) {
+            for (const TelemetryEvent& e : segment) fn(e);
+        }
+    }
+
+private:
+    std::vector<TelemetrySegment> segments;
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <GL/glew.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include "GLRenderBackend.h"
+#include "SpscRing.h"
+
+// ========== STRIMOVANJE TEKSTURA ==========
+// Teksture koje stizu tokom voznje (posteri na stanicama) bez zastoja u frejmu. Slika se
+// dekodira u pozadinskoj niti (stb_image, RGBA), a glavna nit je u update() salje na GPU
+// u trakama redova: traka se kopira u jedan od STREAM_PBO_COUNT pixel buffer objekata
+// (isti PBO-i se koriste stalno), odatle ide glTexSubImage2D, a iza nje fence. U frejmu
+// se salje najvise frameBudget bajtova, pa velika slika stize kroz vise frejmova.
+//
+// Dok poslednja traka ne prodje fence, texture() vraca zamenu (placeholder, siva 1x1),
+// pa se tekstura nikad ne crta poluucitana. Teksture pravi i oslobadja backend (GpuMemory).
+
+const int STREAM_PBO_COUNT = 2;
+const int STREAM_MAX_TEXTURES = 64;
+
+class TextureStreamer {
+public:
+    TextureStreamer() : requests(STREAM_MAX_TEXTURES), decoded(STREAM_MAX_TEXTURES) {}
+    ~TextureStreamer();
+
+    // frameBudget - najvise bajtova poslatih u jednom frejmu (i velicina svakog PBO-a)
+    void init(GLRenderBackend* backend, size_t frameBudget);
+    void destroy();
+
+    // Slika se dekodira u pozadini; vraca rucku ili -1 ako je tabela ili red zahteva pun
+    int request(const std::string& path);
+    // Oslobadja teksturu (i ako jos nije stigla); rucka se posle moze ponovo dobiti
+    void release(int handle);
+
+    // Jednom po frejmu, pre zapisa liste: prima dekodirane slike, proverava fence-ove i
+    // salje sledece trake u okviru budzeta
+    void update();
+
+    // Indeks teksture u backend-u za bindTexture; zamena dok tekstura nije spremna
+    uint32_t texture(int handle) const;
+    bool isReady(int handle) const;
+    uint32_t placeholderTexture() const { return placeholder; }
+
+    uint64_t uploadedBytes() const { return uploaded; }
+    int pendingCount() const;
+
+private:
+    enum EntryState { ENTRY_FREE, ENTRY_DECODING, ENTRY_UPLOADING, ENTRY_READY, ENTRY_FAILED };
+    struct Entry {
+        EntryState state;
+        uint32_t generation;        // Raste pri release, pa se kasni rezultat dekodiranja odbacuje
+        std::string path;
+        int width, height;
+        uint8_t* pixels;            // stbi_load (RGBA, red 0 dole); oslobadja se kad tekstura stigne
+        uint32_t texture;
+        int nextRow;                // Prvi red koji jos nije poslat
+        int stripsInFlight;
+        int frames;                 // Frejmova od prve trake do spremnosti
+    };
+    struct Pbo {
+        GLuint id;
+        size_t bytes;
+        GLsync fence;               // 0 = slobodan
+        int entry;
+        uint32_t generation;
+    };
+    struct DecodeRequest {
+        int entry;
+        uint32_t generation;
+        std::string path;
+    };
+    struct DecodeResult {
+        int entry;
+        uint32_t generation;
+        int width, height;
+        uint8_t* pixels;            // NULL = slika nije ucitana
+    };
+
+    void decoderLoop();
+    void receiveDecoded();
+    void retireStrips();
+    void uploadStrip(Pbo& pbo, Entry& entry, int entryIndex, int rows);
+
+    GLRenderBackend* renderBackend = nullptr;
+    size_t frameBudget = 0;
+    uint32_t placeholder = RENDER_NONE;
+    bool initialized = false;
+
+    Entry entries[STREAM_MAX_TEXTURES] = {};
+    Pbo pbos[STREAM_PBO_COUNT] = {};
+    uint64_t uploaded = 0;
+
+    SpscRing<DecodeRequest> requests;
+    SpscRing<DecodeResult> decoded;
+    std::thread decoder;
+    std::atomic<bool> running{ false };
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+// ========== HIJERARHIJA TRANSFORMACIJA ==========
+// Cvorovi su ravni nizovi u topoloskom redu (roditelj je uvek pre deteta), pa je azuriranje
+// jedan prolaz redom kroz memoriju. setLocal oznacava cvor samo kad se matrica stvarno
+// promeni; update() racuna world = world[roditelj] * local samo za oznacene cvorove i
+// njihove potomke. World matrice su jedan neprekidan niz, pa opseg cvorova moze pravo u
+// instance bafer. Bez OpenGL zavisnosti.
+
+class TransformHierarchy {
+public:
+    void clear();
+    // parent je -1 ili vec dodat cvor; novi cvor je oznacen za prvi update
+    int add(int parent, const glm::mat4& local = glm::mat4(1.0f));
+    void setLocal(int node, const glm::mat4& local);
+    // Vraca broj preracunatih cvorova
+    int update();
+
+    int size() const { return (int)parents.size(); }
+    int parent(int node) const { return parents[node]; }
+    const glm::mat4& local(int node) const { return localMatrices[node]; }
+    const glm::mat4& world(int node) const { return worldMatrices[node]; }
+    // Neprekidan opseg world matrica od cvora first
+    const glm::mat4* worlds(int first) const { return &worldMatrices[first]; }
+    // World matrica se promenila u poslednjem update-u
+    bool changed(int node) const { return changedFlags[node] != 0; }
+    bool anyChanged(int first, int count) const;
+
+private:
+    std::vector<int> parents;
+    std::vector<glm::mat4> localMatrices;
+    std::vector<glm::mat4> worldMatrices;
+    std::vector<uint8_t> dirtyFlags;
+    std::vector<uint8_t> changedFlags;
+};
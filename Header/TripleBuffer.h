@@ -0,0 +1,39 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// ========== TROSTRUKI BAFER ==========
+// Jedan pisac i jedan citalac razmenjuju cele objekte bez zakljucavanja.
+// Pisac uvek ima svoj slot (back), citalac svoj (front), a treci (middle) je
+// poslednji objavljeni. Objava i preuzimanje su jedna atomska zamena indeksa,
+// pa ni spor pisac ni spor citalac nikada ne cekaju jedan drugog.
+template <typename T>
+class TripleBuffer {
+public:
+    // Pisac: slot koji se popunjava pre publish()
+    T& writeBuffer() { return slots[backIndex]; }
+
+    void publish() {
+        uint8_t previous = middle.exchange((uint8_t)(backIndex | DIRTY), std::memory_order_acq_rel);
+        backIndex = previous & INDEX_MASK;
+    }
+
+    // Citalac: preuzima najnoviji objavljeni slot ako postoji. Vraca true ako je nov.
+    bool update() {
+        if ((middle.load(std::memory_order_acquire) & DIRTY) == 0) return false;
+        uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& readBuffer() const { return slots[frontIndex]; }
+
+private:
+    static const uint8_t DIRTY = 0x4;
+    static const uint8_t INDEX_MASK = 0x3;
+
+    T slots[3];
+    uint8_t backIndex = 0;                          // Samo pisac
+    alignas(64) std::atomic<uint8_t> middle{ 1 };
+    alignas(64) uint8_t frontIndex = 2;             // Samo citalac
+};
@@ -3,6 +3,8 @@
 #include <GLFW/glfw3.h>
 #include <string>
 int endProgram(std::string message);
-unsigned int createShader(const char* vsSource, const char* fsSource);
+// defines: preambula ("#define X\n...") koja se ubacuje posle #version linije oba sejdera
+unsigned int compileShader(GLenum type, const char* source, const char* defines = NULL);
+unsigned int createShader(const char* vsSource, const char* fsSource, const char* defines = NULL);
 unsigned loadImageToTexture(const char* filePath);
 GLFWcursor* loadImageToCursor(const char* filePath);
\ No newline at end of file
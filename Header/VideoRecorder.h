@@ -0,0 +1,98 @@
+#pragma once
+#include <GL/glew.h>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GpuMemory.h"
+#include "SpscRing.h"
+
+// ========== SNIMANJE VIDEA ==========
+// Frejmovi se sa ekrana citaju asinhrono: glReadPixels upisuje u jedan od VIDEO_PBO_COUNT
+// pixel buffer objekata (PBO) iza kojeg ide fence, a PBO se mapira tek kad fence prodje,
+// frejm-dva kasnije, pa glavna nit ne ceka GPU. Pozadinska nit kodira pravo iz mapiranog
+// PBO-a i vraca ga; glavna nit ga tada odmapira (GL pozivi su samo na glavnoj niti).
+// Cita se BGRA, jer je to redosled ekrana kod vecine drajvera (bez konverzije pri citanju).
+//
+// Kad nit ne stize (PNG), svi PBO-i ostanu zauzeti i novi frejmovi se odbacuju i broje,
+// umesto da koce crtanje.
+
+enum VideoFormat {
+    VIDEO_Y4M,      // YUV 4:2:0 (BT.601), jedan fajl
+    VIDEO_RAW,      // BGRA bez zaglavlja, redovi odozgo nadole
+    VIDEO_PNG       // Sekvenca putanja_000000.png; broj je redni broj frejma od pocetka snimanja
+};
+
+const int VIDEO_PBO_COUNT = 4;
+
+class VideoRecorder {
+public:
+    VideoRecorder() : ready(8), doneSlots(8) {}
+    ~VideoRecorder();
+
+    // Format po ekstenziji: ".y4m", ".raw", inace PNG. PBO-i se racunaju u memory (baferi).
+    bool open(const std::string& path, int width, int height, int fps, GpuMemory* memory);
+    // Ceka PBO-e u letu i nit, pa ispisuje koliko je frejmova snimljeno i odbaceno
+    void close();
+    bool isOpen() const { return opened; }
+
+    // Posle poslednjeg crtanja u frejmu, pre swap-a; framebuffer je cilj koji se snima
+    void captureFrame(GLuint framebuffer);
+    // Predaje niti PBO-e ciji je fence prosao; captureFrame ga zove sam (i dok je snimanje pauzirano)
+    void poll();
+
+    uint64_t capturedCount() const { return captured; }
+    uint64_t droppedCount() const { return dropped; }
+
+private:
+    enum SlotState { SLOT_FREE, SLOT_READING, SLOT_MAPPED };
+    struct Slot {
+        GLuint pbo;
+        GLsync fence;
+        uint64_t frame;
+        SlotState state;
+    };
+    struct Job {
+        int slot;
+        uint64_t frame;
+        const uint8_t* pixels;      // Mapiran PBO, vazi dok nit ne vrati slot
+    };
+
+    // wait = true: ceka sve fence-ove i da nit vrati sve slotove (zatvaranje)
+    void collect(bool wait);
+    void unmapReturned();
+    void writerLoop();
+    void writeFrame(const Job& job);
+
+    bool opened = false;
+    VideoFormat format = VIDEO_Y4M;
+    std::string path;
+    int width = 0, height = 0;
+    size_t frameBytes = 0;
+    GpuMemory* memory = nullptr;
+
+    // Glavna nit (GL)
+    Slot slots[VIDEO_PBO_COUNT] = {};
+    int next = 0;           // Sledeci slot za citanje
+    int oldestReading = 0;
+    int reading = 0;
+    int mapped = 0;
+    uint64_t frameIndex = 0;
+    uint64_t captured = 0;
+    uint64_t dropped = 0;
+
+    // Mapirani slotovi idu niti kroz ready, a vracaju se kroz doneSlots
+    SpscRing<Job> ready;
+    SpscRing<int> doneSlots;
+    std::thread writer;
+    std::atomic<bool> running{ false };
+
+    // Stanje pozadinske niti
+    std::ofstream file;
+    std::vector<uint8_t> scratch;       // I420 ravni ili filtrirani PNG redovi
+    std::vector<uint8_t> compressed;
+    uint64_t written = 0;
+};
@@ -0,0 +1,14 @@
+#version 330 core
+
+in vec4 channelCol;
+in vec2 channelLightmapUV;
+
+out vec4 outCol;
+
+// Ambient + diffuse + specular iz basic3d.frag, izracunati unapred po texelu
+uniform sampler2D uLightmap;
+
+void main()
+{
+    outCol = vec4(channelCol.rgb * texture(uLightmap, channelLightmapUV).rgb, channelCol.a);
+}
@@ -0,0 +1,20 @@
+#version 330 core
+
+// Staticki kvadri sa pecenim osvetljenjem (LightBaker) - bez normala i Phong racuna
+layout(location = 0) in vec3 inPos;
+layout(location = 1) in vec4 inCol;
+layout(location = 5) in vec2 inLightmapUV;
+
+uniform mat4 uM;
+uniform mat4 uV;
+uniform mat4 uP;
+
+out vec4 channelCol;
+out vec2 channelLightmapUV;
+
+void main()
+{
+    gl_Position = uP * uV * uM * vec4(inPos, 1.0);
+    channelCol = inCol;
+    channelLightmapUV = inLightmapUV;
+}
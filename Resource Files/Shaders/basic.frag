@@ -1,19 +1,26 @@
 #version 330 core
 
 in vec2 chTex;
+in vec4 chCol;
 out vec4 outCol;
 
-uniform sampler2D uTex;
 uniform float uAlpha;
-uniform int uUseColor;
+
+// Izvor boje bira varijanta programa (ShaderCache): UNIFORM_COLOR, VERTEX_COLOR ili tekstura
+#if defined(UNIFORM_COLOR)
 uniform vec3 uColor;
+#elif !defined(VERTEX_COLOR)
+uniform sampler2D uTex;
+#endif
 
 void main()
 {
-	if (uUseColor == 1) {
-		outCol = vec4(uColor, uAlpha);
-	} else {
-		vec4 texColor = texture(uTex, chTex);
-		outCol = vec4(texColor.rgb, texColor.a * uAlpha);
-	}
+#if defined(UNIFORM_COLOR)
+	outCol = vec4(uColor, uAlpha);
+#elif defined(VERTEX_COLOR)
+	outCol = vec4(chCol.rgb, chCol.a * uAlpha);
+#else
+	vec4 texColor = texture(uTex, chTex);
+	outCol = vec4(texColor.rgb, texColor.a * uAlpha);
+#endif
 }
\ No newline at end of file
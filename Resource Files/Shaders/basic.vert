@@ -2,8 +2,10 @@
 
 layout(location = 0) in vec2 inPos;
 layout(location = 1) in vec2 inTex;
+layout(location = 2) in vec4 inCol;	// Boja po temenu (overlay performansi)
 
 out vec2 chTex;
+out vec4 chCol;
 
 uniform mat4 uModel;
 
@@ -11,4 +13,5 @@ void main()
 {
 	gl_Position = uModel * vec4(inPos, 0.0, 1.0);
 	chTex = inTex;
+	chCol = inCol;
 }
\ No newline at end of file
@@ -19,22 +19,68 @@ in vec4 channelCol;
 in vec2 channelTex;
 in vec3 channelNormal;
 in vec3 channelFragPos;
+in float channelViewDepth;
 
 out vec4 outCol;
 
+// Grane po materijalu su #define-ovi varijante (ShaderCache), ne uniforme:
+// TEXTURED, TRANSPARENT, CUSTOM_COLOR, INSPECTOR, CLUSTERED_LIGHTS
+#ifdef TEXTURED
 uniform sampler2D uTex;
-uniform bool useTex;
-uniform bool transparent;
+#endif
 
 // Phong lighting uniforms (strukture)
 uniform Light uLight;
 uniform Material uMaterial;
 uniform vec3 uViewPos;
 
-// Custom uniforms
-uniform int isInspector;
+// Klasterovana svetla (nocna voznja) - liste po klasteru puni LightGrid na CPU-u
+#ifdef CLUSTERED_LIGHTS
+uniform samplerBuffer uLightData;       // 2 texela po svetlu: (pozicija, radijus), (boja, 0)
+uniform usamplerBuffer uLightClusters;  // (pocetak, broj) po klasteru
+uniform usamplerBuffer uLightIndices;
+uniform ivec3 uClusterDims;
+uniform vec2 uClusterTileSize;          // Velicina plocice u pikselima
+uniform float uClusterNear;
+uniform float uClusterSliceScale;
+#endif
+
+#ifdef CUSTOM_COLOR
 uniform vec3 uCustomColor;
-uniform bool useCustomColor;
+#endif
+
+#ifdef CLUSTERED_LIGHTS
+// Zbir difuzne i spekularne komponente svih svetala iz klastera ovog fragmenta
+vec3 clusteredLighting(vec3 norm, vec3 viewDir)
+{
+    ivec2 tile = min(ivec2(gl_FragCoord.xy / uClusterTileSize), uClusterDims.xy - 1);
+    int slice = 0;
+    if (channelViewDepth > uClusterNear) {
+        slice = min(1 + int(log(channelViewDepth / uClusterNear) * uClusterSliceScale), uClusterDims.z - 1);
+    }
+    int cluster = (slice * uClusterDims.y + tile.y) * uClusterDims.x + tile.x;
+    uvec2 range = texelFetch(uLightClusters, cluster).xy;
+
+    vec3 result = vec3(0.0);
+    for (uint i = 0u; i < range.y; i++) {
+        int light = int(texelFetch(uLightIndices, int(range.x + i)).r);
+        vec4 posRadius = texelFetch(uLightData, light * 2);
+        vec3 color = texelFetch(uLightData, light * 2 + 1).rgb;
+
+        vec3 toLight = posRadius.xyz - channelFragPos;
+        float dist2 = dot(toLight, toLight);
+        float falloff = clamp(1.0 - dist2 / (posRadius.w * posRadius.w), 0.0, 1.0);
+        falloff *= falloff;
+        if (falloff <= 0.0) continue;
+
+        vec3 L = toLight * inversesqrt(dist2);
+        float nD = max(dot(norm, L), 0.0);
+        float s = pow(max(dot(viewDir, reflect(-L, norm)), 0.0), uMaterial.shine);
+        result += color * falloff * (nD * uMaterial.kD + s * uMaterial.kS);
+    }
+    return result;
+}
+#endif
 
 void main()
 {
@@ -58,34 +104,33 @@ void main()
     
     // Kombinuj sve komponente (Phong model)
     vec3 lighting = ambient + diffuse + specular;
+#ifdef CLUSTERED_LIGHTS
+    lighting += clusteredLighting(norm, viewDir);
+#endif
     
-    if (!useTex) {
-        vec3 color;
-        
-        // PRVO proveri useCustomColor - ignorise vertex boju potpuno
-        if (useCustomColor) {
-            color = uCustomColor;  // Koristi uniform boju (ignorise vertex boju)
-        } else {
-            color = channelCol.rgb;  // Koristi vertex boju samo ako useCustomColor je false
-        }
-        
-        // Oboji crveno ako je inspektor (override)
-        if (isInspector == 1) {
-            color = mix(color, vec3(1.0, 0.0, 0.0), 0.5);
-        }
-        
-        outCol = vec4(color * lighting, channelCol.a);
-    }
-    else {
-        vec4 texColor = texture(uTex, channelTex);
-        
-        // Ako je transparent mode, koristi alpha kao to je
-        // Ako NIJE transparent, tretiraj sve piksele kao neprozirne
-        if (transparent) {
-            outCol = vec4(texColor.rgb * lighting, texColor.a);
-        } else {
-            // Za non-transparent teksture, ignorii alpha i prikai punu boju
-            outCol = vec4(texColor.rgb * lighting, 1.0);
-        }
-    }
+#ifndef TEXTURED
+    // CUSTOM_COLOR ignorise vertex boju potpuno
+#ifdef CUSTOM_COLOR
+    vec3 color = uCustomColor;
+#else
+    vec3 color = channelCol.rgb;
+#endif
+    
+    // Oboji crveno ako je inspektor (override)
+#ifdef INSPECTOR
+    color = mix(color, vec3(1.0, 0.0, 0.0), 0.5);
+#endif
+    
+    outCol = vec4(color * lighting, channelCol.a);
+#else
+    vec4 texColor = texture(uTex, channelTex);
+    
+    // Ako je transparent mode, koristi alpha kao to je
+    // Ako NIJE transparent, tretiraj sve piksele kao neprozirne
+#ifdef TRANSPARENT
+    outCol = vec4(texColor.rgb * lighting, texColor.a);
+#else
+    outCol = vec4(texColor.rgb * lighting, 1.0);
+#endif
+#endif
 }
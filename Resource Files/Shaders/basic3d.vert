@@ -4,21 +4,56 @@ layout(location = 0) in vec3 inPos;
 layout(location = 1) in vec4 inCol;
 layout(location = 2) in vec2 inTex;
 layout(location = 3) in vec3 inNormal;
+layout(location = 5) in float inBone;       // Kost temena (samo SKINNED)
+layout(location = 6) in mat4 inInstanceModel;   // World matrica instance iz BusScene (samo INSTANCED)
 
 uniform mat4 uM;
 uniform mat4 uV;
 uniform mat4 uP;
 
+#ifdef SKINNED
+uniform samplerBuffer uBones;   // Paleta: 3 texela (redovi matrice 3x4) po kosti
+uniform int uBoneBase;          // Prva kost agenta (ili prve instance)
+uniform int uBonesPerInstance;
+
+mat4 boneMatrix(int bone)
+{
+    vec4 r0 = texelFetch(uBones, bone * 3);
+    vec4 r1 = texelFetch(uBones, bone * 3 + 1);
+    vec4 r2 = texelFetch(uBones, bone * 3 + 2);
+    return mat4(r0.x, r1.x, r2.x, 0.0,
+                r0.y, r1.y, r2.y, 0.0,
+                r0.z, r1.z, r2.z, 0.0,
+                r0.w, r1.w, r2.w, 1.0);
+}
+#endif
+
 out vec4 channelCol;
 out vec2 channelTex;
 out vec3 channelNormal;
 out vec3 channelFragPos;
+out float channelViewDepth;    // Udaljenost od kamere duz pravca gledanja (za klaster svetala)
 
 void main()
 {
-    gl_Position = uP * uV * uM * vec4(inPos, 1.0);
+    mat4 model = uM;
+#ifdef INSTANCED
+    model = uM * inInstanceModel;
+#endif
+#ifdef SKINNED
+    {
+        int bone = uBoneBase + int(inBone + 0.5);
+#ifdef INSTANCED
+        bone += gl_InstanceID * uBonesPerInstance;
+#endif
+        model = model * boneMatrix(bone);
+    }
+#endif
+
+    gl_Position = uP * uV * model * vec4(inPos, 1.0);
     channelCol = inCol;
     channelTex = inTex;
-    channelNormal = mat3(transpose(inverse(uM))) * inNormal;
-    channelFragPos = vec3(uM * vec4(inPos, 1.0));
+    channelNormal = mat3(transpose(inverse(model))) * inNormal;
+    channelFragPos = vec3(model * vec4(inPos, 1.0));
+    channelViewDepth = -(uV * vec4(channelFragPos, 1.0)).z;
 }
@@ -0,0 +1,67 @@
+#include "../Header/BusScene.h"
+
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../Header/Geometry.h"
+
+static const glm::vec3 WHEEL_CENTER = glm::vec3(0.0f, -0.25f, -0.4f);
+
+// ========== CVOROVI ==========
+// Redosled: kabina, volan, vrata, stanice, koren guzve, agenti guzve, putnici (dodaju se po
+// potrebi). Koren guzve je jedinicna matrica - agenti ostaju u prostoru stanice.
+void BusScene::build(int crowdSize) {
+    transforms.clear();
+    passengerNodes.clear();
+
+    cabinNode = transforms.add(-1);
+    wheelNode = transforms.add(cabinNode);
+    doorNode = transforms.add(cabinNode);
+    for (int i = 0; i < VISIBLE_STATIONS; i++) stationNodes[i] = transforms.add(-1);
+
+    int crowdRoot = transforms.add(-1);
+    firstCrowdNode = transforms.size();
+    for (int a = 0; a < crowdSize; a++) transforms.add(crowdRoot);
+    crowdCount = crowdSize;
+}
+
+// ========== AZURIRANJE ==========
+void BusScene::update(const SimSnapshot& snap, float stationDistance) {
+    if (snap.crowdCount != crowdCount) build(snap.crowdCount);
+
+    transforms.setLocal(cabinNode, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, snap.busShakeOffset, 0.0f)));
+
+    glm::mat4 wheel = glm::translate(glm::mat4(1.0f), WHEEL_CENTER);
+    wheel = glm::rotate(wheel, glm::radians(snap.wheelRotation), glm::vec3(0.0f, 0.0f, 1.0f));
+    transforms.setLocal(wheelNode, glm::translate(wheel, -WHEEL_CENTER));
+
+    transforms.setLocal(doorNode, glm::translate(glm::mat4(1.0f), glm::vec3(-snap.doorOffset * 0.3f, 0.0f, snap.doorOffset)));
+
+    float distanceToNextStation = (1.0f - snap.busProgress) * stationDistance;
+    for (int i = 0; i < VISIBLE_STATIONS; i++) {
+        glm::vec3 position(6.0f, 0.0f, -distanceToNextStation - i * stationDistance);
+        transforms.setLocal(stationNodes[i], glm::translate(glm::mat4(1.0f), position));
+    }
+
+    // Rotacija oko Y ose + uniformno skaliranje + translacija (x, y, z, ugao iz CrowdSim-a)
+    for (int a = 0; a < crowdCount; a++) {
+        const float* instance = &snap.crowdInstances[a * 4];
+        float c = std::cos(instance[3]) * CROWD_SCALE;
+        float s = std::sin(instance[3]) * CROWD_SCALE;
+        transforms.setLocal(firstCrowdNode + a, glm::mat4(
+            c, 0.0f, -s, 0.0f,
+            0.0f, CROWD_SCALE, 0.0f, 0.0f,
+            s, 0.0f, c, 0.0f,
+            instance[0], instance[1], instance[2], 1.0f));
+    }
+
+    // Cvorovi putnika se ne brisu kad putnik izadje; visak samo stoji neoznacen
+    while (passengerNodes.size() < snap.activePassengers.size()) passengerNodes.push_back(transforms.add(cabinNode));
+    for (size_t i = 0; i < snap.activePassengers.size(); i++) {
+        transforms.setLocal(passengerNodes[i], passengerModelMatrix(glm::mat4(1.0f), snap.activePassengers[i]));
+    }
+
+    recomputed = transforms.update();
+    crowdDirty = transforms.anyChanged(firstCrowdNode, crowdCount);
+}
@@ -0,0 +1,336 @@
+#include "../Header/BusSimulation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+BusSimulation::BusSimulation(const SeatLayout& layout) : seatMap(layout) {
+    navGrid.build(seatMap.getLayout());
+
+    CrowdParams crowdParams;
+    crowdParams.groundY = -1.2f + 0.3f + 0.28f * CROWD_SCALE;  // Stopala na platformi
+    crowdParams.agentRadius = 0.1f * CROWD_SCALE;
+    stationCrowd = CrowdSim(crowdParams);
+}
+
+void BusSimulation::seed(uint64_t value) {
+    rng.seed(value);
+
+    stationCrowd.clear();
+    stationCrowd.seed(rng.next());
+    stationCrowd.spawn(STATION_CROWD_SIZE);
+}
+
+void BusSimulation::step(float dt, const SimInput& input) {
+    simTime += dt;
+    stepCount++;
+
+    bool isBusMoving = !busAtStation;
+
+    if (isBusMoving) {
+        wheelRotation = (float)sin(simTime * 0.8) * 15.0f;
+        busShakeTime += 0.016f;
+        busShakeOffset = sin(busShakeTime * busShakeSpeed) * busShakeAmplitude;
+    } else {
+        if (wheelRotation > 0.5f) {
+            wheelRotation -= wheelRotationSpeed * 0.5f;
+        } else if (wheelRotation < -0.5f) {
+            wheelRotation += wheelRotationSpeed * 0.5f;
+        } else {
+            wheelRotation = 0.0f;
+        }
+        busShakeOffset = 0.0f;
+        busShakeTime = 0.0f;
+    }
+
+    updateBus(dt, input);
+    updateDoor();
+
+    if (passengerEntering || passengerExiting) {
+        passengerAnimTimer += dt;
+        if (passengerAnimTimer >= passengerAnimDuration) {
+            passengerEntering = false;
+            passengerExiting = false;
+            passengerAnimTimer = 0.0f;
+        }
+    }
+
+    updatePassengers(dt);
+    if (crowdEnabled) {
+        stationCrowd.update(dt);
+    }
+}
+
+// ========== AUTOBUS I STANICE ==========
+void BusSimulation::updateBus(float dt, const SimInput& input) {
+    if (busAtStation) {
+        stationTimer += dt;
+
+        if (input.addPassenger && !passengerEntering && !passengerExiting) {
+            if (passengers < MAX_PASSENGERS && addPassenger(false)) {
+                passengers++;
+                passengerEntering = true;
+                passengerAnimTimer = 0.0f;
+                if (logToConsole) std::cout << "Usao putnik. Ukupno: " << passengers << std::endl;
+                emit(TELEMETRY_BOARD, currentStation, activePassengers.back().seatIndex);
+            }
+        }
+        if (input.removePassenger && !passengerEntering && !passengerExiting) {
+            if (passengers > 0 && removePassenger(false)) {
+                passengers--;
+                passengerExiting = true;
+                passengerAnimTimer = 0.0f;
+                if (logToConsole) std::cout << "Izasao putnik. Ukupno: " << passengers << std::endl;
+                emit(TELEMETRY_ALIGHT, currentStation);
+            }
+        }
+
+        if (input.sendInspector && !isInspectorInBus && !passengerEntering && !passengerExiting) {
+            if (passengers < MAX_PASSENGERS && addPassenger(true)) {
+                isInspectorInBus = true;
+                passengers++;
+                inspectorExitStation = (currentStation + 1) % NUM_STATIONS;
+                passengerEntering = true;
+                passengerAnimTimer = 0.0f;
+                if (logToConsole) std::cout << ">>> KONTROLA USLA U AUTOBUS na stanici " << currentStation << " <<<" << std::endl;
+                emit(TELEMETRY_INSPECTOR_BOARD, currentStation);
+            } else {
+                if (logToConsole) std::cout << ">>> KONTROLA NE MOZE DA UDJE - AUTOBUS JE PUN (50 putnika) <<<" << std::endl;
+                emit(TELEMETRY_INSPECTOR_REJECTED, currentStation);
+            }
+        }
+
+        if (stationTimer >= STATION_WAIT_TIME) {
+            busAtStation = false;
+            stationTimer = 0.0f;
+            busProgress = 0.0f;
+            doorClosing = true;
+            doorOpening = false;
+            if (logToConsole) std::cout << "Autobus krece ka stanici " << nextStation << std::endl;
+            emit(TELEMETRY_DEPART, nextStation);
+        }
+    }
+    else {
+        busProgress += BUS_SPEED * dt;
+        if (busProgress >= 1.0f) {
+            busProgress = 1.0f;
+            busAtStation = true;
+            stationTimer = 0.0f;
+            currentStation = nextStation;
+            nextStation = (currentStation + 1) % NUM_STATIONS;
+            stationsVisited++;
+            if (logToConsole) std::cout << "Autobus stigao na stanicu " << currentStation << std::endl;
+            emit(TELEMETRY_ARRIVE, currentStation);
+
+            doorOpening = true;
+            doorClosing = false;
+
+            if (isInspectorInBus && currentStation == inspectorExitStation) {
+                passengers--;
+                removePassenger(true);
+                int passengersWithoutInspector = passengers;
+                int maxFines = passengersWithoutInspector > 0 ? passengersWithoutInspector : 0;
+                int fines = (maxFines > 0) ? (int)rng.nextBelow(maxFines + 1) : 0;
+                totalFines += fines;
+                if (logToConsole) std::cout << ">>> KONTROLA IZASLA na stanici " << currentStation << "! Naplaceno " << fines << " kazni. Ukupno kazni: " << totalFines << " <<<" << std::endl;
+                emit(TELEMETRY_INSPECTOR_EXIT, currentStation, fines);
+                isInspectorInBus = false;
+                inspectorExitStation = -1;
+            }
+        }
+    }
+}
+
+void BusSimulation::emit(uint16_t type, int station, int32_t value) {
+    if (telemetry == nullptr) return;
+
+    TelemetryEvent e;
+    e.step = stepCount;
+    e.time = simTime;
+    e.type = type;
+    e.station = (uint16_t)station;
+    e.passengers = (uint16_t)passengers;
+    e.reserved = 0;
+    e.value = value;
+    telemetry->push(e);
+}
+
+// ========== AUTOMATSKA ANIMACIJA VRATA ==========
+void BusSimulation::updateDoor() {
+    if (doorOpening) {
+        doorOffset += doorSpeed;
+        if (doorOffset >= doorMaxOffset) {
+            doorOffset = doorMaxOffset;
+            doorOpening = false;
+        }
+    }
+    if (doorClosing) {
+        doorOffset -= doorSpeed;
+        if (doorOffset <= 0.0f) {
+            doorOffset = 0.0f;
+            doorClosing = false;
+        }
+    }
+}
+
+// ========== PUTNICI ==========
+bool BusSimulation::addPassenger(bool isInsp) {
+    // Prvo slobodno mesto iz rasporeda (sedista pa zona za stajanje)
+    int seat = seatMap.acquire();
+    if (seat < 0) {
+        return false;
+    }
+
+    // Ulaz sa najkracom putanjom do mesta; prva tacka putanje je sam ulaz
+    Passenger p;
+    p.seatIndex = seat;
+    p.door = navGrid.nearestDoor(seat);
+    p.finalPosition = seatMap.place(seat).position;
+    p.position = navGrid.door(p.door) + glm::vec3(DOOR_STEP_OUTSIDE, 0.0f, 0.0f);
+    p.waypointIndex = 0;
+    p.targetPosition = waypointPosition(p);
+    
+    p.moveSpeed = 1.2f;
+    p.isMoving = true;
+    p.characterModel = isInsp ? 15 : rng.nextBelow(15);
+    p.isInspector = isInsp;
+    
+    if (isInsp) {
+        p.shirtColor = glm::vec3(0.1f, 0.1f, 0.1f);
+        p.pantsColor = glm::vec3(0.05f, 0.05f, 0.05f);
+    } else {
+        p.shirtColor = glm::vec3(
+            0.2f + rng.nextBelow(80) / 100.0f,
+            0.2f + rng.nextBelow(80) / 100.0f,
+            0.2f + rng.nextBelow(80) / 100.0f
+        );
+        p.pantsColor = glm::vec3(
+            0.1f + rng.nextBelow(50) / 100.0f,
+            0.1f + rng.nextBelow(50) / 100.0f,
+            0.1f + rng.nextBelow(50) / 100.0f
+        );
+        // Random boja kose (braon, crna, plava, crvena)
+        int hairType = rng.nextBelow(4);
+        if (hairType == 0) {
+            p.hairColor = glm::vec3(0.2f, 0.15f, 0.1f);  // Braon
+        } else if (hairType == 1) {
+            p.hairColor = glm::vec3(0.05f, 0.05f, 0.05f);  // Crna
+        } else if (hairType == 2) {
+            p.hairColor = glm::vec3(0.9f, 0.85f, 0.5f);  // Plava
+        } else {
+            p.hairColor = glm::vec3(0.4f, 0.1f, 0.05f);  // Crvena
+        }
+    }
+    
+    activePassengers.push_back(p);
+    return true;
+}
+
+bool BusSimulation::removePassenger(bool removeInspector) {
+    if (activePassengers.empty()) return false;
+    
+    int removeIdx = -1;
+    
+    if (removeInspector) {
+        for (size_t i = 0; i < activePassengers.size(); i++) {
+            if (activePassengers[i].isInspector) {
+                removeIdx = (int)i;
+                break;
+            }
+        }
+    } else {
+        // Poslednji putnik koji jos nije krenuo ka izlazu (kontrolor izlazi sam)
+        for (int i = (int)activePassengers.size() - 1; i >= 0; i--) {
+            if (!activePassengers[i].isInspector && !activePassengers[i].exiting) {
+                removeIdx = i;
+                break;
+            }
+        }
+    }
+    
+    if (removeIdx < 0) return false;
+
+    // Putnik koji jos ulazi se okrece ka prethodnoj tacki; onaj na mestu krece od njega
+    Passenger& p = activePassengers[removeIdx];
+    if (p.isMoving) p.waypointIndex--;
+    p.exiting = true;
+    p.isMoving = true;
+    p.targetPosition = waypointPosition(p);
+    return true;
+}
+
+glm::vec3 BusSimulation::waypointPosition(const Passenger& p) const {
+    if (p.waypointIndex < 0) return navGrid.door(p.door) + glm::vec3(DOOR_STEP_OUTSIDE, 0.0f, 0.0f);
+    return navGrid.path(p.door, p.seatIndex)[p.waypointIndex];
+}
+
+// Klip po stanju putnika; sedanje i ustajanje su prelazi izmedju hoda i sedenja
+static void updatePassengerAnimation(Passenger& p, float dt) {
+    AnimationState& anim = p.animation;
+    if (p.isMoving) {
+        if (anim.clip == CLIP_SEATED || anim.clip == CLIP_SIT_DOWN) {
+            playClip(anim, CLIP_STAND_UP, 0.15f);
+        } else if (anim.clip != CLIP_STAND_UP) {
+            playClip(anim, CLIP_WALK, 0.2f);
+        }
+    } else if (p.isInspector) {
+        playClip(anim, CLIP_CHECK_TICKETS, 0.3f);
+    } else if (anim.clip != CLIP_SEATED) {
+        playClip(anim, CLIP_SIT_DOWN, 0.2f);
+    }
+    advanceAnimation(anim, dt);
+}
+
+// Putanja od ulaza do mesta je iz NavGrid kesa (samo citanje iz tabele); stepenik izmedju
+// ulaza i tacke ispred vrata se prelazi sporije. Putnik koji je izasao oslobadja mesto i
+// ostaje oznacen (exiting, ne krece se), pa se niz sazima jednom na kraju prolaza; redosled
+// ostaje isti, jer od indeksa putnika zavise paleta kostiju i removePassenger.
+void BusSimulation::updatePassengers(float dt) {
+    bool anyFinished = false;
+    for (Passenger& p : activePassengers) {
+        if (p.isMoving) {
+            glm::vec3 direction = p.targetPosition - p.position;
+            float distance = glm::length(direction);
+            
+            if (distance < 0.05f) {
+                // Stigao do trenutne tacke putanje
+                p.position = p.targetPosition;
+                int lastWaypoint = (int)navGrid.path(p.door, p.seatIndex).size() - 1;
+                
+                if (!p.exiting) {
+                    // ULAZAK U AUTOBUS
+                    if (p.waypointIndex >= lastWaypoint) {
+                        p.isMoving = false;
+                    } else {
+                        p.waypointIndex++;
+                        p.targetPosition = waypointPosition(p);
+                    }
+                } else {
+                    // IZLAZAK IZ AUTOBUSA
+                    if (p.waypointIndex < 0) {
+                        seatMap.release(p.seatIndex);
+                        p.isMoving = false;
+                        anyFinished = true;
+                        continue;
+                    }
+                    p.waypointIndex--;
+                    p.targetPosition = waypointPosition(p);
+                }
+            } else {
+                glm::vec3 moveDir = direction / distance;
+                
+                if (p.waypointIndex <= 0) {
+                    p.position += moveDir * (p.moveSpeed * 0.7f) * dt; 
+                } else {
+                    p.position += moveDir * p.moveSpeed * dt; 
+                }
+            }
+        }
+        updatePassengerAnimation(p, dt);
+    }
+
+    if (!anyFinished) return;
+    activePassengers.erase(std::remove_if(activePassengers.begin(), activePassengers.end(),
+                                          [](const Passenger& p) { return p.exiting && !p.isMoving; }),
+                           activePassengers.end());
+}
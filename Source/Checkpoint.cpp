@@ -0,0 +1,330 @@
+#include "../Header/Checkpoint.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<Passenger>::value, "Passenger se upisuje kao sirovi niz bajtova");
+
+static const char CHECKPOINT_MAGIC[4] = { 'K', 'C', 'H', 'K' };
+static const size_t CHECKPOINT_ALIGNMENT = 16;
+
+static size_t alignSection(size_t offset) {
+    return (offset + CHECKPOINT_ALIGNMENT - 1) & ~(CHECKPOINT_ALIGNMENT - 1);
+}
+
+static bool hostIsLittleEndian() {
+    uint16_t probe = 1;
+    uint8_t first;
+    memcpy(&first, &probe, 1);
+    return first == 1;
+}
+
+// ========== UPIS ==========
+bool writeCheckpoint(const BusSimulation& sim, const CheckpointDriverState& driver, std::vector<uint8_t>& out) {
+    if (!hostIsLittleEndian()) return false;
+
+    size_t sizes[CHECKPOINT_SECTION_COUNT];
+    sizes[CHECKPOINT_BUS] = sizeof(CheckpointBusState);
+    sizes[CHECKPOINT_PASSENGERS] = sim.activePassengers.size() * sizeof(Passenger);
+    sizes[CHECKPOINT_CROWD] = CrowdSim::stateBytes(sim.stationCrowd.size());
+    sizes[CHECKPOINT_DRIVER] = sizeof(CheckpointDriverState);
+
+    CheckpointHeader header;
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    header.version = CHECKPOINT_VERSION;
+    header.passengerSize = sizeof(Passenger);
+    header.placeCount = (uint32_t)sim.seatMap.capacity();
+    header.doorCount = (uint32_t)sim.navGrid.doorCount();
+    header.reserved = 0;
+    size_t offset = alignSection(sizeof(CheckpointHeader));
+    for (uint32_t s = 0; s < CHECKPOINT_SECTION_COUNT; s++) {
+        header.sections[s].offset = offset;
+        header.sections[s].bytes = sizes[s];
+        offset = alignSection(offset + sizes[s]);
+    }
+    header.totalBytes = offset;
+
+    // Praznine izmedju sekcija su nule
+    out.assign(offset, 0);
+    memcpy(out.data(), &header, sizeof(header));
+
+    CheckpointBusState bus;
+    memset(&bus, 0, sizeof(bus));
+    bus.simTime = sim.simTime;
+    bus.rngState = sim.rng.state;
+    bus.rngInc = sim.rng.inc;
+    bus.stepCount = sim.stepCount;
+    bus.currentStation = sim.currentStation;
+    bus.nextStation = sim.nextStation;
+    bus.stationsVisited = sim.stationsVisited;
+    bus.passengers = sim.passengers;
+    bus.totalFines = sim.totalFines;
+    bus.inspectorExitStation = sim.inspectorExitStation;
+    bus.busProgress = sim.busProgress;
+    bus.stationTimer = sim.stationTimer;
+    bus.passengerAnimTimer = sim.passengerAnimTimer;
+    bus.doorOffset = sim.doorOffset;
+    bus.wheelRotation = sim.wheelRotation;
+    bus.busShakeOffset = sim.busShakeOffset;
+    bus.busShakeTime = sim.busShakeTime;
+    bus.busAtStation = sim.busAtStation;
+    bus.isInspectorInBus = sim.isInspectorInBus;
+    bus.passengerEntering = sim.passengerEntering;
+    bus.passengerExiting = sim.passengerExiting;
+    bus.doorOpening = sim.doorOpening;
+    bus.doorClosing = sim.doorClosing;
+    bus.crowdEnabled = sim.crowdEnabled;
+    memcpy(out.data() + header.sections[CHECKPOINT_BUS].offset, &bus, sizeof(bus));
+
+    if (!sim.activePassengers.empty()) {
+        memcpy(out.data() + header.sections[CHECKPOINT_PASSENGERS].offset, sim.activePassengers.data(), sizes[CHECKPOINT_PASSENGERS]);
+    }
+    sim.stationCrowd.writeState(out.data() + header.sections[CHECKPOINT_CROWD].offset);
+    memcpy(out.data() + header.sections[CHECKPOINT_DRIVER].offset, &driver, sizeof(driver));
+    return true;
+}
+
+// ========== CITANJE ==========
+bool CheckpointFile::open(const std::string& checkpointPath) {
+    close();
+    path = checkpointPath;
+    if (!hostIsLittleEndian()) {
+        std::cout << "Checkpoint: format je little-endian, ova masina nije podrzana" << std::endl;
+        return false;
+    }
+    if (!file.open(path) || file.size() < sizeof(CheckpointHeader)) {
+        std::cout << "Checkpoint: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        close();
+        return false;
+    }
+
+    const CheckpointHeader& h = header();
+    if (memcmp(h.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0 || h.version != CHECKPOINT_VERSION) {
+        std::cout << "Checkpoint: \"" << path << "\" nije checkpoint verzije " << CHECKPOINT_VERSION << "!" << std::endl;
+        close();
+        return false;
+    }
+    if (h.passengerSize != sizeof(Passenger)) {
+        std::cout << "Checkpoint: \"" << path << "\" je iz drugog build-a (Passenger " << h.passengerSize
+                  << " umesto " << sizeof(Passenger) << " bajtova)" << std::endl;
+        close();
+        return false;
+    }
+
+    // Svaka sekcija mora biti poravnata i cela unutar fajla
+    bool valid = h.totalBytes <= file.size();
+    for (uint32_t s = 0; s < CHECKPOINT_SECTION_COUNT && valid; s++) {
+        const CheckpointSection& section = h.sections[s];
+        valid = section.offset % CHECKPOINT_ALIGNMENT == 0 && section.offset <= h.totalBytes &&
+                section.bytes <= h.totalBytes - section.offset;
+    }
+    valid = valid && h.sections[CHECKPOINT_BUS].bytes == sizeof(CheckpointBusState) &&
+            h.sections[CHECKPOINT_DRIVER].bytes == sizeof(CheckpointDriverState) &&
+            h.sections[CHECKPOINT_PASSENGERS].bytes % sizeof(Passenger) == 0;
+    if (!valid) {
+        std::cout << "Checkpoint: \"" << path << "\" je ostecen ili nepotpun!" << std::endl;
+        close();
+        return false;
+    }
+
+    // Pomeraji u pokazivace
+    const uint8_t* base = file.data();
+    busState = (const CheckpointBusState*)(base + h.sections[CHECKPOINT_BUS].offset);
+    passengerData = (const Passenger*)(base + h.sections[CHECKPOINT_PASSENGERS].offset);
+    passengerTotal = (size_t)(h.sections[CHECKPOINT_PASSENGERS].bytes / sizeof(Passenger));
+    crowdData = base + h.sections[CHECKPOINT_CROWD].offset;
+    crowdBytes = (size_t)h.sections[CHECKPOINT_CROWD].bytes;
+    driverState = (const CheckpointDriverState*)(base + h.sections[CHECKPOINT_DRIVER].offset);
+    return true;
+}
+
+void CheckpointFile::close() {
+    file.close();
+    busState = nullptr;
+    passengerData = nullptr;
+    passengerTotal = 0;
+    crowdData = nullptr;
+    crowdBytes = 0;
+    driverState = nullptr;
+}
+
+bool CheckpointFile::restore(BusSimulation& sim, CheckpointDriverState* driver) const {
+    if (!file.isOpen()) return false;
+
+    const CheckpointHeader& h = header();
+    if (h.placeCount != (uint32_t)sim.seatMap.capacity() || h.doorCount != (uint32_t)sim.navGrid.doorCount()) {
+        std::cout << "Checkpoint: \"" << path << "\" je za drugi raspored (" << h.placeCount << " mesta, "
+                  << h.doorCount << " ulaza)" << std::endl;
+        return false;
+    }
+
+    // Stanice indeksiraju niz stanica pri crtanju
+    const CheckpointBusState& bus = *busState;
+    if (bus.currentStation < 0 || bus.currentStation >= NUM_STATIONS ||
+        bus.nextStation < 0 || bus.nextStation >= NUM_STATIONS) {
+        std::cout << "Checkpoint: stanica u \"" << path << "\" nije ispravna!" << std::endl;
+        return false;
+    }
+
+    // Putnici moraju pokazivati na postojece putanje i klipove i zauzimati razlicita mesta
+    std::vector<uint8_t> taken(sim.seatMap.capacity(), 0);
+    for (size_t i = 0; i < passengerTotal; i++) {
+        const Passenger& p = passengerData[i];
+        bool valid = p.seatIndex >= 0 && p.seatIndex < sim.seatMap.capacity() && !taken[p.seatIndex] &&
+                     p.door >= 0 && p.door < sim.navGrid.doorCount() && p.waypointIndex >= -1 &&
+                     p.waypointIndex < (int)sim.navGrid.path(p.door, p.seatIndex).size() &&
+                     p.animation.clip < ANIMATION_CLIPS && p.animation.previousClip < ANIMATION_CLIPS;
+        if (!valid) {
+            std::cout << "Checkpoint: putnik " << i << " u \"" << path << "\" nije ispravan!" << std::endl;
+            return false;
+        }
+        taken[p.seatIndex] = 1;
+    }
+
+    // Guzva proverava velicinu pre nego sto bilo sta promeni
+    if (!sim.stationCrowd.readState(crowdData, crowdBytes)) {
+        std::cout << "Checkpoint: guzva u \"" << path << "\" nije ispravna!" << std::endl;
+        return false;
+    }
+
+    sim.simTime = bus.simTime;
+    sim.rng.state = bus.rngState;
+    sim.rng.inc = bus.rngInc;
+    sim.stepCount = bus.stepCount;
+    sim.currentStation = bus.currentStation;
+    sim.nextStation = bus.nextStation;
+    sim.stationsVisited = bus.stationsVisited;
+    sim.passengers = bus.passengers;
+    sim.totalFines = bus.totalFines;
+    sim.inspectorExitStation = bus.inspectorExitStation;
+    sim.busProgress = bus.busProgress;
+    sim.stationTimer = bus.stationTimer;
+    sim.passengerAnimTimer = bus.passengerAnimTimer;
+    sim.doorOffset = bus.doorOffset;
+    sim.wheelRotation = bus.wheelRotation;
+    sim.busShakeOffset = bus.busShakeOffset;
+    sim.busShakeTime = bus.busShakeTime;
+    sim.busAtStation = bus.busAtStation != 0;
+    sim.isInspectorInBus = bus.isInspectorInBus != 0;
+    sim.passengerEntering = bus.passengerEntering != 0;
+    sim.passengerExiting = bus.passengerExiting != 0;
+    sim.doorOpening = bus.doorOpening != 0;
+    sim.doorClosing = bus.doorClosing != 0;
+    sim.crowdEnabled = bus.crowdEnabled != 0;
+
+    // Putnici jednim kopiranjem; zauzeta mesta su tacno mesta putnika
+    sim.activePassengers.assign(passengerData, passengerData + passengerTotal);
+    sim.seatMap.reset();
+    for (const Passenger& p : sim.activePassengers) sim.seatMap.occupy(p.seatIndex);
+
+    if (driver != nullptr) *driver = *driverState;
+    return true;
+}
+
+// ========== FAJL ==========
+static bool writeFileAtomically(const std::string& path, const std::vector<uint8_t>& data) {
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write((const char*)data.data(), data.size());
+        if (!file.good()) return false;
+    }
+    // Na Windows-u rename ne prepisuje postojeci fajl
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(path.c_str());
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0) return false;
+    }
+    return true;
+}
+
+bool saveCheckpoint(const std::string& path, const BusSimulation& sim, const CheckpointDriverState& driver) {
+    std::vector<uint8_t> data;
+    if (!writeCheckpoint(sim, driver, data)) {
+        std::cout << "Checkpoint: format je little-endian, ova masina nije podrzana" << std::endl;
+        return false;
+    }
+    if (!writeFileAtomically(path, data)) {
+        std::cout << "Checkpoint: ne mogu da upisem \"" << path << "\"!" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool loadCheckpoint(const std::string& path, BusSimulation& sim, CheckpointDriverState* driver) {
+    CheckpointFile file;
+    return file.open(path) && file.restore(sim, driver);
+}
+
+// ========== PERIODICNI CHECKPOINT ==========
+CheckpointWriter::~CheckpointWriter() {
+    close();
+}
+
+bool CheckpointWriter::open(const std::string& checkpointPath, double intervalSeconds) {
+    close();
+    if (!hostIsLittleEndian()) {
+        std::cout << "Checkpoint: format je little-endian, ova masina nije podrzana" << std::endl;
+        return false;
+    }
+    path = checkpointPath;
+    interval = intervalSeconds > 0.0 ? intervalSeconds : 60.0;
+    nextTime = -1.0;
+    busy = false;
+    quitting = false;
+    opened = true;
+    writer = std::thread(&CheckpointWriter::writerLoop, this);
+    return true;
+}
+
+void CheckpointWriter::close() {
+    if (!opened) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quitting = true;
+    }
+    wake.notify_one();
+    writer.join();
+    opened = false;
+}
+
+void CheckpointWriter::update(const BusSimulation& sim, const CheckpointDriverState& driver) {
+    if (!opened) return;
+    if (nextTime < 0.0) nextTime = sim.simTime + interval;
+    if (sim.simTime < nextTime) return;
+    nextTime += interval;
+    if (nextTime <= sim.simTime) nextTime = sim.simTime + interval;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (busy) {
+            skipped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    writeCheckpoint(sim, driver, buffer);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        busy = true;
+    }
+    wake.notify_one();
+}
+
+// Zahtev koji je stigao pre close() se jos upise
+void CheckpointWriter::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [&]() { return busy || quitting; });
+        if (!busy) break;
+
+        lock.unlock();
+        bool ok = writeFileAtomically(path, buffer);
+        lock.lock();
+        busy = false;
+        if (ok) written.fetch_add(1, std::memory_order_relaxed);
+        else std::cout << "Checkpoint: ne mogu da upisem \"" << path << "\"!" << std::endl;
+    }
+}
@@ -0,0 +1,45 @@
+#include "../Header/ClusteredLighting.h"
+
+// ========== GL RESURSI ==========
+void ClusteredLighting::createBuffer(GLRenderBackend& backend, TextureBuffer& tb, GLenum format) {
+    // Prazan TBO nije dozvoljen, pocetni sadrzaj je jedan nulti element
+    const float zero[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    tb.buffer = backend.createBuffer(zero, sizeof(zero), BUFFER_STREAM);
+    tb.texture = backend.createBufferTexture(tb.buffer, format);
+}
+
+void ClusteredLighting::init(GLRenderBackend& backend) {
+    createBuffer(backend, lightData, GL_RGBA32F);
+    createBuffer(backend, clusterRanges, GL_RG32UI);
+    createBuffer(backend, lightIndices, GL_R32UI);
+}
+
+void ClusteredLighting::destroy(GLRenderBackend& backend) {
+    for (TextureBuffer* tb : { &lightData, &clusterRanges, &lightIndices }) {
+        if (tb->texture != RENDER_NONE) backend.releaseTexture(tb->texture);
+        if (tb->buffer != RENDER_NONE) backend.releaseBuffer(tb->buffer);
+        *tb = TextureBuffer();
+    }
+}
+
+// ========== SVAKI FREJM ==========
+void ClusteredLighting::record(RenderCommandList& list, uint32_t shader3D, int viewportWidth, int viewportHeight, const LightGrid& grid) {
+    // Prazna lista ne menja bafer - ostaje prethodni sadrzaj, sejder ga ne cita (broj je 0)
+    list.updateBuffer(lightData.buffer, grid.lightData().data(), grid.lightData().size() * sizeof(float));
+    list.updateBuffer(clusterRanges.buffer, grid.clusterRanges().data(), grid.clusterRanges().size() * sizeof(uint32_t));
+    list.updateBuffer(lightIndices.buffer, grid.lightIndices().data(), grid.lightIndices().size() * sizeof(uint32_t));
+
+    const TextureBuffer* all[3] = { &lightData, &clusterRanges, &lightIndices };
+    for (int i = 0; i < 3; i++) {
+        list.bindTexture(FIRST_TEXTURE_UNIT + i, all[i]->texture);
+    }
+
+    // Sampler-i razlicitih tipova ne smeju deliti jedinicu sa uTex (TEXTURED varijanta)
+    list.setInt(shader3D, "uLightData", FIRST_TEXTURE_UNIT);
+    list.setInt(shader3D, "uLightClusters", FIRST_TEXTURE_UNIT + 1);
+    list.setInt(shader3D, "uLightIndices", FIRST_TEXTURE_UNIT + 2);
+    list.setIVec3(shader3D, "uClusterDims", LIGHT_GRID_X, LIGHT_GRID_Y, LIGHT_GRID_Z);
+    list.setVec2(shader3D, "uClusterTileSize", (float)viewportWidth / LIGHT_GRID_X, (float)viewportHeight / LIGHT_GRID_Y);
+    list.setFloat(shader3D, "uClusterNear", LIGHT_GRID_NEAR);
+    list.setFloat(shader3D, "uClusterSliceScale", grid.sliceScale());
+}
@@ -0,0 +1,370 @@
+#include "../Header/CrowdSim.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "../Header/JobSystem.h"
+
+// Kerneli mnoze i sabiraju odvojeno (bez FMA), pa je zaokruzivanje isto u AVX2, SSE2 i
+// skalarnoj putanji i stanje guzve (checkpoint) ne zavisi od toga sa cim je build preveden
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CROWD_SIMD_WIDTH 8
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CROWD_SIMD_WIDTH 4
+#else
+#define CROWD_SIMD_WIDTH 1
+#endif
+
+CrowdSim::CrowdSim(const CrowdParams& params) : params(params) {
+    // Celija je velika kao precnik interakcije, pa je dovoljno pretraziti 3x3 celije
+    cellSize = params.agentRadius * 2.0f;
+    invCellSize = 1.0f / cellSize;
+
+    gridW = std::max(1, (int)std::ceil((params.areaMax.x - params.areaMin.x) * invCellSize));
+    gridH = std::max(1, (int)std::ceil((params.areaMax.y - params.areaMin.y) * invCellSize));
+    cellStart.assign(gridW * gridH + 1, 0);
+    cellCursor.assign(gridW * gridH, 0);
+}
+
+void CrowdSim::clear() {
+    posX.clear(); posZ.clear();
+    velX.clear(); velZ.clear();
+    goalX.clear(); goalZ.clear();
+    steerX.clear(); steerZ.clear();
+    heading.clear();
+    walkTime.clear();
+    needsGoal.clear();
+    agentCell.clear();
+    order.clear();
+}
+
+void CrowdSim::spawnArrays(int total) {
+    posX.resize(total); posZ.resize(total);
+    velX.resize(total, 0.0f); velZ.resize(total, 0.0f);
+    goalX.resize(total); goalZ.resize(total);
+    steerX.resize(total, 0.0f); steerZ.resize(total, 0.0f);
+    heading.resize(total, 0.0f);
+    walkTime.resize(total, 0.0f);
+    needsGoal.resize(total, 0);
+    agentCell.resize(total);
+    order.resize(total);
+}
+
+void CrowdSim::spawn(int count) {
+    int first = size();
+    int total = first + count;
+    spawnArrays(total);
+
+    for (int i = first; i < total; i++) {
+        posX[i] = rng.range(params.areaMin.x, params.areaMax.x);
+        posZ[i] = rng.range(params.areaMin.y, params.areaMax.y);
+        pickGoal(i);
+        // Razlicita faza koraka, da guzva ne hoda u ritmu
+        walkTime[i] = (float)i * 0.37f;
+    }
+}
+
+// ========== CHECKPOINT ==========
+struct CrowdStateHeader {
+    uint32_t count;
+    uint32_t reserved;
+    uint64_t rngState;
+    uint64_t rngInc;
+};
+
+static const int CROWD_STATE_FLOAT_ARRAYS = 8;
+
+size_t CrowdSim::stateBytes(int count) {
+    return sizeof(CrowdStateHeader) + (size_t)count * (CROWD_STATE_FLOAT_ARRAYS * sizeof(float) + sizeof(uint8_t));
+}
+
+void CrowdSim::writeState(uint8_t* out) const {
+    CrowdStateHeader header;
+    header.count = (uint32_t)size();
+    header.reserved = 0;
+    header.rngState = rng.state;
+    header.rngInc = rng.inc;
+    memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    const std::vector<float>* arrays[CROWD_STATE_FLOAT_ARRAYS] = { &posX, &posZ, &velX, &velZ, &goalX, &goalZ, &heading, &walkTime };
+    for (const std::vector<float>* a : arrays) {
+        memcpy(out, a->data(), a->size() * sizeof(float));
+        out += a->size() * sizeof(float);
+    }
+    memcpy(out, needsGoal.data(), needsGoal.size());
+}
+
+bool CrowdSim::readState(const uint8_t* in, size_t bytes) {
+    CrowdStateHeader header;
+    if (bytes < sizeof(header)) return false;
+    memcpy(&header, in, sizeof(header));
+    if (bytes != stateBytes((int)header.count)) return false;
+    in += sizeof(header);
+
+    clear();
+    spawnArrays((int)header.count);
+    rng.state = header.rngState;
+    rng.inc = header.rngInc;
+
+    std::vector<float>* arrays[CROWD_STATE_FLOAT_ARRAYS] = { &posX, &posZ, &velX, &velZ, &goalX, &goalZ, &heading, &walkTime };
+    for (std::vector<float>* a : arrays) {
+        memcpy(a->data(), in, a->size() * sizeof(float));
+        in += a->size() * sizeof(float);
+    }
+    memcpy(needsGoal.data(), in, needsGoal.size());
+    return true;
+}
+
+void CrowdSim::pickGoal(int i) {
+    goalX[i] = rng.range(params.areaMin.x, params.areaMax.x);
+    goalZ[i] = rng.range(params.areaMin.y, params.areaMax.y);
+}
+
+int CrowdSim::cellX(float x) const {
+    int c = (int)((x - params.areaMin.x) * invCellSize);
+    return std::min(gridW - 1, std::max(0, c));
+}
+
+int CrowdSim::cellZ(float z) const {
+    int c = (int)((z - params.areaMin.y) * invCellSize);
+    return std::min(gridH - 1, std::max(0, c));
+}
+
+void CrowdSim::update(float dt) {
+    if (posX.empty()) return;
+
+    buildSpatialHash();
+
+    // Upravljanje je nezavisno po agentu, pa se za velike guzve deli na niti
+    int n = size();
+    if (jobs == nullptr || n < PARALLEL_THRESHOLD) {
+        computeSteering(0, n);
+    } else {
+        jobs->parallelFor(n, STEERING_BATCH, [this](int first, int last) { computeSteering(first, last); });
+    }
+
+    // Novi ciljevi se biraju serijski, pa redosled izvlacenja iz generatora ne zavisi od niti
+    for (int i = 0; i < n; i++) {
+        if (needsGoal[i]) {
+            pickGoal(i);
+            needsGoal[i] = 0;
+        }
+    }
+
+    integrate(dt);
+    advanceWalk(dt);
+}
+
+// ========== SPATIAL HASH ==========
+// Razvrstavanje po celijama (counting sort) i preuredjivanje SoA nizova po celiji.
+// Agenti se pomeraju malo izmedju frejmova, pa je permutacija skoro sekvencijalna.
+static void permute(std::vector<float>& data, const std::vector<uint32_t>& order, std::vector<float>& scratch) {
+    for (size_t k = 0; k < order.size(); k++) {
+        scratch[k] = data[order[k]];
+    }
+    data.swap(scratch);
+}
+
+void CrowdSim::buildSpatialHash() {
+    int n = size();
+    std::fill(cellStart.begin(), cellStart.end(), 0u);
+
+    for (int i = 0; i < n; i++) {
+        uint32_t c = (uint32_t)(cellZ(posZ[i]) * gridW + cellX(posX[i]));
+        agentCell[i] = c;
+        cellStart[c + 1]++;
+    }
+    for (size_t c = 1; c < cellStart.size(); c++) {
+        cellStart[c] += cellStart[c - 1];
+    }
+    std::copy(cellStart.begin(), cellStart.end() - 1, cellCursor.begin());
+    for (int i = 0; i < n; i++) {
+        order[cellCursor[agentCell[i]]++] = (uint32_t)i;
+    }
+
+    scratch.resize(n);
+    std::vector<float>* arrays[] = { &posX, &posZ, &velX, &velZ, &goalX, &goalZ, &heading, &walkTime };
+    for (std::vector<float>* a : arrays) {
+        permute(*a, order, scratch);
+    }
+}
+
+// ========== UPRAVLJANJE (cilj + razdvajanje + zidovi) ==========
+void CrowdSim::computeSteering(int first, int last) {
+    const float diameter = params.agentRadius * 2.0f;
+    const float diameterSq = diameter * diameter;
+
+    for (int i = first; i < last; i++) {
+        float px = posX[i];
+        float pz = posZ[i];
+
+        // Zeljena brzina ka cilju
+        float gx = goalX[i] - px;
+        float gz = goalZ[i] - pz;
+        float gd = std::sqrt(gx * gx + gz * gz);
+        if (gd < params.goalRadius) {
+            needsGoal[i] = 1;
+        }
+        float desiredX = 0.0f, desiredZ = 0.0f;
+        if (gd > 1e-5f) {
+            desiredX = gx / gd * params.maxSpeed;
+            desiredZ = gz / gd * params.maxSpeed;
+        }
+        float sx = (desiredX - velX[i]) * params.goalWeight;
+        float sz = (desiredZ - velZ[i]) * params.goalWeight;
+
+        // Razdvajanje od suseda iz 3x3 celija; posle preuredjivanja su celije u istom redu
+        // mreze susedni opsezi agenata, a iz svake se cita najvise MAX_CELL_NEIGHBORS
+        int cx = cellX(px);
+        int cz = cellZ(pz);
+        int x0 = std::max(0, cx - 1);
+        int x1 = std::min(gridW - 1, cx + 1);
+        float sepX = 0.0f, sepZ = 0.0f;
+
+        for (int row = std::max(0, cz - 1); row <= std::min(gridH - 1, cz + 1); row++) {
+            for (int c = row * gridW + x0; c <= row * gridW + x1; c++) {
+                uint32_t begin = cellStart[c];
+                uint32_t end = std::min(cellStart[c + 1], begin + MAX_CELL_NEIGHBORS);
+                for (uint32_t j = begin; j < end; j++) {
+                    float dx = px - posX[j];
+                    float dz = pz - posZ[j];
+                    float d2 = dx * dx + dz * dz;
+                    // Sam agent ima d2 == 0 i preskace se
+                    if (d2 < diameterSq && d2 > 1e-10f) {
+                        float d = std::sqrt(d2);
+                        float push = (diameter - d) / d;
+                        sepX += dx * push;
+                        sepZ += dz * push;
+                    }
+                }
+            }
+        }
+        sx += sepX * params.separationWeight;
+        sz += sepZ * params.separationWeight;
+
+        // Odbijanje od ivica perona
+        float r = params.agentRadius;
+        if (px < params.areaMin.x + r) sx += (params.areaMin.x + r - px) * params.wallWeight;
+        if (px > params.areaMax.x - r) sx -= (px - params.areaMax.x + r) * params.wallWeight;
+        if (pz < params.areaMin.y + r) sz += (params.areaMin.y + r - pz) * params.wallWeight;
+        if (pz > params.areaMax.y - r) sz -= (pz - params.areaMax.y + r) * params.wallWeight;
+
+        steerX[i] = sx;
+        steerZ[i] = sz;
+    }
+}
+
+// ========== INTEGRACIJA (SIMD) ==========
+void CrowdSim::integrate(float dt) {
+    int n = size();
+    int i = 0;
+
+    float* px = posX.data();
+    float* pz = posZ.data();
+    float* vx = velX.data();
+    float* vz = velZ.data();
+    const float* ax = steerX.data();
+    const float* az = steerZ.data();
+
+#if CROWD_SIMD_WIDTH == 8
+    const __m256 vdt = _mm256_set1_ps(dt);
+    const __m256 vmax = _mm256_set1_ps(params.maxSpeed);
+    const __m256 vone = _mm256_set1_ps(1.0f);
+    const __m256 veps = _mm256_set1_ps(1e-12f);
+    const __m256 minX = _mm256_set1_ps(params.areaMin.x), maxX = _mm256_set1_ps(params.areaMax.x);
+    const __m256 minZ = _mm256_set1_ps(params.areaMin.y), maxZ = _mm256_set1_ps(params.areaMax.y);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_add_ps(_mm256_loadu_ps(vx + i), _mm256_mul_ps(_mm256_loadu_ps(ax + i), vdt));
+        __m256 z = _mm256_add_ps(_mm256_loadu_ps(vz + i), _mm256_mul_ps(_mm256_loadu_ps(az + i), vdt));
+
+        // Ogranicenje brzine: scale = min(1, maxSpeed / |v|)
+        __m256 speedSq = _mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(z, z)), veps);
+        __m256 scale = _mm256_min_ps(vone, _mm256_div_ps(vmax, _mm256_sqrt_ps(speedSq)));
+        x = _mm256_mul_ps(x, scale);
+        z = _mm256_mul_ps(z, scale);
+        _mm256_storeu_ps(vx + i, x);
+        _mm256_storeu_ps(vz + i, z);
+
+        __m256 newX = _mm256_add_ps(_mm256_loadu_ps(px + i), _mm256_mul_ps(x, vdt));
+        __m256 newZ = _mm256_add_ps(_mm256_loadu_ps(pz + i), _mm256_mul_ps(z, vdt));
+        _mm256_storeu_ps(px + i, _mm256_min_ps(maxX, _mm256_max_ps(minX, newX)));
+        _mm256_storeu_ps(pz + i, _mm256_min_ps(maxZ, _mm256_max_ps(minZ, newZ)));
+    }
+#elif CROWD_SIMD_WIDTH == 4
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 vmax = _mm_set1_ps(params.maxSpeed);
+    const __m128 vone = _mm_set1_ps(1.0f);
+    const __m128 veps = _mm_set1_ps(1e-12f);
+    const __m128 minX = _mm_set1_ps(params.areaMin.x), maxX = _mm_set1_ps(params.areaMax.x);
+    const __m128 minZ = _mm_set1_ps(params.areaMin.y), maxZ = _mm_set1_ps(params.areaMax.y);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_add_ps(_mm_loadu_ps(vx + i), _mm_mul_ps(_mm_loadu_ps(ax + i), vdt));
+        __m128 z = _mm_add_ps(_mm_loadu_ps(vz + i), _mm_mul_ps(_mm_loadu_ps(az + i), vdt));
+
+        __m128 speedSq = _mm_max_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(z, z)), veps);
+        __m128 scale = _mm_min_ps(vone, _mm_div_ps(vmax, _mm_sqrt_ps(speedSq)));
+        x = _mm_mul_ps(x, scale);
+        z = _mm_mul_ps(z, scale);
+        _mm_storeu_ps(vx + i, x);
+        _mm_storeu_ps(vz + i, z);
+
+        __m128 newX = _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(x, vdt));
+        __m128 newZ = _mm_add_ps(_mm_loadu_ps(pz + i), _mm_mul_ps(z, vdt));
+        _mm_storeu_ps(px + i, _mm_min_ps(maxX, _mm_max_ps(minX, newX)));
+        _mm_storeu_ps(pz + i, _mm_min_ps(maxZ, _mm_max_ps(minZ, newZ)));
+    }
+#endif
+
+    // Ostatak (ili ceo niz bez SIMD podrske)
+    for (; i < n; i++) {
+        float x = vx[i] + ax[i] * dt;
+        float z = vz[i] + az[i] * dt;
+        float speedSq = std::max(x * x + z * z, 1e-12f);
+        float scale = std::min(1.0f, params.maxSpeed / std::sqrt(speedSq));
+        vx[i] = x * scale;
+        vz[i] = z * scale;
+        px[i] = std::min(params.areaMax.x, std::max(params.areaMin.x, px[i] + vx[i] * dt));
+        pz[i] = std::min(params.areaMax.y, std::max(params.areaMin.y, pz[i] + vz[i] * dt));
+    }
+}
+
+// ========== ANIMACIJA ==========
+void CrowdSim::advanceWalk(float dt) {
+    int n = size();
+    for (int i = 0; i < n; i++) {
+        float speed = std::sqrt(velX[i] * velX[i] + velZ[i] * velZ[i]);
+        walkTime[i] += dt * speed / params.maxSpeed;
+    }
+}
+
+void CrowdSim::writeAnimation(std::vector<float>& out) const {
+    int n = size();
+    out.resize(n * 2);
+    for (int i = 0; i < n; i++) {
+        float speed = std::sqrt(velX[i] * velX[i] + velZ[i] * velZ[i]);
+        out[i * 2 + 0] = walkTime[i];
+        out[i * 2 + 1] = std::min(1.0f, speed / (0.3f * params.maxSpeed));
+    }
+}
+
+void CrowdSim::writeInstances(std::vector<float>& out) {
+    int n = size();
+    out.resize(n * 4);
+
+    for (int i = 0; i < n; i++) {
+        // Ugao se menja samo dok se agent stvarno krece, da ne bi treperio u mestu
+        if (velX[i] * velX[i] + velZ[i] * velZ[i] > 0.0004f) {
+            heading[i] = std::atan2(velX[i], velZ[i]);
+        }
+        out[i * 4 + 0] = posX[i];
+        out[i * 4 + 1] = params.groundY;
+        out[i * 4 + 2] = posZ[i];
+        out[i * 4 + 3] = heading[i];
+    }
+}
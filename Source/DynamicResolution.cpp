@@ -0,0 +1,57 @@
+#include "../Header/DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Razmera se menja u koracima od SCALE_STEP da sitne oscilacije merenja ne bi menjale
+// sliku svaki frejm; pad je brzi od rasta jer je propusten frejm gori od mutnije slike
+static const float SCALE_STEP = 0.05f;
+static const float MAX_DROP = 0.15f;
+static const float MAX_RISE = 0.05f;
+// Histereza: smanjuje se iznad budzeta, povecava tek kad ima 25% rezerve
+static const float DROP_ABOVE = 1.0f;
+static const float RISE_BELOW = 0.75f;
+static const float SMOOTHING = 0.2f;
+
+void DynamicResolution::init(float budgetMs, float minScaleValue) {
+    budget = budgetMs;
+    minScale = std::min(std::max(minScaleValue, 0.1f), 1.0f);
+    current = 1.0f;
+    smoothedMs = -1.0f;
+    framesSinceChange = 0;
+    fixed = false;
+}
+
+void DynamicResolution::setFixed(float scale) {
+    current = std::min(std::max(scale, 0.1f), 1.0f);
+    fixed = true;
+}
+
+void DynamicResolution::update(float gpuMs, float cpuMs) {
+    if (fixed) return;
+    float ms = gpuMs >= 0.0f ? gpuMs : cpuMs;
+    if (ms <= 0.0f) return;
+
+    smoothedMs = smoothedMs < 0.0f ? ms : smoothedMs + SMOOTHING * (ms - smoothedMs);
+    if (++framesSinceChange < SETTLE_FRAMES) return;
+
+    float load = smoothedMs / budget;
+    if (load <= DROP_ABOVE && (load >= RISE_BELOW || current >= 1.0f)) return;
+
+    // Vreme ~ razmera^2, pa razmera koja bi dala budzet je current / sqrt(load)
+    float wanted = current / std::sqrt(load);
+    wanted = std::min(std::max(wanted, current - MAX_DROP), current + MAX_RISE);
+    // Na dole, da i malo prekoracenje spusti razmeru bar za jedan korak
+    wanted = std::floor(wanted / SCALE_STEP + 1e-3f) * SCALE_STEP;
+    wanted = std::min(std::max(wanted, minScale), 1.0f);
+    if (std::fabs(wanted - current) < SCALE_STEP * 0.5f) return;
+
+    current = wanted;
+    framesSinceChange = 0;
+    // Staro merenje vazi za staru razmeru
+    smoothedMs = -1.0f;
+}
+
+int DynamicResolution::scaled(int size) const {
+    return std::max(MIN_SIZE, (int)std::lround(size * current));
+}
@@ -0,0 +1,41 @@
+#include "../Header/FrameStats.h"
+
+#include <algorithm>
+
+void FrameStats::push(float frame, float sim, float render) {
+    frameMs[head] = frame;
+    simMs[head] = sim;
+    renderMs[head] = render;
+    head = (head + 1) % FRAME_STATS_WINDOW;
+    if (count < FRAME_STATS_WINDOW) count++;
+}
+
+void FrameStats::summarize(FrameSummary& out) const {
+    out = FrameSummary();
+    out.count = count;
+    if (count == 0) return;
+
+    float sorted[FRAME_STATS_WINDOW];
+    float simSum = 0.0f, renderSum = 0.0f;
+    for (int i = 0; i < count; i++) {
+        int idx = (head + FRAME_STATS_WINDOW - count + i) % FRAME_STATS_WINDOW;
+        sorted[i] = frameMs[idx];
+        simSum += simMs[idx];
+        renderSum += renderMs[idx];
+        out.simMax = std::max(out.simMax, simMs[idx]);
+        out.renderMax = std::max(out.renderMax, renderMs[idx]);
+    }
+    std::sort(sorted, sorted + count);
+
+    // Percentil najblizeg ranga
+    auto percentile = [&](float p) {
+        int rank = (int)(p * count + 0.999f);
+        return sorted[std::min(std::max(rank, 1), count) - 1];
+    };
+    out.p50 = percentile(0.50f);
+    out.p95 = percentile(0.95f);
+    out.p99 = percentile(0.99f);
+    out.max = sorted[count - 1];
+    out.simAvg = simSum / count;
+    out.renderAvg = renderSum / count;
+}
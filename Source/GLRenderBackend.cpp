@@ -0,0 +1,569 @@
+#include "../Header/GLRenderBackend.h"
+
+#include <iostream>
+
+#include "../Header/Util.h"
+
+static GLenum glPrimitive(uint8_t primitive) {
+    switch (primitive) {
+    case PRIMITIVE_TRIANGLE_FAN: return GL_TRIANGLE_FAN;
+    case PRIMITIVE_LINE_STRIP: return GL_LINE_STRIP;
+    default: return GL_TRIANGLES;
+    }
+}
+
+// Bajtova po texelu za interni format; RGB bez alfe drajveri cuvaju poravnato na 4 kanala
+static size_t texelBytes(GLenum internalFormat) {
+    switch (internalFormat) {
+    case GL_RED: case GL_R8: return 1;
+    case GL_RG: case GL_RG8: case GL_R16F: return 2;
+    case GL_RG16F: case GL_R32F: case GL_R32UI: return 4;
+    case GL_RGB16F: case GL_RGBA16F: case GL_RG32F: case GL_RG32UI: return 8;
+    case GL_RGB32F: case GL_RGBA32F: return 16;
+    default: return 4;      // RGB/RGBA 8 bita
+    }
+}
+
+static const size_t DEPTH_STENCIL_BYTES = 4;    // GL_DEPTH24_STENCIL8
+
+static void setTextureParameters(GLenum filter) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+// ========== INICIJALIZACIJA ==========
+void GLRenderBackend::init(int screenWidth, int screenHeight) {
+    Target screen = { 0, 0, RENDER_NONE, screenWidth, screenHeight, false };
+    targets.push_back(screen);
+
+    // Stanje koje se ne menja tokom rada; ukljucivanje ide kroz komande
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glCullFace(GL_BACK);
+    glFrontFace(GL_CCW);
+}
+
+void GLRenderBackend::destroy() {
+    if (!fromCapture) reportLeaks();
+    for (uint32_t i = 1; i < targets.size(); i++) releaseTarget(i);
+    for (uint32_t i = 0; i < textures.size(); i++) releaseTexture(i);
+    for (uint32_t i = 0; i < meshes.size(); i++) releaseMesh(i);
+    for (uint32_t i = 0; i < buffers.size(); i++) releaseBuffer(i);
+    for (ShaderCache& s : ownedShaders) s.destroy();
+    for (Timer& t : timers) glDeleteQueries(GPU_TIMER_QUERIES, t.queries);
+    timers.clear();
+    targets.clear();
+    textures.clear();
+    meshes.clear();
+    buffers.clear();
+    shaders.clear();
+    ownedShaders.clear();
+    fromCapture = false;
+}
+
+// Sve sto vlasnik nije vratio do destroy()
+void GLRenderBackend::reportLeaks() const {
+    int count = 0;
+    auto header = [&]() {
+        if (count++ == 0) std::cout << "Resursi koji nisu oslobodjeni do gasenja:" << std::endl;
+    };
+    for (size_t i = 1; i < targets.size(); i++) {
+        const Target& t = targets[i];
+        if (t.released) continue;
+        header();
+        std::cout << "  cilj " << i << ": " << t.width << "x" << t.height << std::endl;
+    }
+    for (size_t i = 0; i < textures.size(); i++) {
+        const Texture& t = textures[i];
+        if (t.released || t.category == GPU_MEMORY_TARGETS) continue;
+        header();
+        std::cout << "  tekstura " << i << ": ";
+        if (t.target == GL_TEXTURE_BUFFER) std::cout << "texture buffer (bafer " << t.buffer << ")";
+        else std::cout << t.width << "x" << t.height << ", " << textureBytes(t) / 1024 << " KB";
+        if (!t.path.empty()) std::cout << " \"" << t.path << "\"";
+        std::cout << std::endl;
+    }
+    for (size_t i = 0; i < meshes.size(); i++) {
+        if (meshes[i].released) continue;
+        header();
+        std::cout << "  mreza " << i << ": " << meshes[i].attributes.size() << " atributa" << std::endl;
+    }
+    for (size_t i = 0; i < buffers.size(); i++) {
+        if (buffers[i].released) continue;
+        header();
+        std::cout << "  bafer " << i << ": " << buffers[i].bytes / 1024.0 << " KB" << std::endl;
+    }
+    if (count > 0) std::cout << "Ukupno neoslobodjenih resursa: " << count << std::endl;
+}
+
+// ========== RESURSI ==========
+uint32_t GLRenderBackend::addShader(ShaderCache* cache) {
+    shaders.push_back({ cache, false });
+    return (uint32_t)shaders.size() - 1;
+}
+
+uint32_t GLRenderBackend::createBuffer(const void* data, size_t bytes, RenderBufferUsage usage) {
+    Buffer buffer = { 0, bytes, usage, false };
+    glGenBuffers(1, &buffer.id);
+    // COPY_WRITE ne dira vezu elemenata u trenutnom VAO-u
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer.id);
+    bufferData(GL_COPY_WRITE_BUFFER, bytes, data, usage == BUFFER_STREAM ? GL_STREAM_DRAW : GL_STATIC_DRAW);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    buffers.push_back(buffer);
+    gpuMemory.add(GPU_MEMORY_BUFFERS, bytes);
+    enforceBudget();
+    return (uint32_t)buffers.size() - 1;
+}
+
+void GLRenderBackend::applyAttribute(const MeshAttribute& attribute) {
+    glBindBuffer(GL_ARRAY_BUFFER, buffers[attribute.buffer].id);
+    glVertexAttribPointer(attribute.location, attribute.components, GL_FLOAT, GL_FALSE, attribute.stride, (void*)(size_t)attribute.offset);
+    glEnableVertexAttribArray(attribute.location);
+    if (attribute.divisor != 0) glVertexAttribDivisor(attribute.location, attribute.divisor);
+}
+
+uint32_t GLRenderBackend::createMesh(const std::vector<MeshAttribute>& attributes, uint32_t indexBuffer) {
+    Mesh mesh = { 0, attributes, indexBuffer, false };
+    glGenVertexArrays(1, &mesh.vao);
+    bindVertexArray(mesh.vao);
+    for (const MeshAttribute& attribute : attributes) applyAttribute(attribute);
+    if (indexBuffer != RENDER_NONE) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[indexBuffer].id);
+    bindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    meshes.push_back(mesh);
+    boundMesh = RENDER_NONE;
+    return (uint32_t)meshes.size() - 1;
+}
+
+void GLRenderBackend::addAttribute(uint32_t mesh, const MeshAttribute& attribute) {
+    bindVertexArray(meshes[mesh].vao);
+    applyAttribute(attribute);
+    bindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    meshes[mesh].attributes.push_back(attribute);
+    boundMesh = RENDER_NONE;
+}
+
+uint32_t GLRenderBackend::pushTexture(GLuint id, GLenum target, GLenum internalFormat, int width, int height,
+                                      uint32_t buffer, GLenum filter) {
+    Texture texture;
+    texture.id = id;
+    texture.target = target;
+    texture.internalFormat = internalFormat;
+    texture.width = width;
+    texture.height = height;
+    texture.buffer = buffer;
+    texture.filter = filter;
+    texture.category = GPU_MEMORY_TEXTURES;
+    texture.resident = true;
+    texture.released = false;
+    texture.lastUsed = 0;
+    textures.push_back(texture);
+    gpuMemory.add(GPU_MEMORY_TEXTURES, textureBytes(texture));
+    return (uint32_t)textures.size() - 1;
+}
+
+size_t GLRenderBackend::textureBytes(const Texture& texture) {
+    if (texture.target != GL_TEXTURE_2D) return 0;  // Sadrzaj je u baferu
+    return (size_t)texture.width * texture.height * texelBytes(texture.internalFormat);
+}
+
+uint32_t GLRenderBackend::addTexture(GLuint id) {
+    GLint width = 0, height = 0, format = GL_RGBA;
+    bindTexture(GL_TEXTURE_2D, id);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    // Bez mipmapa podrazumevani MIN_FILTER ostavlja teksturu nepotpunom
+    setTextureParameters(GL_LINEAR);
+    bindTexture(GL_TEXTURE_2D, 0);
+    uint32_t texture = pushTexture(id, GL_TEXTURE_2D, (GLenum)format, width, height, RENDER_NONE, GL_LINEAR);
+    enforceBudget();
+    return texture;
+}
+
+uint32_t GLRenderBackend::loadTexture(const char* path) {
+    GLuint id = loadImageToTexture(path);
+    if (id == 0) return RENDER_NONE;
+    uint32_t texture = addTexture(id);
+    textures[texture].path = path;
+    return texture;
+}
+
+uint32_t GLRenderBackend::createTexture(int width, int height, GLenum internalFormat, GLenum format, GLenum type,
+                                        const void* pixels, GLenum filter) {
+    GLuint id = 0;
+    glGenTextures(1, &id);
+    bindTexture(GL_TEXTURE_2D, id);
+    texImage2D(GL_TEXTURE_2D, internalFormat, width, height, format, type, pixels);
+    setTextureParameters(filter);
+    bindTexture(GL_TEXTURE_2D, 0);
+    uint32_t texture = pushTexture(id, GL_TEXTURE_2D, internalFormat, width, height, RENDER_NONE, filter);
+    enforceBudget();
+    return texture;
+}
+
+uint32_t GLRenderBackend::createBufferTexture(uint32_t buffer, GLenum format) {
+    GLuint id = 0;
+    glGenTextures(1, &id);
+    bindTexture(GL_TEXTURE_BUFFER, id);
+    glTexBuffer(GL_TEXTURE_BUFFER, format, buffers[buffer].id);
+    bindTexture(GL_TEXTURE_BUFFER, 0);
+    return pushTexture(id, GL_TEXTURE_BUFFER, format, 0, 0, buffer, GL_NEAREST);
+}
+
+uint32_t GLRenderBackend::createTarget(int width, int height) {
+    return createTargetFor(createTexture(width, height, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, NULL, GL_LINEAR));
+}
+
+uint32_t GLRenderBackend::createTargetFor(uint32_t colorTexture) {
+    Texture& color = textures[colorTexture];
+    Target target = { 0, 0, colorTexture, color.width, color.height, false };
+
+    // Tekstura boje prelazi u kategoriju ciljeva; renderbuffer je drugi objekat cilja
+    gpuMemory.remove(GPU_MEMORY_TEXTURES, textureBytes(color));
+    gpuMemory.add(GPU_MEMORY_TARGETS, textureBytes(color));
+    gpuMemory.add(GPU_MEMORY_TARGETS, (size_t)target.width * target.height * DEPTH_STENCIL_BYTES);
+    color.category = GPU_MEMORY_TARGETS;
+
+    glGenFramebuffers(1, &target.framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color.id, 0);
+
+    glGenRenderbuffers(1, &target.depthStencil);
+    glBindRenderbuffer(GL_RENDERBUFFER, target.depthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, target.width, target.height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target.depthStencil);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cout << "Framebuffer nije kompletan!" << std::endl;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    boundTarget = RENDER_NONE;
+
+    targets.push_back(target);
+    enforceBudget();
+    return (uint32_t)targets.size() - 1;
+}
+
+void GLRenderBackend::setScreenTarget(GLuint framebuffer) {
+    targets[RENDER_SCREEN].framebuffer = framebuffer;
+    boundTarget = RENDER_NONE;
+}
+
+// ========== OSLOBADJANJE ==========
+void GLRenderBackend::releaseBuffer(uint32_t buffer) {
+    Buffer& b = buffers[buffer];
+    if (b.released) return;
+    glDeleteBuffers(1, &b.id);
+    gpuMemory.remove(GPU_MEMORY_BUFFERS, b.bytes);
+    b.id = 0;
+    b.released = true;
+}
+
+void GLRenderBackend::releaseMesh(uint32_t mesh) {
+    Mesh& m = meshes[mesh];
+    if (m.released) return;
+    glDeleteVertexArrays(1, &m.vao);
+    for (const MeshAttribute& attribute : m.attributes) releaseBuffer(attribute.buffer);
+    if (m.indexBuffer != RENDER_NONE) releaseBuffer(m.indexBuffer);
+    m.vao = 0;
+    m.released = true;
+    if (boundMesh == mesh) boundMesh = RENDER_NONE;
+}
+
+void GLRenderBackend::releaseTexture(uint32_t texture) {
+    Texture& t = textures[texture];
+    if (t.released) return;
+    if (t.resident) {
+        glDeleteTextures(1, &t.id);
+        gpuMemory.remove(t.category, textureBytes(t));
+    }
+    t.id = 0;
+    t.resident = false;
+    t.released = true;
+}
+
+void GLRenderBackend::releaseTarget(uint32_t target) {
+    Target& t = targets[target];
+    if (target == RENDER_SCREEN || t.released) return;
+    glDeleteFramebuffers(1, &t.framebuffer);
+    glDeleteRenderbuffers(1, &t.depthStencil);
+    gpuMemory.remove(GPU_MEMORY_TARGETS, (size_t)t.width * t.height * DEPTH_STENCIL_BYTES);
+    releaseTexture(t.colorTexture);
+    t.framebuffer = 0;
+    t.depthStencil = 0;
+    t.released = true;
+    if (boundTarget == target) boundTarget = RENDER_NONE;
+}
+
+// ========== BUDZET MEMORIJE ==========
+void GLRenderBackend::makeResident(uint32_t texture) {
+    Texture& t = textures[texture];
+    if (t.resident || t.released || t.path.empty()) return;
+    GLuint id = loadImageToTexture(t.path.c_str());
+    if (id == 0) {
+        // Fajl vise nije dostupan - tekstura ostaje nulta
+        std::cout << "Tekstura \"" << t.path << "\" nije ponovo ucitana!" << std::endl;
+        t.path.clear();
+        return;
+    }
+    bindTexture(GL_TEXTURE_2D, id);
+    setTextureParameters(t.filter);
+    bindTexture(GL_TEXTURE_2D, 0);
+    t.id = id;
+    t.resident = true;
+    gpuMemory.add(t.category, textureBytes(t));
+    gpuMemory.reloads++;
+}
+
+void GLRenderBackend::enforceBudget() {
+    while (gpuMemory.overBudget()) {
+        // Najdavnije vezana tekstura iz fajla koja nije potrebna u ovom frejmu
+        int victim = -1;
+        for (size_t i = 0; i < textures.size(); i++) {
+            const Texture& t = textures[i];
+            if (!t.resident || t.released || t.path.empty() || t.lastUsed > frame) continue;
+            if (victim < 0 || t.lastUsed < textures[victim].lastUsed) victim = (int)i;
+        }
+        if (victim < 0) {
+            if (!budgetWarned) {
+                std::cout << "UPOZORENJE: GPU memorija " << gpuMemory.total() / 1024 << " KB je preko budzeta "
+                          << gpuMemory.budget / 1024 << " KB, a nema tekstura koje se mogu izbaciti" << std::endl;
+                budgetWarned = true;
+            }
+            return;
+        }
+        Texture& t = textures[victim];
+        glDeleteTextures(1, &t.id);
+        gpuMemory.remove(t.category, textureBytes(t));
+        gpuMemory.evictions++;
+        t.id = 0;
+        t.resident = false;
+    }
+    budgetWarned = false;
+}
+
+void GLRenderBackend::endFrame() {
+    enforceBudget();
+    frame++;
+}
+
+// ========== IZVRSAVANJE ==========
+void GLRenderBackend::uploadBuffer(Buffer& buffer, const void* data, size_t bytes) {
+    GLenum usage = buffer.usage == BUFFER_STREAM ? GL_STREAM_DRAW : GL_STATIC_DRAW;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, buffer.id);
+    if (bytes > buffer.bytes) {
+        bufferData(GL_COPY_WRITE_BUFFER, bytes, data, usage);
+        gpuMemory.resize(GPU_MEMORY_BUFFERS, buffer.bytes, bytes);
+        buffer.bytes = bytes;
+    } else {
+        // Novo skladiste iste velicine (orphan), pa drajver ne ceka prethodni frejm
+        bufferData(GL_COPY_WRITE_BUFFER, buffer.bytes, NULL, usage);
+        bufferSubData(GL_COPY_WRITE_BUFFER, 0, bytes, data);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+void GLRenderBackend::setState(RenderState state, bool enabled) {
+    if (states[state] == (enabled ? 1 : 0)) return;
+    states[state] = enabled ? 1 : 0;
+    static const GLenum caps[3] = { GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE };
+    setCapability(caps[state], enabled);
+}
+
+void GLRenderBackend::setStencil(RenderStencilMode mode, int ref) {
+    if (stencilMode == mode && (mode == STENCIL_OFF || stencilRef == ref)) return;
+    bool enabled = mode != STENCIL_OFF;
+    if (stencilMode < 0 || (stencilMode != STENCIL_OFF) != enabled) setCapability(GL_STENCIL_TEST, enabled);
+    stencilMode = mode;
+    stencilRef = ref;
+    switch (mode) {
+    case STENCIL_OFF: break;
+    case STENCIL_WRITE: ::setStencil(GL_ALWAYS, ref, GL_REPLACE, 0xff); break;
+    case STENCIL_EQUAL: ::setStencil(GL_EQUAL, ref, GL_KEEP, 0x00); break;
+    case STENCIL_NOT_EQUAL: ::setStencil(GL_NOTEQUAL, ref, GL_KEEP, 0x00); break;
+    }
+}
+
+void GLRenderBackend::bindTarget(uint32_t target) {
+    if (boundTarget == target) return;
+    boundTarget = target;
+    const Target& t = targets[target];
+    bindFramebuffer(t.framebuffer);
+    setViewport(0, 0, t.width, t.height);
+}
+
+// ========== GPU TAJMERI ==========
+uint32_t GLRenderBackend::createTimer() {
+    Timer t;
+    glGenQueries(GPU_TIMER_QUERIES, t.queries);
+    t.next = 0;
+    t.pending = 0;
+    t.running = false;
+    t.lastMs = -1.0f;
+    timers.push_back(t);
+    return (uint32_t)timers.size() - 1;
+}
+
+// Cita zavrsene upite redom kojim su zapoceti; staje na prvom koji jos nije gotov
+void GLRenderBackend::pollTimer(Timer& timer) {
+    while (timer.pending > 0) {
+        GLuint query = timer.queries[(timer.next - timer.pending + GPU_TIMER_QUERIES) % GPU_TIMER_QUERIES];
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+        timer.lastMs = (float)(ns / 1e6);
+        timer.pending--;
+    }
+}
+
+float GLRenderBackend::timerMs(uint32_t timer) {
+    Timer& t = timers[timer];
+    pollTimer(t);
+    return t.lastMs;
+}
+
+void GLRenderBackend::execute(const RenderCommandList& list) {
+    // Kod van liste (snimak ekrana, overlay) moze da promeni stanje izmedju dva izvrsavanja
+    for (int& s : states) s = -1;
+    stencilMode = stencilRef = -1;
+    boundTarget = RENDER_NONE;
+    boundMesh = RENDER_NONE;
+    lineWidth = -1.0f;
+
+    const std::vector<float>& values = list.values();
+    const std::vector<std::string>& names = list.names();
+
+    for (const RenderCommand& cmd : list.commands()) {
+        switch (cmd.type) {
+        case RENDER_SET_TARGET:
+            bindTarget(cmd.a);
+            break;
+        case RENDER_CLEAR: {
+            const float* c = &values[cmd.data];
+            glClearColor(c[0], c[1], c[2], c[3]);
+            // glClear postuje masku upisa; STENCIL_EQUAL/NOT_EQUAL je ostavljaju na 0
+            if (stencilMode != STENCIL_WRITE) {
+                glStencilMask(0xff);
+                if (stencilMode != STENCIL_OFF) stencilMode = -1;
+            }
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            break;
+        }
+        case RENDER_SET_STATE:
+            setState((RenderState)cmd.sub, cmd.a != 0);
+            break;
+        case RENDER_SET_STENCIL:
+            setStencil((RenderStencilMode)cmd.sub, (int)cmd.a);
+            break;
+        case RENDER_SET_LINE_WIDTH:
+            if (lineWidth != values[cmd.data]) {
+                lineWidth = values[cmd.data];
+                setLineWidth(lineWidth);
+            }
+            break;
+        case RENDER_USE_PIPELINE:
+            shaders[cmd.slot].cache->use(cmd.a);
+            break;
+        case RENDER_SET_CONSTANT: {
+            ShaderCache* target = shaders[cmd.slot].cache;
+            const char* name = names[cmd.a].c_str();
+            const float* v = &values[cmd.data];
+            switch ((RenderConstantType)cmd.sub) {
+            case CONSTANT_INT: target->setInt(name, (int)v[0]); break;
+            case CONSTANT_FLOAT: target->setFloat(name, v[0]); break;
+            case CONSTANT_IVEC3: target->setIVec3(name, (int)v[0], (int)v[1], (int)v[2]); break;
+            case CONSTANT_VEC2: target->setVec2(name, v[0], v[1]); break;
+            case CONSTANT_VEC3: target->setVec3(name, v[0], v[1], v[2]); break;
+            case CONSTANT_MAT4: target->setMat4(name, v); break;
+            }
+            break;
+        }
+        case RENDER_BIND_MESH:
+            if (boundMesh != cmd.a) {
+                boundMesh = cmd.a;
+                bindVertexArray(meshes[cmd.a].vao);
+            }
+            break;
+        case RENDER_BIND_TEXTURE:
+            glActiveTexture(GL_TEXTURE0 + cmd.slot);
+            // Tekstura koja nije ucitana (RENDER_NONE) se crta kao nulta, kao pre backend-a
+            if (cmd.a == RENDER_NONE) {
+                bindTexture(GL_TEXTURE_2D, 0);
+            } else {
+                // Izbacena tekstura se ucitava ponovo pri prvom vezivanju
+                makeResident(cmd.a);
+                textures[cmd.a].lastUsed = frame + 1;
+                bindTexture(textures[cmd.a].target, textures[cmd.a].id);
+            }
+            if (cmd.slot != 0) glActiveTexture(GL_TEXTURE0);
+            break;
+        case RENDER_UPDATE_BUFFER: {
+            const RenderBlob& blob = list.blobs()[cmd.b];
+            uploadBuffer(buffers[cmd.a], blob.data, blob.bytes);
+            break;
+        }
+        case RENDER_UPDATE_TEXTURE: {
+            const RenderBlob& blob = list.blobs()[cmd.b];
+            const Texture& t = textures[cmd.a];
+            bindTexture(GL_TEXTURE_2D, t.id);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)cmd.c);
+            texSubImage2D(GL_TEXTURE_2D, 0, 0, t.width, t.height, GL_RGBA, GL_UNSIGNED_BYTE, blob.data);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            break;
+        }
+        case RENDER_BEGIN_PASS:
+            glStats.beginPass(names[cmd.a].c_str());
+            break;
+        case RENDER_SET_VIEWPORT:
+            setViewport(0, 0, (GLsizei)cmd.a, (GLsizei)cmd.b);
+            // Sledeci setTarget mora ponovo da postavi pun viewport, i za isti cilj
+            boundTarget = RENDER_NONE;
+            break;
+        case RENDER_BLIT: {
+            const Target& source = targets[cmd.a];
+            const Target& destination = targets[cmd.b];
+            blitFramebuffer(source.framebuffer, (GLint)values[cmd.data], (GLint)values[cmd.data + 1],
+                            destination.framebuffer, destination.width, destination.height);
+            // Blit ostavlja izvor vezan za citanje; dalje se crta u odrediste
+            boundTarget = RENDER_NONE;
+            bindTarget(cmd.b);
+            break;
+        }
+        case RENDER_BEGIN_TIMER:
+            // Snimak ne nosi tajmere, pa ih replay preskace
+            if (cmd.a < timers.size()) {
+                Timer& t = timers[cmd.a];
+                pollTimer(t);
+                t.running = t.pending < GPU_TIMER_QUERIES;
+                if (t.running) glBeginQuery(GL_TIME_ELAPSED, t.queries[t.next]);
+            }
+            break;
+        case RENDER_END_TIMER:
+            if (cmd.a < timers.size() && timers[cmd.a].running) {
+                Timer& t = timers[cmd.a];
+                glEndQuery(GL_TIME_ELAPSED);
+                t.next = (t.next + 1) % GPU_TIMER_QUERIES;
+                t.pending++;
+                t.running = false;
+            }
+            break;
+        case RENDER_DRAW:
+            drawArrays(glPrimitive(cmd.sub), (GLint)cmd.a, (GLsizei)cmd.b);
+            break;
+        case RENDER_DRAW_INDEXED:
+            drawElementsBaseVertex(glPrimitive(cmd.sub), (GLsizei)cmd.b, GL_UNSIGNED_INT,
+                                   (const void*)((size_t)cmd.a * sizeof(uint32_t)), (GLint)cmd.c);
+            break;
+        case RENDER_DRAW_INSTANCED:
+            drawArraysInstanced(glPrimitive(cmd.sub), (GLint)cmd.a, (GLsizei)cmd.b, (GLsizei)cmd.c);
+            break;
+        }
+    }
+    bindVertexArray(0);
+    boundMesh = RENDER_NONE;
+}
@@ -0,0 +1,52 @@
+#include "../Header/GLStats.h"
+
+#include <cstring>
+
+GLStats glStats;
+
+const GLCounterInfo GL_COUNTERS[GL_COUNTER_COUNT] = {
+    { "draw_calls", &GLCounters::drawCalls },
+    { "triangles", &GLCounters::triangles },
+    { "state_changes", &GLCounters::stateChanges },
+    { "program_binds", &GLCounters::programBinds },
+    { "uniform_uploads", &GLCounters::uniformUploads },
+    { "texture_binds", &GLCounters::textureBinds },
+    { "vertex_array_binds", &GLCounters::vertexArrayBinds },
+    { "buffer_uploads", &GLCounters::bufferUploads },
+    { "buffer_bytes", &GLCounters::bufferBytes },
+    { "texture_uploads", &GLCounters::textureUploads },
+    { "texture_bytes", &GLCounters::textureBytes },
+};
+
+void GLCounters::add(const GLCounters& other) {
+    for (const GLCounterInfo& info : GL_COUNTERS) this->*info.field += other.*info.field;
+}
+
+void GLStats::reset() {
+    passCount = 0;
+    current = nullptr;
+}
+
+void GLStats::beginPass(const char* name) {
+    for (int i = 0; i < passCount; i++) {
+        if (strcmp(passes[i].name, name) == 0) {
+            current = &passes[i].counters;
+            return;
+        }
+    }
+    if (passCount == GL_STATS_MAX_PASSES) {
+        current = &passes[passCount - 1].counters;
+        return;
+    }
+    GLPassStats& pass = passes[passCount++];
+    strncpy(pass.name, name, sizeof(pass.name) - 1);
+    pass.name[sizeof(pass.name) - 1] = '\0';
+    pass.counters = GLCounters();
+    current = &pass.counters;
+}
+
+GLCounters GLStats::total() const {
+    GLCounters sum;
+    for (int i = 0; i < passCount; i++) sum.add(passes[i].counters);
+    return sum;
+}
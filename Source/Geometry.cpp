@@ -0,0 +1,687 @@
+#include "../Header/Geometry.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+// ========== KRIVE ==========
+Vec2 lerp(Vec2 a, Vec2 b, float t) {
+    return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+}
+
+Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t) {
+    float u = 1.0f - t;
+    return Vec2(
+        u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
+        u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
+    );
+}
+
+void initStationPositions(Station* stations, int count) {
+
+    stations[0].position = Vec2(-0.65f, 0.55f);   // Top-left area
+    stations[1].position = Vec2(-0.25f, 0.65f);   // Top-center-left
+    stations[2].position = Vec2(0.35f, 0.60f);    // Top-right area
+    stations[3].position = Vec2(0.70f, 0.25f);    // Right side, upper
+    stations[4].position = Vec2(0.75f, -0.15f);   // Right side, lower
+    stations[5].position = Vec2(0.45f, -0.55f);   // Bottom-right
+    stations[6].position = Vec2(0.0f, -0.65f);    // Bottom-center
+    stations[7].position = Vec2(-0.50f, -0.50f);  // Bottom-left
+    stations[8].position = Vec2(-0.75f, -0.10f);  // Left side, lower
+    stations[9].position = Vec2(-0.70f, 0.20f);   // Left side, upper
+
+    for (int i = 0; i < count; i++) {
+        stations[i].number = i;
+    }
+}
+
+Vec2 pathControlPoint(Vec2 p0, Vec2 p2, int index) {
+    Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
+    float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
+    Vec2 normal = Vec2(-dir.y, dir.x);
+
+    if (dist > 0.0001f) {
+        normal.x /= dist;
+        normal.y /= dist;
+    }
+
+    float curvature = 0.12f + 0.08f * sin(index * 0.7f);
+    float curveDir = (index % 3 == 0) ? -1.0f : 1.0f;
+
+    Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
+    return Vec2(
+        midPoint.x + normal.x * curvature * curveDir,
+        midPoint.y + normal.y * curvature * curveDir
+    );
+}
+
+// ========== 2D TEMENA ==========
+void buildPathVertices(const Station* stations, int count, int segmentsPerEdge, std::vector<float>& out) {
+    out.clear();
+    out.reserve(count * (segmentsPerEdge + 1) * 2);
+
+    for (int i = 0; i < count; i++) {
+        int nextIdx = (i + 1) % count;
+        Vec2 p0 = stations[i].position;
+        Vec2 p2 = stations[nextIdx].position;
+        Vec2 controlPoint = pathControlPoint(p0, p2, i);
+
+        for (int j = 0; j <= segmentsPerEdge; j++) {
+            float t = (float)j / (float)segmentsPerEdge;
+            Vec2 point = bezierQuadratic(p0, controlPoint, p2, t);
+            out.push_back(point.x);
+            out.push_back(point.y);
+        }
+    }
+}
+
+void buildCircleVertices(int segments, std::vector<float>& out) {
+    out.clear();
+    out.reserve((segments + 1) * 2);
+
+    for (int i = 0; i <= segments; i++) {
+        float angle = (2.0f * 3.14159f * i) / segments;
+        out.push_back(cos(angle));
+        out.push_back(sin(angle));
+    }
+}
+
+// ========== 3D TEMENA ==========
+void buildRoadVertices(float roadLength, std::vector<float>& out) {
+    out.clear();
+
+    float roadWidth = 50.0f;
+    float roadStart = 50.0f;
+    float roadEnd = -roadLength;
+    
+    // Asfalt
+    out.insert(out.end(), {
+        // Leva strana puta
+        -roadWidth / 2, -1.2f, roadStart,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         roadWidth / 2, -1.2f, roadStart,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         roadWidth / 2, -1.2f, roadEnd,     0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -roadWidth / 2, -1.2f, roadEnd,     0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // Bela linija
+    out.insert(out.end(), {
+        -0.1f, -1.19f, roadStart,   1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         0.1f, -1.19f, roadStart,   1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         0.1f, -1.19f, roadEnd,     1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -0.1f, -1.19f, roadEnd,     1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // Trava sa leve strane
+    out.insert(out.end(), {
+        -500.0f, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+        -roadWidth / 2, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+        -roadWidth / 2, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -500.0f, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // Trava sa desne strane
+    out.insert(out.end(), {
+         roadWidth / 2, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         500.0f, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         500.0f, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+         roadWidth / 2, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+}
+
+void buildStationVertices(std::vector<float>& out) {
+    out.clear();
+
+    float stationWidth = 3.0f;   // Šira stanica
+    float stationHeight = 0.3f;  // Niska platforma
+    float stationDepth = 1.5f;
+    float roofHeight = 2.5f;     // Visina krova iznad poda
+    
+    // ===== PLATFORMA (POD) =====
+    out.insert(out.end(), {
+        -stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2, -1.2f + stationHeight,  stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -stationWidth/2, -1.2f + stationHeight,  stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // Prednja strana platforme
+    out.insert(out.end(), {
+        -stationWidth/2, -1.2f, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2, -1.2f, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+        -stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+    });
+    
+    // ===== ZADNJI ZID (Zaštitni zid) =====
+    out.insert(out.end(), {
+        -stationWidth/2, -1.2f + stationHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, -1.0f,
+         stationWidth/2, -1.2f + stationHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, -1.0f,
+         stationWidth/2, -1.2f + roofHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, -1.0f,
+        -stationWidth/2, -1.2f + roofHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, -1.0f,
+    });
+    
+    // ===== STUBOVI (Levi i desni) =====
+    // Levi stub
+    out.insert(out.end(), {
+        -stationWidth/2 + 0.2f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+        -stationWidth/2 + 0.4f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+        -stationWidth/2 + 0.4f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+        -stationWidth/2 + 0.2f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+    });
+    
+    // Desni stub
+    out.insert(out.end(), {
+         stationWidth/2 - 0.4f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2 - 0.2f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2 - 0.2f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2 - 0.4f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+    });
+    
+    // ===== KROV =====
+    // Donji deo krova
+    out.insert(out.end(), {
+        -stationWidth/2 - 0.3f, -1.2f + roofHeight, -stationDepth/2 - 0.5f,   0.7f, 0.1f, 0.1f, 1.0f,   0.0f, 0.0f,   0.0f, -1.0f, 0.0f,
+         stationWidth/2 + 0.3f, -1.2f + roofHeight, -stationDepth/2 - 0.5f,   0.7f, 0.1f, 0.1f, 1.0f,   1.0f, 0.0f,   0.0f, -1.0f, 0.0f,
+         stationWidth/2 + 0.3f, -1.2f + roofHeight, stationDepth/2,   0.7f, 0.1f, 0.1f, 1.0f,   1.0f, 1.0f,   0.0f, -1.0f, 0.0f,
+        -stationWidth/2 - 0.3f, -1.2f + roofHeight, stationDepth/2,   0.7f, 0.1f, 0.1f, 1.0f,   0.0f, 1.0f,   0.0f, -1.0f, 0.0f,
+    });
+    
+    // Vrh krova
+    out.insert(out.end(), {
+        -stationWidth/2 - 0.3f, -1.2f + roofHeight + 0.2f, -stationDepth/2 - 0.5f,   0.8f, 0.2f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2 + 0.3f, -1.2f + roofHeight + 0.2f, -stationDepth/2 - 0.5f,   0.8f, 0.2f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2 + 0.3f, -1.2f + roofHeight + 0.2f, stationDepth/2,   0.8f, 0.2f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -stationWidth/2 - 0.3f, -1.2f + roofHeight + 0.2f, stationDepth/2,   0.8f, 0.2f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // ===== KLUPA =====
+    // Površina klupe
+    out.insert(out.end(), {
+        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.6f,   0.6f, 0.4f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.6f,   0.6f, 0.4f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.6f, 0.4f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.6f, 0.4f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
+    });
+    
+    // Naslon klupe
+    out.insert(out.end(), {
+        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         stationWidth/2 - 0.8f, -1.2f + stationHeight + 1.0f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 1.0f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+    });
+}
+
+void buildPosterVertices(std::vector<float>& out) {
+    // Malo ispred zadnjeg zida (z = 0.75), okrenut ka putu kao i zid
+    out.assign({
+        -1.1f, -0.75f, 0.76f,   1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         1.1f, -0.75f, 0.76f,   1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
+         1.1f,  0.95f, 0.76f,   1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+        -1.1f,  0.95f, 0.76f,   1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
+    });
+}
+
+// ========== KABINA I LJUDI ==========
+// Kabina: 23 kvadra, redom kao u nizu (11 volan, 12 displej, 20 vrata)
+static const float CABIN_VERTICES[] = {
+    //X    Y    Z      R    G    B    A         S   T      Nx Ny Nz
+    
+    // KONTROLNI PANEL
+    -0.8,-0.3,-0.5,   0.2, 0.2, 0.2, 1.0,     0,  0,     0, 0, 1,
+     0.8,-0.3,-0.5,   0.2, 0.2, 0.2, 1.0,     1,  0,     0, 0, 1,
+     0.8,-0.5,-0.3,   0.2, 0.2, 0.2, 1.0,     1,  1,     0, 0, 1,
+    -0.8,-0.5,-0.3,   0.2, 0.2, 0.2, 1.0,     0,  1,     0, 0, 1,
+    
+    -0.8,-0.3,-0.5,   0.3, 0.3, 0.3, 1.0,     0,  0,     0, 1, 0,
+    -0.8,-0.5,-0.3,   0.3, 0.3, 0.3, 1.0,     0,  1,     0, 1, 0,
+     0.8,-0.5,-0.3,   0.3, 0.3, 0.3, 1.0,     1,  1,     0, 1, 0,
+     0.8,-0.3,-0.5,   0.3, 0.3, 0.3, 1.0,     1,  0,     0, 1, 0,
+    
+    // VETROBRANSKO STAKLO
+    -0.9, 0.4,-0.6,   0.6, 0.7, 0.8, 0.15,    0,  0,     0, 0, 1,
+     0.9, 0.4,-0.6,   0.6, 0.7, 0.8, 0.15,    1,  0,     0, 0, 1,
+     0.9,-0.3,-0.5,   0.6, 0.7, 0.8, 0.15,    1,  1,     0, 0, 1,
+    -0.9,-0.3,-0.5,   0.6, 0.7, 0.8, 0.15,    0,  1,     0, 0, 1,
+    
+    // RAM VETROBRANA - gore
+    -0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     0, 1, 0,
+     0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     0, 1, 0,
+     0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     0, 1, 0,
+    -0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     0, 1, 0,
+    
+    // RAM VETROBRANA - levo
+    -0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     -1, 0, 0,
+    -0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     -1, 0, 0,
+    -1.0, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     -1, 0, 0,
+    -1.0, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     -1, 0, 0,
+    
+    // RAM VETROBRANA - desno
+     0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     1, 0, 0,
+     1.0, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     1, 0, 0,
+     1.0, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     1, 0, 0,
+     0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     1, 0, 0,
+    
+    // LEVA STRANA KABINE
+    -1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     -1, 0, 0,
+    -1.0, 0.5,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     -1, 0, 0,
+    -1.0,-0.6,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     -1, 0, 0,
+    -1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     -1, 0, 0,
+    
+    // DESNA STRANA KABINE - gornji deo
+     1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
+     1.0, 0.35, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
+     1.0, 0.35,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
+     1.0, 0.5,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
+    
+    // POD KABINE
+    -1.0,-0.6, 0.5,   0.25, 0.25, 0.25, 1.0,     0,  0,     0, -1, 0,
+    -1.0,-0.6,-0.6,   0.25, 0.25, 0.25, 1.0,     0,  1,     0, -1, 0,
+     1.0,-0.6,-0.6,   0.25, 0.25, 0.25, 1.0,     1,  1,     0, -1, 0,
+     1.0,-0.6, 0.5,   0.25, 0.25, 0.25, 1.0,     1,  0,     0, -1, 0,
+    
+    // PLAFON KABINE
+    -1.0, 0.5, 0.5,   0.9, 0.9, 0.85, 1.0,     0,  0,     0, 1, 0,
+     1.0, 0.5, 0.5,   0.9, 0.9, 0.85, 1.0,     1,  0,     0, 1, 0,
+     1.0, 0.5,-0.6,   0.9, 0.9, 0.85, 1.0,     1,  1,     0, 1, 0,
+    -1.0, 0.5,-0.6,   0.9, 0.9, 0.85, 1.0,     0,  1,     0, 1, 0,
+    
+    // ZADNJA STRANA KABINE
+    -1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     0, 0, 1,
+    -1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     0, 0, 1,
+     1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     1,  1,     0, 0, 1,
+     1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     1,  0,     0, 0, 1,
+    
+    // VOLAN
+    -0.15, -0.15, -0.4,   0.1, 0.1, 0.1, 1.0,     0,  0,     0, 0, 1,
+     0.15, -0.15, -0.4,   0.1, 0.1, 0.1, 1.0,     1,  0,     0, 0, 1,
+     0.15, -0.35, -0.4,   0.1, 0.1, 0.1, 1.0,     1,  1,     0, 0, 1,
+    -0.15, -0.35, -0.4,   0.1, 0.1, 0.1, 1.0,     0,  1,     0, 0, 1,
+    
+    // 2D DISPLEJ
+     0.2,  -0.05, -0.4,   0.1, 0.2, 0.4, 1.0,     0,  1,     0, 0, 1,
+     0.5,  -0.05, -0.4,   0.1, 0.2, 0.4, 1.0,     1,  1,     0, 0, 1,
+     0.5,  -0.35, -0.4,   0.1, 0.2, 0.4, 1.0,     1,  0,     0, 0, 1,
+     0.2,  -0.35, -0.4,   0.1, 0.2, 0.4, 1.0,     0,  0,     0, 0, 1,
+    
+    // DESNA STRANA KABINE - prednji deo
+     1.0, 0.35,-0.25,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
+     1.0,-0.55,-0.25,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
+     1.0,-0.55,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
+     1.0, 0.35,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
+    
+    // DESNA STRANA KABINE - zadnji deo
+     1.0, 0.35, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
+     1.0,-0.55, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
+     1.0,-0.55, 0.1,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
+     1.0, 0.35, 0.1,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
+    
+    // DESNA STRANA KABINE - donji deo
+     1.0,-0.55, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
+     1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
+     1.0,-0.6,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
+     1.0,-0.55,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
+    
+    // VRATA - okvir gornji
+     1.0, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
+     1.02, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
+     1.02, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
+     1.0, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
+    
+    // Okvir vrata - levi
+     1.0, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
+     1.02, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
+     1.02,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
+     1.0,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
+    
+    // Okvir vrata - desni
+     1.0, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
+     1.02, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
+     1.02,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
+     1.0,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
+    
+    // Okvir vrata - donji
+     1.0,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
+     1.02,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
+     1.02,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
+     1.0,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
+    
+    // Površina vrata
+     1.015, 0.33, 0.08,   0.7, 0.7, 0.75, 1.0,     0,  0,     1, 0, 0,
+     1.015, 0.33,-0.23,   0.7, 0.7, 0.75, 1.0,     1,  0,     1, 0, 0,
+     1.015,-0.53,-0.23,   0.7, 0.7, 0.75, 1.0,     1,  1,     1, 0, 0,
+     1.015,-0.53, 0.08,   0.7, 0.7, 0.75, 1.0,     0,  1,     1, 0, 0,
+    
+    // SEDIŠTE VOZAČA - naslonska površina
+    -0.3, 0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  0,     0, 0, 1,
+     0.3, 0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  0,     0, 0, 1,
+     0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  1,     0, 0, 1,
+    -0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  1,     0, 0, 1,
+    
+    // SEDIŠTE VOZAČA - površina za sedenje
+    -0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  0,     0, 1, 0,
+     0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  0,     0, 1, 0,
+     0.3,-0.2, 0.0,   0.2, 0.3, 0.5, 1.0,     1,  1,     0, 1, 0,
+    -0.3,-0.2, 0.0,   0.2, 0.3, 0.5, 1.0,     0,  1,     0, 1, 0,
+};
+
+// GLAVA
+static const float HEAD_VERTICES[] = {
+    // Prednja strana glave (blago zaobljena)
+    -0.05f,  0.18f,  0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.05f,  0.18f,  0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana glave
+    -0.05f,  0.18f, -0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.05f,  0.18f, -0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana glave (zaobljena)
+    -0.06f,  0.19f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f,  0.19f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana glave (zaobljena)
+     0.06f,  0.19f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+     0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.06f,  0.19f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+    // Vrh glave (zaobljen)
+    -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+    -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+     0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+     0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+    // Vrat (povezuje glavu i trup)
+    -0.03f,  0.18f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.03f,  0.18f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.03f,  0.18f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+    -0.03f,  0.18f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+};
+
+// TRUP
+static const float TORSO_VERTICES[] = {
+    // Prednja strana trupa (širok na ramenima)
+    -0.09f, -0.05f,  0.06f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.09f, -0.05f,  0.06f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.09f,  0.17f,  0.05f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.09f,  0.17f,  0.05f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana trupa
+    -0.09f, -0.05f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    -0.09f,  0.17f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.09f,  0.17f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.09f, -0.05f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana trupa
+    -0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.09f,  0.17f,  0.05f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    -0.09f,  0.17f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana trupa
+     0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+     0.09f,  0.17f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.09f,  0.17f,  0.05f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+    // Gornji deo trupa (ramena)
+    -0.09f,  0.17f, -0.04f,  0.32f, 0.52f, 0.82f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+    -0.09f,  0.17f,  0.05f,  0.32f, 0.52f, 0.82f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+     0.09f,  0.17f,  0.05f,  0.32f, 0.52f, 0.82f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+     0.09f,  0.17f, -0.04f,  0.32f, 0.52f, 0.82f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+    // Donji deo trupa (struk)
+    -0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+    -0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+};
+
+// LEVA RUKA
+static const float LEFT_ARM_VERTICES[] = {
+    // Prednja strana
+    -0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    -0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    -0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana
+    -0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    -0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+    -0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+    -0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana
+    -0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    -0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana (blizu trupa)
+    -0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+    -0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+    -0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+    -0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+};
+
+// DESNA RUKA
+static const float RIGHT_ARM_VERTICES[] = {
+    // Prednja strana
+     0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+     0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana
+     0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+     0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana (blizu trupa)
+     0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+     0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+     0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+     0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana
+     0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+     0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+};
+
+// LEVA NOGA
+static const float LEFT_LEG_VERTICES[] = {
+    // Prednja strana
+    -0.06f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    -0.02f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    -0.02f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.06f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana
+    -0.06f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    -0.06f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+    -0.02f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+    -0.02f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana
+    -0.06f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana
+    -0.02f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+    -0.02f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+    -0.02f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+    -0.02f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+};
+
+// DESNA NOGA
+static const float RIGHT_LEG_VERTICES[] = {
+    // Prednja strana
+     0.02f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.06f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.06f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+     0.02f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Zadnja strana
+     0.02f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+     0.02f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.06f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.06f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    // Leva strana
+     0.02f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+     0.02f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+     0.02f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+     0.02f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana
+     0.06f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+     0.06f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.06f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.06f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+};
+
+// KOSA
+static const float HAIR_VERTICES[] = {
+    // Gornji deo kose (pokriva vrh glave)
+    -0.06f,  0.30f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+     0.06f,  0.30f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+     0.06f,  0.35f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+    -0.06f,  0.35f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+    // Prednji deo kose (šiške)
+    -0.06f,  0.28f,  0.09f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.06f,  0.28f,  0.09f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.06f,  0.32f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.06f,  0.32f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Leva strana kose
+    -0.07f,  0.28f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.07f,  0.28f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f,  0.34f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    -0.06f,  0.34f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
+    // Desna strana kose
+     0.07f,  0.28f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+     0.06f,  0.34f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.06f,  0.34f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
+     0.07f,  0.28f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
+    // Zadnji deo kose
+    -0.06f,  0.30f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+    -0.06f,  0.34f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.06f,  0.34f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
+     0.06f,  0.30f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
+};
+
+// KAPICA (za kontrolora) - policijska šilterica
+static const float CAP_VERTICES[] = {
+    // Vrh kapice (glavni deo)
+    -0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+     0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
+     0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+    -0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
+    // Prednja strana kapice
+    -0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    -0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+     0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+     0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+    // Šilterica (štitnik kapice)
+    -0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
+     0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    -0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
+    // Donji deo štitnika
+    -0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
+     0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+    -0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
+};
+
+template <size_t N>
+static void appendVertices(const float (&vertices)[N], std::vector<float>& out) {
+    out.insert(out.end(), vertices, vertices + N);
+}
+
+void buildCabinVertices(std::vector<float>& out) {
+    out.clear();
+    appendVertices(CABIN_VERTICES, out);
+}
+
+void buildHumanoidVertices(std::vector<float>& out) {
+    out.clear();
+    appendVertices(HEAD_VERTICES, out);
+    appendVertices(TORSO_VERTICES, out);
+    appendVertices(LEFT_ARM_VERTICES, out);
+    appendVertices(RIGHT_ARM_VERTICES, out);
+    appendVertices(LEFT_LEG_VERTICES, out);
+    appendVertices(RIGHT_LEG_VERTICES, out);
+}
+
+void buildHairVertices(std::vector<float>& out) {
+    out.clear();
+    appendVertices(HAIR_VERTICES, out);
+}
+
+void buildCapVertices(std::vector<float>& out) {
+    out.clear();
+    appendVertices(CAP_VERTICES, out);
+}
+
+void appendQuadsAsTriangles(const float* quads, int quadCount, std::vector<float>& out) {
+    static const int fan[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int q = 0; q < quadCount; q++) {
+        const float* v = quads + q * 4 * VERTEX_3D_FLOATS;
+        for (int k : fan) {
+            out.insert(out.end(), v + k * VERTEX_3D_FLOATS, v + (k + 1) * VERTEX_3D_FLOATS);
+        }
+    }
+}
+
+// ========== SVETLA DUZ PUTA ==========
+void buildRouteLights(float stationOffsetZ, float stationDistance, float roadLength, double time,
+                      int count, std::vector<PointLight>& out) {
+    out.clear();
+    if (count <= 0) return;
+    out.reserve(count);
+
+    const float groundY = -1.2f;
+
+    // Nadstresnice: ista pozicija kao modeli stanica u petlji za crtanje (x = 6)
+    int shelters = std::min(count, (int)(roadLength / stationDistance));
+    for (int i = 0; i < shelters; i++) {
+        PointLight light;
+        light.position = glm::vec3(6.0f, groundY + 2.3f, stationOffsetZ - i * stationDistance);
+        light.radius = 5.0f;
+        light.color = glm::vec3(1.6f, 1.35f, 0.9f);
+        out.push_back(light);
+    }
+
+    // Vozila iz suprotnog smera (levo od linije), po dva fara
+    int remaining = count - shelters;
+    int cars = std::min(remaining / 2, remaining / 6 + 1);
+    const float carSpeed = 14.0f;
+    float carSpan = roadLength + 50.0f;
+    for (int i = 0; i < cars && (int)out.size() + 2 <= count; i++) {
+        float travelled = (float)std::fmod(time * carSpeed + (double)i * carSpan / cars, (double)carSpan);
+        float z = -roadLength + travelled;
+        for (int side = -1; side <= 1; side += 2) {
+            PointLight light;
+            light.position = glm::vec3(-3.5f + side * 0.7f, groundY + 0.6f, z);
+            light.radius = 9.0f;
+            light.color = glm::vec3(1.8f, 1.9f, 2.0f);
+            out.push_back(light);
+        }
+    }
+
+    // Ulicne lampe naizmenicno levo i desno; pomeraju se zajedno sa stanicama
+    int lamps = count - (int)out.size();
+    if (lamps <= 0) return;
+    float spacing = 2.0f * roadLength / lamps;
+    float phase = std::fmod(stationOffsetZ, spacing);
+    for (int i = 0; i < lamps; i++) {
+        PointLight light;
+        float x = (i % 2 == 0) ? 9.0f : -9.0f;
+        light.position = glm::vec3(x, groundY + 4.5f, phase - (i / 2) * spacing);
+        light.radius = 11.0f;
+        light.color = glm::vec3(1.4f, 1.1f, 0.7f);
+        out.push_back(light);
+    }
+}
+
+// ========== PUTNICI ==========
+glm::mat4 passengerModelMatrix(const glm::mat4& parent, const Passenger& p) {
+    glm::mat4 passengerModel = glm::translate(parent, p.position);
+
+    if (p.isMoving) {
+        glm::vec3 direction = glm::normalize(p.targetPosition - p.position);
+        float angle = atan2(direction.x, direction.z);
+        return glm::rotate(passengerModel, angle, glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+    return glm::rotate(passengerModel, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
@@ -0,0 +1,56 @@
+#include "../Header/GpuMemory.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+static double toMB(size_t bytes) {
+    return bytes / (1024.0 * 1024.0);
+}
+
+void GpuMemory::add(GpuMemoryCategory category, size_t bytes) {
+    current[category] += bytes;
+    objects[category]++;
+    highWater[category] = std::max(highWater[category], current[category]);
+    totalHighWater = std::max(totalHighWater, total());
+}
+
+void GpuMemory::remove(GpuMemoryCategory category, size_t bytes) {
+    current[category] -= std::min(bytes, current[category]);
+    objects[category]--;
+}
+
+void GpuMemory::resize(GpuMemoryCategory category, size_t from, size_t to) {
+    current[category] = current[category] - std::min(from, current[category]) + to;
+    highWater[category] = std::max(highWater[category], current[category]);
+    totalHighWater = std::max(totalHighWater, total());
+}
+
+size_t GpuMemory::total() const {
+    size_t sum = 0;
+    for (size_t bytes : current) sum += bytes;
+    return sum;
+}
+
+void GpuMemory::print() const {
+    char line[128];
+    std::cout << "GPU memorija (procena):" << std::endl;
+    for (int i = 0; i < GPU_MEMORY_CATEGORIES; i++) {
+        snprintf(line, sizeof(line), "  %-8s %4d objekata  %8.2f MB  (najvise %.2f MB)", categoryName((GpuMemoryCategory)i),
+                 objects[i], toMB(current[i]), toMB(highWater[i]));
+        std::cout << line << std::endl;
+    }
+    snprintf(line, sizeof(line), "  ukupno   %8.2f MB  (najvise %.2f MB)", toMB(total()), toMB(totalHighWater));
+    std::cout << line;
+    if (budget != 0) std::cout << ", budzet " << budget / (1024 * 1024) << " MB";
+    std::cout << ", izbaceno " << evictions << ", ponovo ucitano " << reloads << std::endl;
+}
+
+const char* GpuMemory::categoryName(GpuMemoryCategory category) {
+    switch (category) {
+    case GPU_MEMORY_TEXTURES: return "teksture";
+    case GPU_MEMORY_BUFFERS: return "baferi";
+    case GPU_MEMORY_TARGETS: return "ciljevi";
+    default: return "?";
+    }
+}
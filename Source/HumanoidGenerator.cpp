@@ -0,0 +1,243 @@
+#include "../Header/HumanoidGenerator.h"
+
+#include "../Header/Geometry.h"
+
+// Delovi osnovnog humanoida u kvadrima (Geometry.h)
+static const int HEAD_QUADS = 6;
+static const int TORSO_FIRST = 6, TORSO_QUADS = 6;
+static const int LEFT_ARM_FIRST = 12, RIGHT_ARM_FIRST = 16, ARM_QUADS = 4;
+static const int LEFT_LEG_FIRST = 20, RIGHT_LEG_FIRST = 24, LEG_QUADS = 4;
+
+static const float HIP_Y = -0.05f;          // Zglob kuka
+static const float SHOULDER_Y = 0.17f;      // Vrh trupa; glava i kosa se samo podizu
+static const float ARM_TOP_Y = 0.16f;
+static const float ARM_CENTER_X = 0.105f;
+static const float LEG_CENTER_X = 0.04f;
+static const float TORSO_CENTER_Z = 0.01f;
+static const float TORSO_HALF_WIDTH = 0.09f;
+
+static const float HAIR_COLOR[3] = { 0.2f, 0.15f, 0.1f };
+
+// ========== PARAMETRI ==========
+int clampHumanoidVariant(int variant) {
+    return (variant >= 0 && variant < HUMANOID_VARIANTS) ? variant : 0;
+}
+
+HumanoidParams defaultHumanoidParams() {
+    HumanoidParams p;
+    p.height = 1.0f;
+    p.build = 1.0f;
+    p.hair = HAIR_SHORT;
+    p.cap = false;
+    return p;
+}
+
+HumanoidParams humanoidVariantParams(int variant) {
+    variant = clampHumanoidVariant(variant);
+    HumanoidParams p;
+    if (variant == INSPECTOR_VARIANT) {
+        p.height = 1.05f;
+        p.build = 1.1f;
+        p.hair = HAIR_SHORT;
+        p.cap = true;
+        return p;
+    }
+    // 5 frizura x 3 gradje; visina se menja nezavisno, da ista gradja nema uvek istu visinu
+    static const float BUILDS[3] = { 0.85f, 1.0f, 1.2f };
+    static const float HEIGHTS[3] = { 0.9f, 1.0f, 1.1f };
+    int build = variant / HAIR_STYLES;
+    p.hair = (HairStyle)(variant % HAIR_STYLES);
+    p.build = BUILDS[build];
+    p.height = HEIGHTS[(variant + build) % 3];
+    p.cap = false;
+    return p;
+}
+
+// ========== SKELET ==========
+// Zglobovi prate shapeVertex: rame se penje sa visinom i siri sa gradjom, vrat ide uz glavu
+void buildHumanoidSkeleton(const HumanoidParams& p, Skeleton& out) {
+    static const int parents[HUMANOID_BONES] = { -1, BONE_PELVIS, BONE_SPINE, BONE_SPINE, BONE_SPINE, BONE_PELVIS, BONE_PELVIS };
+    for (int b = 0; b < HUMANOID_BONES; b++) out.parent[b] = parents[b];
+
+    float shoulderY = HIP_Y + (ARM_TOP_Y - HIP_Y) * p.height;
+    float shoulderX = ARM_CENTER_X + TORSO_HALF_WIDTH * (p.build - 1.0f);
+    out.pivot[BONE_PELVIS] = glm::vec3(0.0f, HIP_Y, TORSO_CENTER_Z);
+    out.pivot[BONE_SPINE] = glm::vec3(0.0f, HIP_Y, TORSO_CENTER_Z);
+    out.pivot[BONE_HEAD] = glm::vec3(0.0f, HIP_Y + (SHOULDER_Y - HIP_Y) * p.height, 0.0f);
+    out.pivot[BONE_LEFT_ARM] = glm::vec3(-shoulderX, shoulderY, 0.0f);
+    out.pivot[BONE_RIGHT_ARM] = glm::vec3(shoulderX, shoulderY, 0.0f);
+    out.pivot[BONE_LEFT_LEG] = glm::vec3(-LEG_CENTER_X, HIP_Y, TORSO_CENTER_Z);
+    out.pivot[BONE_RIGHT_LEG] = glm::vec3(LEG_CENTER_X, HIP_Y, TORSO_CENTER_Z);
+}
+
+// ========== OBLIK ==========
+enum BodyRegion { REGION_HEAD, REGION_TORSO, REGION_ARM, REGION_LEG };
+
+static void shapeVertex(float* v, BodyRegion region, const HumanoidParams& p) {
+    float& x = v[0];
+    float& y = v[1];
+    float& z = v[2];
+    switch (region) {
+    case REGION_HEAD:
+        y += (SHOULDER_Y - HIP_Y) * (p.height - 1.0f);
+        break;
+    case REGION_TORSO:
+        x *= p.build;
+        z = TORSO_CENTER_Z + (z - TORSO_CENTER_Z) * (1.0f + (p.build - 1.0f) * 0.5f);
+        y = HIP_Y + (y - HIP_Y) * p.height;
+        break;
+    case REGION_ARM:
+        x += (x < 0.0f ? -1.0f : 1.0f) * TORSO_HALF_WIDTH * (p.build - 1.0f);
+        y = HIP_Y + (y - HIP_Y) * p.height;
+        break;
+    case REGION_LEG:
+        break;
+    }
+}
+
+// Kvadar kao 6 kvadara, CCW gledano spolja (kao ostala geometrija)
+static void appendBox(float x0, float y0, float z0, float x1, float y1, float z1, std::vector<float>& out) {
+    const float corners[6][4][3] = {
+        { { x0, y0, z1 }, { x1, y0, z1 }, { x1, y1, z1 }, { x0, y1, z1 } },     // +z
+        { { x1, y0, z0 }, { x0, y0, z0 }, { x0, y1, z0 }, { x1, y1, z0 } },     // -z
+        { { x0, y0, z0 }, { x0, y0, z1 }, { x0, y1, z1 }, { x0, y1, z0 } },     // -x
+        { { x1, y0, z1 }, { x1, y0, z0 }, { x1, y1, z0 }, { x1, y1, z1 } },     // +x
+        { { x0, y1, z1 }, { x1, y1, z1 }, { x1, y1, z0 }, { x0, y1, z0 } },     // +y
+        { { x0, y0, z0 }, { x1, y0, z0 }, { x1, y0, z1 }, { x0, y0, z1 } },     // -y
+    };
+    const float normals[6][3] = { { 0, 0, 1 }, { 0, 0, -1 }, { -1, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 } };
+    const float uvs[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    for (int face = 0; face < 6; face++) {
+        for (int k = 0; k < 4; k++) {
+            const float* c = corners[face][k];
+            out.insert(out.end(), { c[0], c[1], c[2], HAIR_COLOR[0], HAIR_COLOR[1], HAIR_COLOR[2], 1.0f,
+                                    uvs[k][0], uvs[k][1], normals[face][0], normals[face][1], normals[face][2] });
+        }
+    }
+}
+
+static void buildHeadwear(const HumanoidParams& p, const std::vector<float>& hair, const std::vector<float>& cap,
+                          std::vector<float>& out) {
+    out.clear();
+    if (p.cap) {
+        out = cap;
+        return;
+    }
+    switch (p.hair) {
+    case HAIR_SHORT:
+        out = hair;
+        break;
+    case HAIR_LONG:
+        // Kosa pada niz potiljak do ramena
+        out = hair;
+        appendBox(-0.068f, 0.16f, -0.092f, 0.068f, 0.33f, -0.075f, out);
+        break;
+    case HAIR_BALD:
+        break;
+    case HAIR_MOHAWK:
+        appendBox(-0.012f, 0.29f, -0.075f, 0.012f, 0.37f, 0.075f, out);
+        break;
+    case HAIR_BUN:
+        out = hair;
+        appendBox(-0.03f, 0.30f, -0.115f, 0.03f, 0.36f, -0.075f, out);
+        break;
+    default:
+        out = hair;
+        break;
+    }
+}
+
+// ========== PECENJE ==========
+// Dodaje kvadre kao 4 temena + 6 indeksa (isti trouglovi kao TRIANGLE_FAN); indeksi su
+// relativni na pocetak varijante
+static void appendPart(const float* quads, int firstQuad, int quadCount, BodyRegion region, HumanoidBone bone,
+                       const HumanoidParams& p, int baseVertex, HumanoidMeshes& out) {
+    static const int fan[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int q = firstQuad; q < firstQuad + quadCount; q++) {
+        uint32_t first = (uint32_t)(out.vertices.size() / VERTEX_3D_FLOATS - baseVertex);
+        for (int k = 0; k < 4; k++) {
+            const float* src = quads + (q * 4 + k) * VERTEX_3D_FLOATS;
+            size_t at = out.vertices.size();
+            out.vertices.insert(out.vertices.end(), src, src + VERTEX_3D_FLOATS);
+            shapeVertex(&out.vertices[at], region, p);
+            out.bones.push_back((float)bone);
+        }
+        for (int k : fan) out.indices.push_back(first + k);
+    }
+}
+
+struct HumanoidSources {
+    std::vector<float> body, hair, cap;
+};
+
+static void loadSources(HumanoidSources& src) {
+    buildHumanoidVertices(src.body);
+    buildHairVertices(src.hair);
+    buildCapVertices(src.cap);
+}
+
+static void appendVariant(const HumanoidSources& src, const HumanoidParams& p, HumanoidVariant& variant, HumanoidMeshes& out) {
+    variant.params = p;
+    buildHumanoidSkeleton(p, variant.skeleton);
+    variant.baseVertex = (int)(out.vertices.size() / VERTEX_3D_FLOATS);
+    int base = variant.baseVertex;
+    const float* body = src.body.data();
+
+    auto beginPart = [&](HumanoidPart part) { variant.parts[part].first = (int)out.indices.size(); };
+    auto endPart = [&](HumanoidPart part) {
+        variant.parts[part].count = (int)out.indices.size() - variant.parts[part].first;
+    };
+
+    beginPart(HUMANOID_SKIN);
+    appendPart(body, 0, HEAD_QUADS, REGION_HEAD, BONE_HEAD, p, base, out);
+    endPart(HUMANOID_SKIN);
+
+    beginPart(HUMANOID_SHIRT);
+    appendPart(body, TORSO_FIRST, TORSO_QUADS, REGION_TORSO, BONE_SPINE, p, base, out);
+    appendPart(body, LEFT_ARM_FIRST, ARM_QUADS, REGION_ARM, BONE_LEFT_ARM, p, base, out);
+    appendPart(body, RIGHT_ARM_FIRST, ARM_QUADS, REGION_ARM, BONE_RIGHT_ARM, p, base, out);
+    endPart(HUMANOID_SHIRT);
+
+    beginPart(HUMANOID_LEFT_LEG);
+    appendPart(body, LEFT_LEG_FIRST, LEG_QUADS, REGION_LEG, BONE_LEFT_LEG, p, base, out);
+    endPart(HUMANOID_LEFT_LEG);
+
+    beginPart(HUMANOID_RIGHT_LEG);
+    appendPart(body, RIGHT_LEG_FIRST, LEG_QUADS, REGION_LEG, BONE_RIGHT_LEG, p, base, out);
+    endPart(HUMANOID_RIGHT_LEG);
+
+    std::vector<float> headwear;
+    buildHeadwear(p, src.hair, src.cap, headwear);
+    beginPart(HUMANOID_HEADWEAR);
+    appendPart(headwear.data(), 0, (int)(headwear.size() / (4 * VERTEX_3D_FLOATS)), REGION_HEAD, BONE_HEAD, p, base, out);
+    endPart(HUMANOID_HEADWEAR);
+
+    variant.vertexCount = (int)(out.vertices.size() / VERTEX_3D_FLOATS) - base;
+}
+
+void buildHumanoidVariants(HumanoidMeshes& out) {
+    HumanoidSources src;
+    loadSources(src);
+
+    out.vertices.clear();
+    out.bones.clear();
+    out.indices.clear();
+    for (int i = 0; i < HUMANOID_VARIANTS; i++) {
+        appendVariant(src, humanoidVariantParams(i), out.variants[i], out);
+    }
+}
+
+void buildHumanoidTriangles(const HumanoidParams& params, std::vector<float>& vertices, std::vector<float>& bones) {
+    HumanoidSources src;
+    loadSources(src);
+    HumanoidMeshes mesh;
+    appendVariant(src, params, mesh.variants[0], mesh);
+
+    vertices.clear();
+    bones.clear();
+    for (uint32_t index : mesh.indices) {
+        const float* v = &mesh.vertices[index * VERTEX_3D_FLOATS];
+        vertices.insert(vertices.end(), v, v + VERTEX_3D_FLOATS);
+        bones.push_back(mesh.bones[index]);
+    }
+}
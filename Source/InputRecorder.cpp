@@ -0,0 +1,134 @@
+#include "../Header/InputRecorder.h"
+
+#include <cstring>
+#include <iostream>
+
+static const char INPUT_MAGIC[4] = { 'K', 'I', 'N', 'P' };
+static const uint32_t INPUT_VERSION = 1;
+static const size_t INPUT_FLUSH_EVENTS = 1024;
+
+// Kodovi tastera su isti kao GLFW_KEY_* (ASCII za slova i cifre)
+static const uint16_t KEY_CODE_K = 'K';
+static const uint16_t KEY_CODE_1 = '1';
+
+struct InputFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t seed;
+};
+
+// ========== SNIMANJE ==========
+InputRecorder::~InputRecorder() {
+    close();
+}
+
+bool InputRecorder::open(const char* path, uint64_t seed) {
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Snimanje ulaza: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    InputFileHeader header;
+    memcpy(header.magic, INPUT_MAGIC, sizeof(INPUT_MAGIC));
+    header.version = INPUT_VERSION;
+    header.seed = seed;
+    file.write((const char*)&header, sizeof(header));
+    pending.reserve(INPUT_FLUSH_EVENTS);
+    return true;
+}
+
+void InputRecorder::push(uint32_t frame, float time, uint16_t type, uint16_t key, float x, float y) {
+    InputEvent e;
+    e.frame = frame;
+    e.time = time;
+    e.type = type;
+    e.key = key;
+    e.x = x;
+    e.y = y;
+    pending.push_back(e);
+}
+
+void InputRecorder::recordFrame(uint32_t frame, float time, const FrameInput& input) {
+    if (!file.is_open()) return;
+
+    if (input.leftClick) push(frame, time, INPUT_LEFT_CLICK, 0, 0.0f, 0.0f);
+    if (input.rightClick) push(frame, time, INPUT_RIGHT_CLICK, 0, 0.0f, 0.0f);
+    if (input.keyK) push(frame, time, INPUT_KEY, KEY_CODE_K, 0.0f, 0.0f);
+    for (int i = 0; i < 4; i++) {
+        if (input.numberKeys[i]) push(frame, time, INPUT_KEY, (uint16_t)(KEY_CODE_1 + i), 0.0f, 0.0f);
+    }
+    if (input.mouseDx != 0.0f || input.mouseDy != 0.0f) push(frame, time, INPUT_MOUSE_DELTA, 0, input.mouseDx, input.mouseDy);
+    if (input.scroll != 0.0f) push(frame, time, INPUT_SCROLL, 0, 0.0f, input.scroll);
+    push(frame, time, INPUT_FRAME_TICK, 0, input.dt, 0.0f);
+
+    if (pending.size() >= INPUT_FLUSH_EVENTS) {
+        flush();
+    }
+}
+
+void InputRecorder::flush() {
+    if (!pending.empty()) {
+        file.write((const char*)pending.data(), pending.size() * sizeof(InputEvent));
+        pending.clear();
+    }
+}
+
+void InputRecorder::close() {
+    if (file.is_open()) {
+        flush();
+        file.close();
+    }
+}
+
+// ========== REPRODUKCIJA ==========
+bool InputReplayer::open(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Reprodukcija ulaza: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    InputFileHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file || memcmp(header.magic, INPUT_MAGIC, sizeof(INPUT_MAGIC)) != 0 || header.version != INPUT_VERSION) {
+        std::cout << "Reprodukcija ulaza: \"" << path << "\" nije ispravan snimak!" << std::endl;
+        return false;
+    }
+    seed = header.seed;
+
+    file.seekg(0, std::ios::end);
+    size_t bytes = (size_t)file.tellg() - sizeof(header);
+    file.seekg(sizeof(header), std::ios::beg);
+    events.resize(bytes / sizeof(InputEvent));
+    file.read((char*)events.data(), events.size() * sizeof(InputEvent));
+
+    cursor = 0;
+    frames = 0;
+    for (const auto& e : events) {
+        if (e.type == INPUT_FRAME_TICK) frames++;
+    }
+    return true;
+}
+
+bool InputReplayer::nextFrame(FrameInput& out) {
+    out = FrameInput();
+
+    while (cursor < events.size()) {
+        const InputEvent& e = events[cursor++];
+        switch (e.type) {
+        case INPUT_LEFT_CLICK: out.leftClick = true; break;
+        case INPUT_RIGHT_CLICK: out.rightClick = true; break;
+        case INPUT_KEY:
+            if (e.key == KEY_CODE_K) out.keyK = true;
+            else if (e.key >= KEY_CODE_1 && e.key < KEY_CODE_1 + 4) out.numberKeys[e.key - KEY_CODE_1] = true;
+            break;
+        case INPUT_MOUSE_DELTA: out.mouseDx += e.x; out.mouseDy += e.y; break;
+        case INPUT_SCROLL: out.scroll += e.y; break;
+        case INPUT_FRAME_TICK:
+            out.dt = e.x;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,75 @@
+#include "../Header/JobSystem.h"
+
+#include <algorithm>
+
+// ========== NITI ==========
+void JobSystem::init(int threads) {
+    destroy();
+    quitting = false;
+    int total = threads > 0 ? threads : (int)std::thread::hardware_concurrency();
+    for (int i = 1; i < total; i++) workers.emplace_back(&JobSystem::workerLoop, this, generation);
+}
+
+void JobSystem::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        quitting = true;
+    }
+    startCondition.notify_all();
+    for (std::thread& t : workers) t.join();
+    workers.clear();
+}
+
+void JobSystem::workerLoop(uint64_t seen) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            startCondition.wait(lock, [&]() { return quitting || generation != seen; });
+            if (quitting) return;
+            seen = generation;
+        }
+        runBatches();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busyWorkers--;
+        }
+        doneCondition.notify_one();
+    }
+}
+
+void JobSystem::runBatches() {
+    int batches = (count + batchSize - 1) / batchSize;
+    for (int b = nextBatch++; b < batches; b = nextBatch++) {
+        int first = b * batchSize;
+        (*body)(first, std::min(count, first + batchSize));
+    }
+}
+
+// ========== PETLJA ==========
+void JobSystem::parallelFor(int count, int batchSize, const std::function<void(int, int)>& body) {
+    if (count <= 0) return;
+    batchSize = std::max(1, batchSize);
+    bool idle = false;
+    if (workers.empty() || count <= batchSize || !dispatching.compare_exchange_strong(idle, true)) {
+        body(0, count);
+        return;
+    }
+
+    this->body = &body;
+    this->count = count;
+    this->batchSize = batchSize;
+    nextBatch = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        busyWorkers = (int)workers.size();
+        generation++;
+    }
+    startCondition.notify_all();
+    runBatches();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [&]() { return busyWorkers == 0; });
+    }
+    this->body = nullptr;
+    dispatching.store(false);
+}
@@ -0,0 +1,213 @@
+#include "../Header/LightBaker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../Header/Geometry.h"
+#include "../Header/JobSystem.h"
+#include "../Header/Random.h"
+
+static int roundUpPow2(int v) {
+    int p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+// Bilinearna interpolacija po uglovima kvadra (0,0) (1,0) (1,1) (0,1), redom temena u fan-u
+static glm::vec3 quadPoint(const glm::vec3* c, float s, float t) {
+    return (1.0f - s) * (1.0f - t) * c[0] + s * (1.0f - t) * c[1] + s * t * c[2] + (1.0f - s) * t * c[3];
+}
+
+// ========== ULAZ ==========
+int LightBaker::addMesh(const float* vertices, int quadCount, const glm::mat4& model,
+                        const BakeLight& light, const BakeMaterial& material) {
+    Mesh mesh;
+    mesh.light = light;
+    mesh.material = material;
+    mesh.firstQuad = (int)quads.size();
+    mesh.quadCount = quadCount;
+    meshes.push_back(mesh);
+
+    glm::mat3 normalMatrix = glm::mat3(glm::transpose(glm::inverse(model)));
+    for (int q = 0; q < quadCount; q++) {
+        Quad quad;
+        for (int k = 0; k < 4; k++) {
+            const float* v = vertices + (q * 4 + k) * VERTEX_3D_FLOATS;
+            quad.p[k] = glm::vec3(model * glm::vec4(v[0], v[1], v[2], 1.0f));
+            quad.n[k] = normalMatrix * glm::vec3(v[10], v[11], v[12]);
+        }
+        quad.boundsMin = glm::min(glm::min(quad.p[0], quad.p[1]), glm::min(quad.p[2], quad.p[3]));
+        quad.boundsMax = glm::max(glm::max(quad.p[0], quad.p[1]), glm::max(quad.p[2], quad.p[3]));
+        quad.boundsMin -= glm::vec3(1e-4f);    // Ravni kvadri imaju granice debljine 0
+        quad.boundsMax += glm::vec3(1e-4f);
+        quad.mesh = (int)meshes.size() - 1;
+        quad.resU = quad.resV = 0;
+        quad.x = quad.y = 0;
+        quads.push_back(quad);
+    }
+    return (int)meshes.size() - 1;
+}
+
+// ========== ATLAS ==========
+// Plocice su stepeni dvojke, slazu se u redove po opadajucoj visini. UV temena pokazuju na
+// centre ivicnih texela plocice, pa bilinearno filtriranje nikad ne cita susednu plocicu.
+void LightBaker::packAtlas(const BakeSettings& settings) {
+    std::vector<int> order(quads.size());
+    for (size_t i = 0; i < quads.size(); i++) {
+        Quad& q = quads[i];
+        float lenU = glm::length(q.p[1] - q.p[0]);
+        float lenV = glm::length(q.p[3] - q.p[0]);
+        q.resU = std::max(settings.minResolution, std::min(settings.maxResolution, roundUpPow2((int)std::ceil(lenU * settings.texelsPerUnit))));
+        q.resV = std::max(settings.minResolution, std::min(settings.maxResolution, roundUpPow2((int)std::ceil(lenV * settings.texelsPerUnit))));
+        order[i] = (int)i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return quads[a].resV > quads[b].resV; });
+
+    width = std::max(settings.atlasWidth, settings.maxResolution);
+    int x = 0, y = 0, rowHeight = 0;
+    for (int i : order) {
+        Quad& q = quads[i];
+        if (x + q.resU > width) {
+            x = 0;
+            y += rowHeight;
+            rowHeight = 0;
+        }
+        q.x = x;
+        q.y = y;
+        x += q.resU;
+        rowHeight = std::max(rowHeight, q.resV);
+    }
+    height = y + rowHeight;
+
+    static const float corners[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    for (Mesh& mesh : meshes) {
+        mesh.uvs.resize(mesh.quadCount * 4 * 2);
+        for (int qi = 0; qi < mesh.quadCount; qi++) {
+            const Quad& q = quads[mesh.firstQuad + qi];
+            for (int k = 0; k < 4; k++) {
+                mesh.uvs[(qi * 4 + k) * 2] = (q.x + 0.5f + corners[k][0] * (q.resU - 1)) / width;
+                mesh.uvs[(qi * 4 + k) * 2 + 1] = (q.y + 0.5f + corners[k][1] * (q.resV - 1)) / height;
+            }
+        }
+    }
+}
+
+// ========== ZRACI ==========
+// Moller-Trumbore za oba trougla fan-a; kvadri se prvo proveravaju granicama
+bool LightBaker::occluded(const std::vector<int>& candidates, const glm::vec3& origin, const glm::vec3& dir, float maxDistance) const {
+    glm::vec3 invDir = 1.0f / dir;
+    for (int index : candidates) {
+        const Quad& q = quads[index];
+        glm::vec3 t0 = (q.boundsMin - origin) * invDir;
+        glm::vec3 t1 = (q.boundsMax - origin) * invDir;
+        glm::vec3 tNear = glm::min(t0, t1), tFar = glm::max(t0, t1);
+        float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxDistance));
+        if (enter > exit) continue;
+
+        for (int tri = 0; tri < 2; tri++) {
+            const glm::vec3& a = q.p[0];
+            const glm::vec3& b = q.p[tri + 1];
+            const glm::vec3& c = q.p[tri + 2];
+            glm::vec3 e1 = b - a, e2 = c - a;
+            glm::vec3 pv = glm::cross(dir, e2);
+            float det = glm::dot(e1, pv);
+            if (std::fabs(det) < 1e-8f) continue;
+            float invDet = 1.0f / det;
+            glm::vec3 tv = origin - a;
+            float u = glm::dot(tv, pv) * invDet;
+            if (u < 0.0f || u > 1.0f) continue;
+            glm::vec3 qv = glm::cross(tv, e1);
+            float v = glm::dot(dir, qv) * invDet;
+            if (v < 0.0f || u + v > 1.0f) continue;
+            float t = glm::dot(e2, qv) * invDet;
+            if (t > 1e-4f && t < maxDistance) return true;
+        }
+    }
+    return false;
+}
+
+// Udeo neprekrivenih zraka u hemisferi oko normale (kosinusna raspodela). Zraci se testiraju
+// samo protiv kvadara cije granice su na manje od aoDistance - vecina puta nema nijedan.
+float LightBaker::ambientOcclusion(int quadIndex, const glm::vec3& origin, const glm::vec3& normal, uint64_t seed,
+                                   const BakeSettings& settings, std::vector<int>& candidates) const {
+    candidates.clear();
+    float reach2 = settings.aoDistance * settings.aoDistance;
+    for (size_t i = 0; i < quads.size(); i++) {
+        if ((int)i == quadIndex) continue;      // Ravan kvadar ne zaklanja sam sebe
+        glm::vec3 closest = glm::clamp(origin, quads[i].boundsMin, quads[i].boundsMax);
+        glm::vec3 d = closest - origin;
+        if (glm::dot(d, d) <= reach2) candidates.push_back((int)i);
+    }
+    if (candidates.empty()) return 1.0f;
+
+    glm::vec3 tangent = std::fabs(normal.x) > 0.9f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+    tangent = glm::normalize(glm::cross(tangent, normal));
+    glm::vec3 bitangent = glm::cross(normal, tangent);
+    glm::vec3 start = origin + normal * 1e-3f;
+
+    Pcg32 rng(seed);
+    int open = 0;
+    for (int i = 0; i < settings.aoRays; i++) {
+        float r = std::sqrt(rng.nextFloat());
+        float phi = 6.2831853f * rng.nextFloat();
+        float z = std::sqrt(std::max(0.0f, 1.0f - r * r));
+        glm::vec3 dir = tangent * (r * std::cos(phi)) + bitangent * (r * std::sin(phi)) + normal * z;
+        if (!occluded(candidates, start, dir, settings.aoDistance)) open++;
+    }
+    return (float)open / settings.aoRays;
+}
+
+// ========== PECENJE ==========
+void LightBaker::bakeRow(int quadIndex, int row, const BakeSettings& settings) {
+    const Quad& q = quads[quadIndex];
+    const Mesh& mesh = meshes[q.mesh];
+    const BakeLight& L = mesh.light;
+    const BakeMaterial& M = mesh.material;
+
+    std::vector<int> candidates;
+    float t = q.resV > 1 ? (float)row / (q.resV - 1) : 0.0f;
+    float* out = &texels[((size_t)(q.y + row) * width + q.x) * 3];
+    for (int col = 0; col < q.resU; col++) {
+        float s = q.resU > 1 ? (float)col / (q.resU - 1) : 0.0f;
+        glm::vec3 pos = quadPoint(q.p, s, t);
+        glm::vec3 norm = glm::normalize(quadPoint(q.n, s, t));
+
+        // Isto kao basic3d.frag
+        glm::vec3 lightDir = glm::normalize(L.position - pos);
+        glm::vec3 ambient = L.kA * M.kA;
+        float nD = std::max(glm::dot(norm, lightDir), 0.0f);
+        glm::vec3 diffuse = L.kD * (nD * M.kD);
+        glm::vec3 viewDir = glm::normalize(settings.viewPos - pos);
+        glm::vec3 reflectDir = glm::reflect(-lightDir, norm);
+        float sp = std::pow(std::max(glm::dot(viewDir, reflectDir), 0.0f), M.shine);
+        glm::vec3 specular = L.kS * (sp * M.kS);
+
+        if (settings.aoRays > 0) {
+            uint64_t seed = ((uint64_t)quadIndex << 40) ^ ((uint64_t)row << 20) ^ (uint64_t)col;
+            ambient *= ambientOcclusion(quadIndex, pos, norm, seed, settings, candidates);
+        }
+
+        glm::vec3 lighting = ambient + diffuse + specular;
+        out[col * 3] = lighting.r;
+        out[col * 3 + 1] = lighting.g;
+        out[col * 3 + 2] = lighting.b;
+    }
+}
+
+void LightBaker::bake(const BakeSettings& settings) {
+    packAtlas(settings);
+    texels.assign((size_t)width * height * 3, 0.0f);
+
+    // Posao je red texela jedne plocice; redovi su razlicite cene (AO), pa je serija jedan red
+    std::vector<std::pair<int, int>> rows;
+    for (size_t i = 0; i < quads.size(); i++) {
+        for (int r = 0; r < quads[i].resV; r++) rows.push_back(std::make_pair((int)i, r));
+    }
+
+    auto bakeRows = [&](int first, int last) {
+        for (int i = first; i < last; i++) bakeRow(rows[i].first, rows[i].second, settings);
+    };
+    if (settings.jobs != nullptr) settings.jobs->parallelFor((int)rows.size(), 1, bakeRows);
+    else bakeRows(0, (int)rows.size());
+}
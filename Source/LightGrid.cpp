@@ -0,0 +1,111 @@
+#include "../Header/LightGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+int LightGrid::sliceFor(float depth) const {
+    if (depth <= LIGHT_GRID_NEAR) return 0;
+    int slice = 1 + (int)(std::log(depth / LIGHT_GRID_NEAR) * scale);
+    return std::min(slice, LIGHT_GRID_Z - 1);
+}
+
+float LightGrid::sliceNearDepth(int slice, float zNear) const {
+    if (slice == 0) return zNear;
+    return LIGHT_GRID_NEAR * std::exp((slice - 1) / scale);
+}
+
+float LightGrid::sliceFarDepth(int slice) const {
+    if (slice == LIGHT_GRID_Z - 1) return std::numeric_limits<float>::infinity();
+    return LIGHT_GRID_NEAR * std::exp(slice / scale);
+}
+
+// Indeks plocice za NDC koordinatu [-1, 1]
+static int tileFor(float ndc, int tiles) {
+    int t = (int)std::floor((ndc * 0.5f + 0.5f) * tiles);
+    return std::max(0, std::min(t, tiles - 1));
+}
+
+// ========== RASPODELA ==========
+void LightGrid::build(const std::vector<PointLight>& lights, const glm::mat4& view,
+                      float fovY, float aspect, float zNear, float zFar) {
+    data.clear();
+    spans.clear();
+    counts.assign(LIGHT_GRID_CLUSTERS, 0);
+    scale = (LIGHT_GRID_Z - 1) / std::log(zFar / LIGHT_GRID_NEAR);
+
+    float projY = 1.0f / std::tan(fovY * 0.5f);
+    float projX = projY / aspect;
+
+    for (const PointLight& light : lights) {
+        // Kamera gleda niz -z, dubina je pozitivna
+        glm::vec3 v = glm::vec3(view * glm::vec4(light.position, 1.0f));
+        float depth = -v.z;
+        float r = light.radius;
+        if (depth + r < zNear || depth - r > zFar) continue;
+
+        uint32_t lightIndex = (uint32_t)(data.size() / 8);
+        bool touched = false;
+
+        int firstSlice = sliceFor(std::max(depth - r, zNear));
+        int lastSlice = sliceFor(depth + r);
+        for (int s = firstSlice; s <= lastSlice; s++) {
+            // Deo sfere unutar sloja; x/d i y/d su ekstremni u uglovima tog kvadra
+            float d0 = std::max(std::max(depth - r, sliceNearDepth(s, zNear)), zNear);
+            float d1 = std::min(depth + r, sliceFarDepth(s));
+            if (d1 < d0) continue;
+
+            float xMin = std::min((v.x - r) / d0, (v.x - r) / d1) * projX;
+            float xMax = std::max((v.x + r) / d0, (v.x + r) / d1) * projX;
+            float yMin = std::min((v.y - r) / d0, (v.y - r) / d1) * projY;
+            float yMax = std::max((v.y + r) / d0, (v.y + r) / d1) * projY;
+            if (xMax < -1.0f || xMin > 1.0f || yMax < -1.0f || yMin > 1.0f) continue;
+
+            Span span;
+            span.light = lightIndex;
+            span.slice = (uint8_t)s;
+            span.x0 = (uint8_t)tileFor(xMin, LIGHT_GRID_X);
+            span.x1 = (uint8_t)tileFor(xMax, LIGHT_GRID_X);
+            span.y0 = (uint8_t)tileFor(yMin, LIGHT_GRID_Y);
+            span.y1 = (uint8_t)tileFor(yMax, LIGHT_GRID_Y);
+            spans.push_back(span);
+            touched = true;
+
+            for (int y = span.y0; y <= span.y1; y++) {
+                uint32_t* row = &counts[(s * LIGHT_GRID_Y + y) * LIGHT_GRID_X];
+                for (int x = span.x0; x <= span.x1; x++) row[x]++;
+            }
+        }
+
+        if (touched) {
+            data.insert(data.end(), {
+                light.position.x, light.position.y, light.position.z, light.radius,
+                light.color.r, light.color.g, light.color.b, 0.0f
+            });
+        }
+    }
+
+    // Prefiksna suma -> pocetak liste svakog klastera (sa ogranicenjem duzine)
+    ranges.resize(LIGHT_GRID_CLUSTERS * 2);
+    uint32_t offset = 0;
+    for (int c = 0; c < LIGHT_GRID_CLUSTERS; c++) {
+        uint32_t n = std::min(counts[c], (uint32_t)LIGHT_GRID_MAX_PER_CLUSTER);
+        ranges[c * 2] = offset;
+        ranges[c * 2 + 1] = 0;
+        offset += n;
+    }
+
+    indices.resize(offset);
+    for (const Span& span : spans) {
+        for (int y = span.y0; y <= span.y1; y++) {
+            int cluster = (span.slice * LIGHT_GRID_Y + y) * LIGHT_GRID_X + span.x0;
+            for (int x = span.x0; x <= span.x1; x++, cluster++) {
+                uint32_t& n = ranges[cluster * 2 + 1];
+                if (n < LIGHT_GRID_MAX_PER_CLUSTER) {
+                    indices[ranges[cluster * 2] + n] = span.light;
+                    n++;
+                }
+            }
+        }
+    }
+}
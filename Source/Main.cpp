@@ -1,6 +1,7 @@
 ﻿#include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -12,127 +13,182 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "../Header/Util.h"
+#include "../Header/BusScene.h"
+#include "../Header/BusSimulation.h"
+#include "../Header/Checkpoint.h"
+#include "../Header/ClusteredLighting.h"
+#include "../Header/DynamicResolution.h"
+#include "../Header/Geometry.h"
+#include "../Header/GLRenderBackend.h"
+#include "../Header/HumanoidGenerator.h"
+#include "../Header/JobSystem.h"
+#include "../Header/LightBaker.h"
+#include "../Header/LightGrid.h"
+#include "../Header/PerfOverlay.h"
+#include "../Header/PerfReport.h"
+#include "../Header/ShaderCache.h"
+#include "../Header/SimThread.h"
+#include "../Header/SkeletalAnimation.h"
+#include "../Header/SoftwareRenderer.h"
+#include "../Header/TextureStreamer.h"
+#include "../Header/VideoRecorder.h"
+#include "../Header/InputRecorder.h"
 
 // ========== KONSTANTE ==========
 const float TARGET_FPS = 75.0f;
 const float FRAME_TIME = 1.0f / TARGET_FPS;
-const int NUM_STATIONS = 10;
-const float BUS_SPEED = 0.15f;
-const float STATION_WAIT_TIME = 10.0f;
-
-// ========== STRUKTURE ==========
-struct Vec2 {
-    float x, y;
-    Vec2(float x = 0, float y = 0) : x(x), y(y) {}
-};
-
-struct Station {
-    Vec2 position;
-    int number;
-};
-
-struct Passenger {
-    glm::vec3 position;
-    glm::vec3 targetPosition;
-    glm::vec3 finalPosition;
-    float moveSpeed;
-    bool isMoving;
-    int characterModel;
-    bool isInspector;
-    int waypointIndex;  // 0=start, 1=outside door, 2=in doorway, 3=inside, 4=final seat
-    
-    // Random boje za putnika
-    glm::vec3 shirtColor;
-    glm::vec3 pantsColor;
-    glm::vec3 hairColor;
-    
-    // Animacija hodanja
-    float walkAnimTime;
-    float legSwingAmount;
-    
-    Passenger() : position(0), targetPosition(0), finalPosition(0), moveSpeed(1.0f), 
-                  isMoving(false), characterModel(0), isInspector(false), waypointIndex(0),
-                  shirtColor(0.3f, 0.5f, 0.8f), pantsColor(0.2f, 0.2f, 0.6f), hairColor(0.2f, 0.15f, 0.1f),
-                  walkAnimTime(0.0f), legSwingAmount(0.15f) {}
-};
 
 // ========== GLOBALNE PROMENLJIVE ==========
 Station stations[NUM_STATIONS];
-int currentStation = 0;
-int nextStation = 1;
-float busProgress = 0.0f;
-bool busAtStation = true;
-float stationTimer = 0.0f;
-int passengers = 0;
-bool isInspectorInBus = false;
-int totalFines = 0;
-int inspectorExitStation = -1;
-
-bool leftMousePressed = false;
-bool rightMousePressed = false;
-bool keyKPressed = false;
-
-unsigned int pathVAO, pathVBO;
-unsigned int circleVAO, circleVBO;
-
-// 3D promenljive
+BusSimulation sim;
+SimThread simThread(sim, FRAME_TIME);
+
+// Jedine radne niti u programu: poze animacije i softversko crtanje (glavna nit), guzva
+// (nit simulacije) i pecenje osvetljenja pri ucitavanju
+JobSystem jobs;
+int jobThreads = 0;                     // --threads; 0 = svi procesori
+
+// Deterministicka simulacija: generator i vreme simulacije su u BusSimulation, korak na SimThread-u
+InputRecorder inputRecorder;
+InputReplayer inputReplayer;
+TelemetryWriter telemetryWriter;
+CheckpointWriter checkpointWriter;
+bool replayActive = false;
+
+// Crtanje: frejm se zapisuje u listu komandi koju izvrsava backend (resursi su indeksi u njemu)
+GLRenderBackend renderBackend;
+RenderCommandList frameCommands, overlayCommands;
+uint32_t shader2D, shader3D, shaderBaked;
+uint32_t quadMesh;                  // 2D pravougaonik sa indeksima (teksture na displeju)
+uint32_t pathMesh, circleMesh;
+// F10 ili --capture-at N - snimak liste komandi jednog frejma (Tools/RenderReplay.cpp)
+bool captureRequested = false;
+long long captureFrame = -1;
+const char* capturePath = "frame_capture.rcap";
+
+// 3D promenljive (kamera je u SimThread-u, jer se menja snimljenim ulazom)
 bool firstMouse = true;
 float lastX = 500.0f, lastY = 500.0f;
-float yaw = -90.0f, pitch = -5.0f;
-glm::vec3 cameraFront = glm::vec3(0.0, 0.0, -1.0);
-float fov = 60.0f;
 
 bool useTex = false;
 bool transparent = false;
-float doorOffset = 0.4f;
-bool doorOpening = false;
-bool doorClosing = false;
-const float doorSpeed = 0.02f;
-const float doorMaxOffset = 0.4f;
-
-float wheelRotation = 0.0f;
-const float wheelRotationSpeed = 2.0f;
-const float wheelMaxRotation = 45.0f;
-
-float busShakeOffset = 0.0f;
-float busShakeTime = 0.0f;
-const float busShakeSpeed = 3.0f;
-const float busShakeAmplitude = 0.005f;
-
-std::vector<Passenger> activePassengers;
-bool passengerEntering = false;
-bool passengerExiting = false;
-float passengerAnimTimer = 0.0f;
-const float passengerAnimDuration = 0.8f;
-
-bool depthTestEnabled = true;
-bool faceCullingEnabled = false;
-
-bool key1Pressed = false;
-bool key2Pressed = false;
-bool key3Pressed = false;
-bool key4Pressed = false;
-
-// Framebuffer za 2D display
-unsigned int displayFBO = 0;
-unsigned int displayTexture = 0;
-unsigned int displayRBO = 0;
+// Overlay performansi (F3)
+bool showPerfOverlay = false;
+FrameStats frameStats;
+PerfOverlay perfOverlay;
+// Brojaci GL poziva po frejmu i prolazu, budzet i JSON izvestaj (--perf-report)
+PerfReport perfReport;
+const char* perfReportPath = NULL;
+// Dinamicka rezolucija: 3D scena se crta u umanjen deo sceneTarget-a i razvlaci na ekran.
+// Sceni pripada deo frejma; ostatak je za displej, HUD, overlay i swap.
+DynamicResolution dynamicResolution;
+const float SCENE_BUDGET_MS = FRAME_TIME * 1000.0f * 0.75f;
+float fixedResolutionScale = -1.0f;     // --res-scale; < 0 = kontroler
+float minResolutionScale = 0.5f;
+uint32_t sceneTarget = RENDER_NONE;
+uint32_t sceneTimer = RENDER_NONE;
+
+// Cilj (framebuffer) za 2D display
+uint32_t displayTarget = 0;
 const int DISPLAY_WIDTH = 800;
 const int DISPLAY_HEIGHT = 600;
 
 // 3D svet - putanja i stanice
-unsigned int roadVAO, roadVBO;
-unsigned int station3DVAO, station3DVBO;
+uint32_t roadMesh, stationMesh;
 const float ROAD_LENGTH = 500.0f;  // Dužina puta ispred autobusa
 const float STATION_DISTANCE = 50.0f;  // Razmak između stanica
 
+// Guzva na peronu (simulacija je u sim.stationCrowd, instance stizu u snimku)
+uint32_t crowdMesh, crowdInstanceBuffer;
+int crowdVertexCount = 0;
+
+// Hijerarhija transformacija kabine, stanica, guzve i putnika (world matrice guzve idu u instance bafer)
+BusScene busScene;
+
+// Skeletna animacija: poze putnika pa guzve se racunaju u paletu kostiju (TBO)
+HumanoidMeshes passengerMeshes;
+Skeleton crowdSkeleton;
+std::vector<AnimatedAgent> animatedAgents;
+std::vector<float> bonePalette;
+uint32_t bonePaletteBuffer = RENDER_NONE, bonePaletteTexture = RENDER_NONE;
+
+// Posteri na stanicama (--poster): slika se strimuje kad stanica udje u vidokrug i
+// oslobadja kad je autobus prodje
+TextureStreamer textureStreamer;
+std::vector<std::string> posterPaths;
+size_t streamBudgetKB = 256;
+uint32_t posterMesh = RENDER_NONE;
+int posterHandles[NUM_STATIONS];
+
+// Nocna voznja: svetla duz puta kroz klasterovanu mrezu (0 = dnevno svetlo, bez mreze)
+int nightLightCount = 0;
+std::vector<PointLight> routeLights;
+LightGrid lightGrid;
+ClusteredLighting clusteredLighting;
+
+// Peceno osvetljenje statickih kvadara (put i kabina) - samo uz dnevno svetlo
+bool bakeLighting = true;
+int bakeAORays = 0;
+bool bakedLighting = false;
+uint32_t lightmapTexture = RENDER_NONE;
+const int LIGHTMAP_TEXTURE_UNIT = 4;    // 0 je uTex, 1-3 klasterovana svetla
+const int BONE_PALETTE_TEXTURE_UNIT = 5;
+
+// ========== VARIJANTE SEJDERA ==========
+// Bit i kljuca ukljucuje i-ti #define iz liste ispod (grane su u sejderu izbacene pri prevodjenju)
+enum Shader3DVariant {
+    SHADER3D_TEXTURED = 1 << 0,
+    SHADER3D_TRANSPARENT = 1 << 1,
+    SHADER3D_CUSTOM_COLOR = 1 << 2,
+    SHADER3D_INSPECTOR = 1 << 3,
+    SHADER3D_INSTANCED = 1 << 4,
+    SHADER3D_CLUSTERED_LIGHTS = 1 << 5,
+    SHADER3D_SKINNED = 1 << 6
+};
+enum Shader2DVariant {
+    SHADER2D_UNIFORM_COLOR = 1 << 0,
+    SHADER2D_VERTEX_COLOR = 1 << 1      // Bez ova dva bita boja je iz teksture
+};
+const std::vector<std::string> SHADER3D_DEFINES = { "TEXTURED", "TRANSPARENT", "CUSTOM_COLOR", "INSPECTOR", "INSTANCED", "CLUSTERED_LIGHTS", "SKINNED" };
+const std::vector<std::string> SHADER2D_DEFINES = { "UNIFORM_COLOR", "VERTEX_COLOR" };
+const char* SHADER_BINARY_CACHE_PREFIX = "shadercache_";
+
+ShaderCache shaders2D, shaders3D, shadersBaked;
+bool shaderBinaryCache = true;
+
+// Softversko crtanje (--software): scena se crta na CPU-u, GL samo prikazuje gotovu sliku
+bool softwareRendering = false;
+SoftwareRenderer softwareRenderer;
+uint32_t softwareTexture = RENDER_NONE;
+// F12 - snimak ekrana u PPM (uz GL putanju i poredjenje sa softverskim crtanjem)
+bool screenshotRequested = false;
+// F9 / --video - snimanje frejmova (sa overlay-em) kroz PBO prsten; F9 pauzira i nastavlja
+VideoRecorder videoRecorder;
+const char* videoPath = "video.y4m";
+bool videoRecording = false;
+bool videoToggleRequested = false;
+
 // ========== CALLBACK FUNKCIJE ==========
+// Ulaz koji menja simulaciju ide kao dogadjaj sa vremenskom oznakom u red niti simulacije;
+// ESC i F3 se ticu samo prozora/prikaza, pa se obradjuju odmah.
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
     if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) {
         glfwSetWindowShouldClose(window, true);
     }
-    if (key == GLFW_KEY_K && action == GLFW_PRESS) {
-        keyKPressed = true;
+    if (action == GLFW_PRESS && (key == GLFW_KEY_K || (key >= GLFW_KEY_1 && key <= GLFW_KEY_4))) {
+        simThread.inputQueue().push(INPUT_KEY, (uint16_t)key);
+    }
+    if (key == GLFW_KEY_F3 && action == GLFW_PRESS) {
+        showPerfOverlay = !showPerfOverlay;
+    }
+    if (key == GLFW_KEY_F12 && action == GLFW_PRESS) {
+        screenshotRequested = true;
+    }
+    if (key == GLFW_KEY_F10 && action == GLFW_PRESS) {
+        captureRequested = true;
+    }
+    if (key == GLFW_KEY_F9 && action == GLFW_PRESS) {
+        videoToggleRequested = true;
     }
     // UKLONJENA MANUALNA KONTROLA VRATA (O taster) - samo automatski rad
 }
@@ -144,396 +200,217 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos) {
         firstMouse = false;
     }
 
-    float xoffset = xpos - lastX;
-    float yoffset = lastY - ypos;
+    // Kameru okrece nit simulacije (da bi pomeraj mogao da se snimi)
+    float dx = (float)(xpos - lastX);
+    float dy = (float)(lastY - ypos);
     lastX = xpos;
     lastY = ypos;
-
-    float sensitivity = 0.1f;
-    xoffset *= sensitivity;
-    yoffset *= sensitivity;
-
-    yaw += xoffset;
-    pitch += yoffset;
-
-    if (yaw > 0.0f)
-        yaw = 0.0f;
-    if (yaw < -180.0f)
-        yaw = -180.0f;
-
-    if (pitch > 90.0f)
-        pitch = 90.0f;
-    if (pitch < -90.0f)
-        pitch = -90.0f;
-
-    glm::vec3 direction;
-    direction.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
-    direction.y = sin(glm::radians(pitch));
-    direction.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
-    cameraFront = glm::normalize(direction);
+    if (dx != 0.0f || dy != 0.0f) {
+        simThread.inputQueue().push(INPUT_MOUSE_DELTA, 0, dx, dy);
+    }
 }
 
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
-    fov -= (float)yoffset;
-    if (fov < 1.0f)
-        fov = 1.0f;
-    if (fov > 45.0f)
-        fov = 45.0f;
+    simThread.inputQueue().push(INPUT_SCROLL, 0, 0.0f, (float)yoffset);
 }
 
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
     if (button == GLFW_MOUSE_BUTTON_LEFT && action == GLFW_PRESS) {
-        leftMousePressed = true;
+        simThread.inputQueue().push(INPUT_LEFT_CLICK);
     }
     if (button == GLFW_MOUSE_BUTTON_RIGHT && action == GLFW_PRESS) {
-        rightMousePressed = true;
+        simThread.inputQueue().push(INPUT_RIGHT_CLICK);
     }
 }
 
 // ========== HELPER FUNKCIJE ==========
-Vec2 lerp(Vec2 a, Vec2 b, float t) {
-    return Vec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+void initStations() {
+    initStationPositions(stations, NUM_STATIONS);
 }
 
-Vec2 bezierQuadratic(Vec2 p0, Vec2 p1, Vec2 p2, float t) {
-    float u = 1.0f - t;
-    return Vec2(
-        u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
-        u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y
-    );
+// Mreza sa 2D temenima (samo pozicija) - putanja i krug
+uint32_t create2DMesh(const std::vector<float>& vertices) {
+    uint32_t buffer = renderBackend.createBuffer(vertices.data(), vertices.size() * sizeof(float), BUFFER_STATIC);
+    return renderBackend.createMesh({ { 0, buffer, 2, 2 * sizeof(float), 0, 0 } });
 }
 
-void initStations() {
-
-    stations[0].position = Vec2(-0.65f, 0.55f);   // Top-left area
-    stations[1].position = Vec2(-0.25f, 0.65f);   // Top-center-left
-    stations[2].position = Vec2(0.35f, 0.60f);    // Top-right area
-    stations[3].position = Vec2(0.70f, 0.25f);    // Right side, upper
-    stations[4].position = Vec2(0.75f, -0.15f);   // Right side, lower
-    stations[5].position = Vec2(0.45f, -0.55f);   // Bottom-right
-    stations[6].position = Vec2(0.0f, -0.65f);    // Bottom-center
-    stations[7].position = Vec2(-0.50f, -0.50f);  // Bottom-left
-    stations[8].position = Vec2(-0.75f, -0.10f);  // Left side, lower
-    stations[9].position = Vec2(-0.70f, 0.20f);   // Left side, upper
+// Raspored temena iz Geometry.h: pozicija, boja, UV, normala (na offsetu 10)
+std::vector<MeshAttribute> vertex3DAttributes(uint32_t buffer) {
+    int stride = VERTEX_3D_FLOATS * sizeof(float);
+    return {
+        { 0, buffer, 3, stride, 0, 0 },
+        { 1, buffer, 4, stride, 3 * sizeof(float), 0 },
+        { 2, buffer, 2, stride, 7 * sizeof(float), 0 },
+        { 3, buffer, 3, stride, 10 * sizeof(float), 0 }
+    };
+}
 
-    for (int i = 0; i < NUM_STATIONS; i++) {
-        stations[i].number = i;
-    }
+uint32_t create3DMesh(const std::vector<float>& vertices) {
+    uint32_t buffer = renderBackend.createBuffer(vertices.data(), vertices.size() * sizeof(float), BUFFER_STATIC);
+    return renderBackend.createMesh(vertex3DAttributes(buffer));
 }
 
-void setupPathVAO() {
+void setupPathMesh() {
     std::vector<float> pathVertices;
-
-    for (int i = 0; i < NUM_STATIONS; i++) {
-        int nextIdx = (i + 1) % NUM_STATIONS;
-        Vec2 p0 = stations[i].position;
-        Vec2 p2 = stations[nextIdx].position;
-
-        Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
-        float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
-        Vec2 normal = Vec2(-dir.y, dir.x);
-
-        if (dist > 0.0001f) {
-            normal.x /= dist;
-            normal.y /= dist;
-        }
-
-
-        float curvature = 0.12f + 0.08f * sin(i * 0.7f);
-
-        float curveDir = (i % 3 == 0) ? -1.0f : 1.0f;
-
-        Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
-        Vec2 controlPoint = Vec2(
-            midPoint.x + normal.x * curvature * curveDir,
-            midPoint.y + normal.y * curvature * curveDir
-        );
-
-        int segments = 30;
-        for (int j = 0; j <= segments; j++) {
-            float t = (float)j / (float)segments;
-            Vec2 point = bezierQuadratic(p0, controlPoint, p2, t);
-            pathVertices.push_back(point.x);
-            pathVertices.push_back(point.y);
-        }
-    }
-
-    glGenVertexArrays(1, &pathVAO);
-    glGenBuffers(1, &pathVBO);
-
-    glBindVertexArray(pathVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, pathVBO);
-    glBufferData(GL_ARRAY_BUFFER, pathVertices.size() * sizeof(float), pathVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindVertexArray(0);
+    buildPathVertices(stations, NUM_STATIONS, 30, pathVertices);
+    pathMesh = create2DMesh(pathVertices);
 }
 
-void setupCircleVAO() {
+void setupCircleMesh() {
     std::vector<float> circleVertices;
-    int segments = 50;
-
-    for (int i = 0; i <= segments; i++) {
-        float angle = (2.0f * 3.14159f * i) / segments;
-        circleVertices.push_back(cos(angle));
-        circleVertices.push_back(sin(angle));
-    }
-
-    glGenVertexArrays(1, &circleVAO);
-    glGenBuffers(1, &circleVBO);
-
-    glBindVertexArray(circleVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, circleVBO);
-    glBufferData(GL_ARRAY_BUFFER, circleVertices.size() * sizeof(float), circleVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glBindVertexArray(0);
+    buildCircleVertices(50, circleVertices);
+    circleMesh = create2DMesh(circleVertices);
 }
 
-void setModelMatrix(unsigned int shaderProgram, float x, float y, float width, float height) {
+void setModelMatrix(RenderCommandList& list, float x, float y, float width, float height) {
     float model[16] = {
         width, 0.0f, 0.0f, 0.0f,
         0.0f, height, 0.0f, 0.0f,
         0.0f, 0.0f, 1.0f, 0.0f,
         x, y, 0.0f, 1.0f
     };
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "uModel"), 1, GL_FALSE, model);
+    list.setMat4(shader2D, "uModel", model);
 }
 
-void renderTexture(unsigned int texture, float x, float y, float w, float h, float alpha, unsigned int shaderProgram, unsigned int VAO) {
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    glUniform1f(glGetUniformLocation(shaderProgram, "uAlpha"), alpha);
-    setModelMatrix(shaderProgram, x, y, w, h);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+// Ocekuje vezanu quadMesh
+void renderTexture(RenderCommandList& list, uint32_t texture, float x, float y, float w, float h, float alpha) {
+    list.usePipeline(shader2D, 0);
+    list.bindTexture(0, texture);
+    list.setFloat(shader2D, "uAlpha", alpha);
+    setModelMatrix(list, x, y, w, h);
+    list.drawIndexed(PRIMITIVE_TRIANGLES, 6);
 }
 
-void renderCircle(float x, float y, float radius, float r, float g, float b, unsigned int shaderProgram) {
-    setModelMatrix(shaderProgram, x, y, radius, radius);
-    glUniform1f(glGetUniformLocation(shaderProgram, "uAlpha"), 1.0f);
-    glUniform3f(glGetUniformLocation(shaderProgram, "uColor"), r, g, b);
-    glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 1);
-
-    glBindVertexArray(circleVAO);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 52);
+void renderCircle(RenderCommandList& list, float x, float y, float radius, float r, float g, float b) {
+    list.usePipeline(shader2D, SHADER2D_UNIFORM_COLOR);
+    setModelMatrix(list, x, y, radius, radius);
+    list.setFloat(shader2D, "uAlpha", 1.0f);
+    list.setVec3(shader2D, "uColor", r, g, b);
 
-    glUniform1i(glGetUniformLocation(shaderProgram, "uUseColor"), 0);
+    list.bindMesh(circleMesh);
+    list.draw(PRIMITIVE_TRIANGLE_FAN, 0, 52);
 }
 
 // ========== 3D HELPER FUNKCIJE ==========
 void setupRoad3D() {
     std::vector<float> roadVertices;
-    
-    float roadWidth = 50.0f;
-    float roadStart = 50.0f;
-    float roadEnd = -ROAD_LENGTH;
-    
-    // Asfalt
-    roadVertices.insert(roadVertices.end(), {
-        // Leva strana puta
-        -roadWidth / 2, -1.2f, roadStart,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         roadWidth / 2, -1.2f, roadStart,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         roadWidth / 2, -1.2f, roadEnd,     0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -roadWidth / 2, -1.2f, roadEnd,     0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // Bela linija
-    roadVertices.insert(roadVertices.end(), {
-        -0.1f, -1.19f, roadStart,   1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         0.1f, -1.19f, roadStart,   1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         0.1f, -1.19f, roadEnd,     1.0f, 1.0f, 1.0f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -0.1f, -1.19f, roadEnd,     1.0f, 1.0f, 1.0f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // Trava sa leve strane
-    roadVertices.insert(roadVertices.end(), {
-        -500.0f, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-        -roadWidth / 2, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-        -roadWidth / 2, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -500.0f, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // Trava sa desne strane
-    roadVertices.insert(roadVertices.end(), {
-         roadWidth / 2, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         500.0f, -1.2f, roadStart,   0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         500.0f, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-         roadWidth / 2, -1.2f, roadEnd,     0.2f, 0.6f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    glGenVertexArrays(1, &roadVAO);
-    glGenBuffers(1, &roadVBO);
-    
-    glBindVertexArray(roadVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, roadVBO);
-    glBufferData(GL_ARRAY_BUFFER, roadVertices.size() * sizeof(float), roadVertices.data(), GL_STATIC_DRAW);
-    
-    unsigned int stride = (3 + 4 + 2 + 3) * sizeof(float);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-    
-    glBindVertexArray(0);
+    buildRoadVertices(ROAD_LENGTH, roadVertices);
+    roadMesh = create3DMesh(roadVertices);
 }
 
 void setupStation3D() {
     std::vector<float> stationVertices;
-    
-    float stationWidth = 3.0f;   // Šira stanica
-    float stationHeight = 0.3f;  // Niska platforma
-    float stationDepth = 1.5f;
-    float roofHeight = 2.5f;     // Visina krova iznad poda
-    
-    // ===== PLATFORMA (POD) =====
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2, -1.2f + stationHeight,  stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -stationWidth/2, -1.2f + stationHeight,  stationDepth/2,   0.5f, 0.5f, 0.5f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // Prednja strana platforme
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2, -1.2f, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2, -1.2f, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-        -stationWidth/2, -1.2f + stationHeight, -stationDepth/2,   0.4f, 0.4f, 0.4f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-    });
-    
-    // ===== ZADNJI ZID (Zaštitni zid) =====
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2, -1.2f + stationHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, -1.0f,
-         stationWidth/2, -1.2f + stationHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, -1.0f,
-         stationWidth/2, -1.2f + roofHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, -1.0f,
-        -stationWidth/2, -1.2f + roofHeight, stationDepth/2,   0.8f, 0.8f, 0.7f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, -1.0f,
-    });
-    
-    // ===== STUBOVI (Levi i desni) =====
-    // Levi stub
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2 + 0.2f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-        -stationWidth/2 + 0.4f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-        -stationWidth/2 + 0.4f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-        -stationWidth/2 + 0.2f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-    });
-    
-    // Desni stub
-    stationVertices.insert(stationVertices.end(), {
-         stationWidth/2 - 0.4f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2 - 0.2f, -1.2f + stationHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2 - 0.2f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2 - 0.4f, -1.2f + roofHeight, -stationDepth/2 + 0.2f,   0.3f, 0.3f, 0.3f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-    });
-    
-    // ===== KROV =====
-    // Donji deo krova
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2 - 0.3f, -1.2f + roofHeight, -stationDepth/2 - 0.5f,   0.7f, 0.1f, 0.1f, 1.0f,   0.0f, 0.0f,   0.0f, -1.0f, 0.0f,
-         stationWidth/2 + 0.3f, -1.2f + roofHeight, -stationDepth/2 - 0.5f,   0.7f, 0.1f, 0.1f, 1.0f,   1.0f, 0.0f,   0.0f, -1.0f, 0.0f,
-         stationWidth/2 + 0.3f, -1.2f + roofHeight, stationDepth/2,   0.7f, 0.1f, 0.1f, 1.0f,   1.0f, 1.0f,   0.0f, -1.0f, 0.0f,
-        -stationWidth/2 - 0.3f, -1.2f + roofHeight, stationDepth/2,   0.7f, 0.1f, 0.1f, 1.0f,   0.0f, 1.0f,   0.0f, -1.0f, 0.0f,
-    });
-    
-    // Vrh krova
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2 - 0.3f, -1.2f + roofHeight + 0.2f, -stationDepth/2 - 0.5f,   0.8f, 0.2f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2 + 0.3f, -1.2f + roofHeight + 0.2f, -stationDepth/2 - 0.5f,   0.8f, 0.2f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2 + 0.3f, -1.2f + roofHeight + 0.2f, stationDepth/2,   0.8f, 0.2f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -stationWidth/2 - 0.3f, -1.2f + roofHeight + 0.2f, stationDepth/2,   0.8f, 0.2f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // ===== KLUPA =====
-    // Površina klupe
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.6f,   0.6f, 0.4f, 0.2f, 1.0f,   0.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.6f,   0.6f, 0.4f, 0.2f, 1.0f,   1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
-         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.6f, 0.4f, 0.2f, 1.0f,   1.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.6f, 0.4f, 0.2f, 1.0f,   0.0f, 1.0f,   0.0f, 1.0f, 0.0f,
-    });
-    
-    // Naslon klupe
-    stationVertices.insert(stationVertices.end(), {
-        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   0.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2 - 0.8f, -1.2f + stationHeight + 0.5f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   1.0f, 0.0f,   0.0f, 0.0f, 1.0f,
-         stationWidth/2 - 0.8f, -1.2f + stationHeight + 1.0f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   1.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-        -stationWidth/2 + 0.8f, -1.2f + stationHeight + 1.0f, stationDepth/2 - 0.4f,   0.5f, 0.3f, 0.15f, 1.0f,   0.0f, 1.0f,   0.0f, 0.0f, 1.0f,
-    });
-    
-    glGenVertexArrays(1, &station3DVAO);
-    glGenBuffers(1, &station3DVBO);
-    
-    glBindVertexArray(station3DVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, station3DVBO);
-    glBufferData(GL_ARRAY_BUFFER, stationVertices.size() * sizeof(float), stationVertices.data(), GL_STATIC_DRAW);
-    
-    unsigned int stride = (3 + 4 + 2 + 3) * sizeof(float);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-    
-    glBindVertexArray(0);
+    buildStationVertices(stationVertices);
+    stationMesh = create3DMesh(stationVertices);
 }
 
-void setupDisplayFramebuffer() {
-    glGenFramebuffers(1, &displayFBO);
-    glBindFramebuffer(GL_FRAMEBUFFER, displayFBO);
+void setupPosters() {
+    std::vector<float> posterVertices;
+    buildPosterVertices(posterVertices);
+    posterMesh = create3DMesh(posterVertices);
+    std::fill(posterHandles, posterHandles + NUM_STATIONS, -1);
+    textureStreamer.init(&renderBackend, streamBudgetKB * 1024);
+}
 
-    glGenTextures(1, &displayTexture);
-    glBindTexture(GL_TEXTURE_2D, displayTexture);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, DISPLAY_WIDTH, DISPLAY_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, displayTexture, 0);
+// Stanica stationIdx ispred autobusa je (nextStation + stationIdx); poster i-te stanice je
+// posterPaths[i % broj postera]
+void updatePosters(const SimSnapshot& snap) {
+    bool visible[NUM_STATIONS] = {};
+    for (int stationIdx = 0; stationIdx < VISIBLE_STATIONS; stationIdx++) {
+        visible[(snap.nextStation + stationIdx) % NUM_STATIONS] = true;
+    }
+    for (int station = 0; station < NUM_STATIONS; station++) {
+        if (!visible[station] && posterHandles[station] >= 0) {
+            textureStreamer.release(posterHandles[station]);
+            posterHandles[station] = -1;
+        } else if (visible[station] && posterHandles[station] < 0) {
+            posterHandles[station] = textureStreamer.request(posterPaths[station % posterPaths.size()]);
+        }
+    }
+    textureStreamer.update();
+}
 
-    glGenRenderbuffers(1, &displayRBO);
-    glBindRenderbuffer(GL_RENDERBUFFER, displayRBO);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, displayRBO);
+// ========== PALETA KOSTIJU ==========
+// Texture buffer kao kod klasterovanih svetala; velicina prati broj agenata
+void initBonePalette() {
+    float zero[4] = {};
+    bonePaletteBuffer = renderBackend.createBuffer(zero, sizeof(zero), BUFFER_STREAM);
+    bonePaletteTexture = renderBackend.createBufferTexture(bonePaletteBuffer, GL_RGBA32F);
+}
 
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        std::cout << "Framebuffer nije kompletan!" << std::endl;
+// Agent i < broja putnika je putnik i, ostali su agenti guzve redom kao instance
+void recordBonePalette(RenderCommandList& list, const SimSnapshot& snap) {
+    animatedAgents.clear();
+    for (const Passenger& p : snap.activePassengers) {
+        const HumanoidVariant& variant = passengerMeshes.variants[clampHumanoidVariant(p.characterModel)];
+        animatedAgents.push_back({ &variant.skeleton, p.animation });
+    }
+    for (int a = 0; a < snap.crowdCount; a++) {
+        animatedAgents.push_back({ &crowdSkeleton, crowdAnimationState(snap.crowdAnimation[a * 2], snap.crowdAnimation[a * 2 + 1]) });
     }
+    if (animatedAgents.empty()) return;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    evaluatePalettes(animatedAgents, &jobs, bonePalette);
+    list.updateBuffer(bonePaletteBuffer, bonePalette.data(), bonePalette.size() * sizeof(float));
+    list.bindTexture(BONE_PALETTE_TEXTURE_UNIT, bonePaletteTexture);
 }
 
-void render2DDisplay(unsigned int shader2D, unsigned int VAO2D, unsigned int* numberTextures,
-                 unsigned int busTexture, unsigned int doorClosedTexture, 
-                 unsigned int doorOpenTexture, unsigned int passengersLabelTexture,
-                 unsigned int finesLabelTexture, unsigned int controlTexture) {
-    
-glBindFramebuffer(GL_FRAMEBUFFER, displayFBO);
-glViewport(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
-glClearColor(0.15f, 0.2f, 0.25f, 1.0f);
-glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+// Lightmap UV-ovi idu u poseban bafer na lokaciji 5, raspored temena ostaje isti
+void setupLightmapUVs(uint32_t mesh, const std::vector<float>& uvs) {
+    uint32_t buffer = renderBackend.createBuffer(uvs.data(), uvs.size() * sizeof(float), BUFFER_STATIC);
+    renderBackend.addAttribute(mesh, { 5, buffer, 2, 2 * sizeof(float), 0, 0 });
+}
+
+// Pecenje puta i kabine pri ucitavanju; posle ovoga se crtaju kroz shadersBaked.
+// Stanice se ne peku: svetlo je vezano za kabinu, a stanice klize ka kameri, pa se njihov
+// Phong menja svaki frejm i nijedna staticka mapa ne bi bila tacna.
+// Kabina se pece bez ljuljanja (jedinicna matrica), a crta sa busScene.cabin(). Ljuljanje je
+// samo pomeraj po y od najvise busShakeAmplitude (5 mm), a svetlo stoji; osvetljenje
+// pecenja i pomerene kabine se razlikuje najvise 0.014 (manje od 4/255), pa se to prihvata.
+void setupBakedLighting(const float* cabinVertices, int cabinQuads, uint32_t cabinMesh,
+                        const BakeLight& light, const BakeMaterial& material, glm::vec3 viewPos) {
+    auto start = std::chrono::high_resolution_clock::now();
 
-GLboolean depthTestWasEnabled = glIsEnabled(GL_DEPTH_TEST);
-glDisable(GL_DEPTH_TEST);
+    std::vector<float> roadVertices;
+    buildRoadVertices(ROAD_LENGTH, roadVertices);
 
-glUseProgram(shader2D);
-glBindVertexArray(VAO2D);
+    LightBaker baker;
+    int roadBakeMesh = baker.addMesh(roadVertices.data(), (int)(roadVertices.size() / (4 * VERTEX_3D_FLOATS)), glm::mat4(1.0f), light, material);
+    int cabinBakeMesh = baker.addMesh(cabinVertices, cabinQuads, glm::mat4(1.0f), light, material);
 
-    glUniform1i(glGetUniformLocation(shader2D, "uUseColor"), 1);
-    glUniform3f(glGetUniformLocation(shader2D, "uColor"), 0.8f, 0.1f, 0.1f);
-    glUniform1f(glGetUniformLocation(shader2D, "uAlpha"), 1.0f);
+    BakeSettings settings;
+    settings.viewPos = viewPos;
+    settings.aoRays = bakeAORays;
+    settings.jobs = &jobs;
+    baker.bake(settings);
+
+    lightmapTexture = renderBackend.createTexture(baker.atlasWidth(), baker.atlasHeight(), GL_RGB16F, GL_RGB, GL_FLOAT,
+                                                  baker.atlas().data(), GL_LINEAR);
+    shadersBaked.setInt("uLightmap", LIGHTMAP_TEXTURE_UNIT);
+
+    setupLightmapUVs(roadMesh, baker.lightmapUVs(roadBakeMesh));
+    setupLightmapUVs(cabinMesh, baker.lightmapUVs(cabinBakeMesh));
+
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "Peceno osvetljenje: atlas " << baker.atlasWidth() << "x" << baker.atlasHeight()
+              << (bakeAORays > 0 ? ", AO " + std::to_string(bakeAORays) + " zraka" : std::string())
+              << ", " << elapsed.count() << " ms" << std::endl;
+}
+
+void render2DDisplay(RenderCommandList& list, const SimSnapshot& snap, uint32_t* numberTextures,
+                 uint32_t busTexture, uint32_t doorClosedTexture, 
+                 uint32_t doorOpenTexture, uint32_t passengersLabelTexture,
+                 uint32_t finesLabelTexture, uint32_t controlTexture) {
+    
+list.setTarget(displayTarget);
+list.clear(glm::vec4(0.15f, 0.2f, 0.25f, 1.0f));
+list.setState(STATE_DEPTH_TEST, false);
+list.setLineWidth(3.0f);
+
+list.usePipeline(shader2D, SHADER2D_UNIFORM_COLOR);
+
+    list.setVec3(shader2D, "uColor", 0.8f, 0.1f, 0.1f);
+    list.setFloat(shader2D, "uAlpha", 1.0f);
 
     float identityMatrix[16] = {
         1.0f, 0.0f, 0.0f, 0.0f,
@@ -541,231 +418,231 @@ glBindVertexArray(VAO2D);
         0.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
     };
-    glUniformMatrix4fv(glGetUniformLocation(shader2D, "uModel"), 1, GL_FALSE, identityMatrix);
+    list.setMat4(shader2D, "uModel", identityMatrix);
 
-    glBindVertexArray(pathVAO);
+    list.bindMesh(pathMesh);
     for (int i = 0; i < NUM_STATIONS; i++) {
-        glDrawArrays(GL_LINE_STRIP, i * 31, 31);
+        list.draw(PRIMITIVE_LINE_STRIP, i * 31, 31);
     }
 
-    glUniform1i(glGetUniformLocation(shader2D, "uUseColor"), 0);
-
     for (int i = 0; i < NUM_STATIONS; i++) {
-        renderCircle(stations[i].position.x, stations[i].position.y, 0.06f, 0.8f, 0.1f, 0.1f, shader2D);
+        renderCircle(list, stations[i].position.x, stations[i].position.y, 0.06f, 0.8f, 0.1f, 0.1f);
     }
 
-    glBindVertexArray(VAO2D);
+    list.bindMesh(quadMesh);
     for (int i = 0; i < NUM_STATIONS; i++) {
-        renderTexture(numberTextures[i], stations[i].position.x, stations[i].position.y,
-            0.05f, 0.06f, 1.0f, shader2D, VAO2D);
+        renderTexture(list, numberTextures[i], stations[i].position.x, stations[i].position.y,
+            0.05f, 0.06f, 1.0f);
     }
     
     Vec2 busPos;
-    if (busAtStation) {
-        busPos = stations[currentStation].position;
+    if (snap.busAtStation) {
+        busPos = stations[snap.currentStation].position;
     }
     else {
-        int prevIdx = currentStation;
-        int nextIdx = nextStation;
+        int prevIdx = snap.currentStation;
+        int nextIdx = snap.nextStation;
         Vec2 p0 = stations[prevIdx].position;
         Vec2 p2 = stations[nextIdx].position;
 
-        Vec2 dir = Vec2(p2.x - p0.x, p2.y - p0.y);
-        float dist = sqrt(dir.x * dir.x + dir.y * dir.y);
-        Vec2 normal = Vec2(-dir.y, dir.x);
-
-        if (dist > 0.0001f) {
-            normal.x /= dist;
-            normal.y /= dist;
-        }
-
-        float curvature = 0.12f + 0.08f * sin(prevIdx * 0.7f);
-        float curveDir = (prevIdx % 3 == 0) ? -1.0f : 1.0f;
-
-        Vec2 midPoint = Vec2((p0.x + p2.x) / 2.0f, (p0.y + p2.y) / 2.0f);
-        Vec2 controlPoint = Vec2(
-            midPoint.x + normal.x * curvature * curveDir,
-            midPoint.y + normal.y * curvature * curveDir
-        );
+        Vec2 controlPoint = pathControlPoint(p0, p2, prevIdx);
 
-        busPos = bezierQuadratic(p0, controlPoint, p2, busProgress);
+        busPos = bezierQuadratic(p0, controlPoint, p2, snap.busProgress);
     }
-    renderTexture(busTexture, busPos.x, busPos.y, 0.15f, 0.08f, 1.0f, shader2D, VAO2D);
+    renderTexture(list, busTexture, busPos.x, busPos.y, 0.15f, 0.08f, 1.0f);
 
-    unsigned int doorTexture = busAtStation ? doorOpenTexture : doorClosedTexture;
-    renderTexture(doorTexture, -0.85f, 0.75f, 0.12f, 0.18f, 1.0f, shader2D, VAO2D);
+    uint32_t doorTexture = snap.busAtStation ? doorOpenTexture : doorClosedTexture;
+    renderTexture(list, doorTexture, -0.85f, 0.75f, 0.12f, 0.18f, 1.0f);
 
-    renderTexture(passengersLabelTexture, -0.90f, -0.65f, 0.20f, 0.08f, 1.0f, shader2D, VAO2D);
+    renderTexture(list, passengersLabelTexture, -0.90f, -0.65f, 0.20f, 0.08f, 1.0f);
 
-    int tens = passengers / 10;
-    int ones = passengers % 10;
-    renderTexture(numberTextures[tens], -0.90f, -0.75f, 0.08f, 0.1f, 1.0f, shader2D, VAO2D);
-    renderTexture(numberTextures[ones], -0.80f, -0.75f, 0.08f, 0.1f, 1.0f, shader2D, VAO2D);
+    int tens = snap.passengers / 10;
+    int ones = snap.passengers % 10;
+    renderTexture(list, numberTextures[tens], -0.90f, -0.75f, 0.08f, 0.1f, 1.0f);
+    renderTexture(list, numberTextures[ones], -0.80f, -0.75f, 0.08f, 0.1f, 1.0f);
 
-    renderTexture(finesLabelTexture, -0.90f, -0.83f, 0.20f, 0.08f, 1.0f, shader2D, VAO2D);
+    renderTexture(list, finesLabelTexture, -0.90f, -0.83f, 0.20f, 0.08f, 1.0f);
 
-    int finesTens = (totalFines / 10) % 10;
-    int finesOnes = totalFines % 10;
-    renderTexture(numberTextures[finesTens], -0.90f, -0.93f, 0.08f, 0.1f, 1.0f, shader2D, VAO2D);
-    renderTexture(numberTextures[finesOnes], -0.80f, -0.93f, 0.08f, 0.1f, 1.0f, shader2D, VAO2D);
+    int finesTens = (snap.totalFines / 10) % 10;
+    int finesOnes = snap.totalFines % 10;
+    renderTexture(list, numberTextures[finesTens], -0.90f, -0.93f, 0.08f, 0.1f, 1.0f);
+    renderTexture(list, numberTextures[finesOnes], -0.80f, -0.93f, 0.08f, 0.1f, 1.0f);
 
-    if (isInspectorInBus) {
-        renderTexture(controlTexture, 0.85f, 0.75f, 0.12f, 0.12f, 1.0f, shader2D, VAO2D);
+    if (snap.isInspectorInBus) {
+        renderTexture(list, controlTexture, 0.85f, 0.75f, 0.12f, 0.12f, 1.0f);
     }
+}
 
-    if (depthTestWasEnabled) {
-        glEnable(GL_DEPTH_TEST);
-    }
+// ========== SOFTVERSKO CRTANJE ==========
+void setupSoftwareTexture(int width, int height) {
+    softwareTexture = renderBackend.createTexture(width, height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, NULL, GL_NEAREST);
+}
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+// Gotova slika preko celog ekrana; redovi bafera su poravnati na plocice, pa se salju sa ROW_LENGTH
+void presentSoftwareFrame(RenderCommandList& list) {
+    const SoftFramebuffer& frame = softwareRenderer.frame();
+    list.setTarget(RENDER_SCREEN);
+    list.setState(STATE_DEPTH_TEST, false);
+    list.updateTexture(softwareTexture, frame.color.data(), frame.color.size() * sizeof(frame.color[0]), frame.stride);
+
+    // Alfa slike nije uvek 1 (blending menja i alfa kanal), pa se kopira bez blendinga
+    list.setState(STATE_BLEND, false);
+    list.usePipeline(shader2D, 0);
+    list.setFloat(shader2D, "uAlpha", 1.0f);
+    setModelMatrix(list, 0.0f, 0.0f, 2.0f, 2.0f);
+    list.bindTexture(0, softwareTexture);
+    list.bindMesh(quadMesh);
+    list.drawIndexed(PRIMITIVE_TRIANGLES, 6);
+    list.setState(STATE_BLEND, true);
 }
 
-void addPassenger(bool isInsp = false) {
-    Passenger p;
-    p.position = glm::vec3(1.2f, -0.3f, -0.075f);
-    
-    p.targetPosition = glm::vec3(1.05f, -0.3f, -0.075f); 
-    
-    int rowOffset = activePassengers.size() / 4;
-    int colOffset = activePassengers.size() % 4;
-    
-    p.finalPosition = glm::vec3(
-        0.5f + colOffset * 0.25f,  // Desno od vozača
-        -0.3f,                      // Ista visina
-        0.8f + rowOffset * 0.4f     // Pozadi vozača
-    );
-    
-    p.moveSpeed = 1.2f;
-    p.isMoving = true;
-    p.waypointIndex = 0; 
-    p.characterModel = isInsp ? 15 : (rand() % 15);
-    p.isInspector = isInsp;
-    
-    if (isInsp) {
-        p.shirtColor = glm::vec3(0.1f, 0.1f, 0.1f);
-        p.pantsColor = glm::vec3(0.05f, 0.05f, 0.05f);
-    } else {
-        p.shirtColor = glm::vec3(
-            0.2f + (rand() % 80) / 100.0f,
-            0.2f + (rand() % 80) / 100.0f,
-            0.2f + (rand() % 80) / 100.0f
-        );
-        p.pantsColor = glm::vec3(
-            0.1f + (rand() % 50) / 100.0f,
-            0.1f + (rand() % 50) / 100.0f,
-            0.1f + (rand() % 50) / 100.0f
-        );
-        // Random boja kose (braon, crna, plava, crvena)
-        int hairType = rand() % 4;
-        if (hairType == 0) {
-            p.hairColor = glm::vec3(0.2f, 0.15f, 0.1f);  // Braon
-        } else if (hairType == 1) {
-            p.hairColor = glm::vec3(0.05f, 0.05f, 0.05f);  // Crna
-        } else if (hairType == 2) {
-            p.hairColor = glm::vec3(0.9f, 0.85f, 0.5f);  // Plava
-        } else {
-            p.hairColor = glm::vec3(0.4f, 0.1f, 0.05f);  // Crvena
+// Snimak zadnjeg bafera pre overlay-a performansi. Uz GL putanju isti snimak simulacije se
+// nacrta i softverski, pa se ispise razlika dve slike.
+void saveScreenshot(const SimSnapshot& snap, int width, int height, const SoftSceneSettings& scene) {
+    std::vector<uint8_t> glPixels, softPixels;
+    if (!softwareRendering) {
+        glPixels.resize((size_t)width * height * 4);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, glPixels.data());
+        writePPM("screenshot_gl.ppm", width, height, glPixels);
+
+        if (!softwareRenderer.ready() && !softwareRenderer.init(width, height, scene, &jobs)) {
+            std::cout << "Snimak: screenshot_gl.ppm (softversko crtanje nije pokrenuto)" << std::endl;
+            return;
         }
+        softwareRenderer.render(snap);
     }
-    
-    activePassengers.push_back(p);
+    softwareRenderer.frame().readPixels(softPixels);
+    writePPM("screenshot_soft.ppm", width, height, softPixels);
+
+    if (softwareRendering) {
+        std::cout << "Snimak: screenshot_soft.ppm" << std::endl;
+        return;
+    }
+    // Panel se ne poredi (pruge od borbe za dubinu na GPU-u, vidi SoftwareRenderer::panelMask)
+    std::vector<uint8_t> mask;
+    softwareRenderer.panelMask(mask);
+    ImageDiff diff = compareImages(glPixels, softPixels, width * height, 8, &mask);
+    std::cout << "Snimak: screenshot_gl.ppm i screenshot_soft.ppm (" << softwareRenderer.lastRenderMs() << " ms na CPU-u)" << std::endl;
+    std::cout << "  razlika bez panela (" << diff.maskedPixels * 100.0 << "% slike): srednja " << diff.meanError
+              << ", najveca " << diff.maxError << ", " << diff.badPixels * 100.0 << "% piksela preko 8" << std::endl;
 }
 
-void removePassenger(bool removeInspector = false) {
-    if (activePassengers.empty()) return;
-    
-    int removeIdx = -1;
-    
-    if (removeInspector) {
-        for (int i = 0; i < activePassengers.size(); i++) {
-            if (activePassengers[i].isInspector) {
-                removeIdx = i;
-                break;
-            }
+// ========== MAIN ==========
+int main(int argc, char** argv)
+{
+    // ========== ARGUMENTI KOMANDNE LINIJE ==========
+    // --seed N         seed simulacije (podrazumevano trenutno vreme)
+    // --record FAJL    snima ulaz u binarni fajl
+    // --replay FAJL    reprodukuje snimljeni ulaz (seed se cita iz snimka)
+    // --telemetry PREF prefiks segmenata binarnog dnevnika dogadjaja (podrazumevano "telemetry")
+    // --no-telemetry   bez dnevnika dogadjaja
+    // --verbose        dogadjaji se ispisuju i na konzolu
+    // --night N        nocna voznja sa N svetala duz puta
+    // --no-bake        bez pecenog osvetljenja (put i kabina se sencaju po fragmentu)
+    // --bake-ao N      ambijentalna okluzija u pecenju, N zraka po texelu
+    // --no-shader-cache varijante sejdera se uvek prevode iz izvora (bez shadercache_*.bin)
+    // --software       scena se crta na CPU-u (SoftRasterizer), GL samo prikazuje sliku
+    // --threads N      broj radnih niti (softversko crtanje, poze animacije, guzva, pecenje;
+    //                  podrazumevano svi procesori)
+    // --capture-at N   snima listu komandi N-tog frejma (isto kao F10)
+    // --capture FAJL   fajl snimka frejma (podrazumevano "frame_capture.rcap")
+    // --perf-report FAJL  JSON sa GL brojacima (ukupno i po prolazu) i trajanjem frejmova, pri izlasku
+    // --budget-draws N    budzet poziva crtanja po frejmu (podrazumevano 300, 0 = bez budzeta)
+    // --budget-upload-kb N budzet uploada po frejmu u KB (podrazumevano 1024, 0 = bez budzeta)
+    // --gpu-budget-mb N   budzet procenjene GPU memorije (podrazumevano 256, 0 = bez budzeta)
+    // --res-scale S       stalna razmera 3D scene (0.1 - 1, 1 = uvek puna rezolucija, bez kontrolera)
+    // --min-res-scale S   najmanja razmera koju bira kontroler dinamicke rezolucije (podrazumevano 0.5)
+    // --video FAJL        snima frejmove od pocetka (.y4m, .raw ili PNG sekvenca; F9 pauzira)
+    // --poster FAJL       slika za postere na stanicama (moze vise puta, stanice ih dele redom)
+    // --stream-budget-kb N najvise KB strimovanih tekstura poslatih u jednom frejmu (podrazumevano 256)
+    // --checkpoint FAJL   periodicno cuva celo stanje simulacije (u pozadinskoj niti)
+    // --checkpoint-every S razmak checkpoint-a u sekundama simulacije (podrazumevano 60)
+    // --restore FAJL      nastavlja simulaciju iz checkpoint-a umesto od seed-a
+    uint64_t seed = (uint64_t)time(NULL);
+    const char* recordPath = NULL;
+    const char* replayPath = NULL;
+    const char* telemetryPrefix = "telemetry";
+    const char* checkpointPath = NULL;
+    double checkpointInterval = 60.0;
+    const char* restorePath = NULL;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--seed" && i + 1 < argc) seed = strtoull(argv[++i], NULL, 10);
+        else if (arg == "--record" && i + 1 < argc) recordPath = argv[++i];
+        else if (arg == "--replay" && i + 1 < argc) replayPath = argv[++i];
+        else if (arg == "--telemetry" && i + 1 < argc) telemetryPrefix = argv[++i];
+        else if (arg == "--no-telemetry") telemetryPrefix = NULL;
+        else if (arg == "--verbose") verbose = true;
+        else if (arg == "--night" && i + 1 < argc) nightLightCount = std::max(0, atoi(argv[++i]));
+        else if (arg == "--no-bake") bakeLighting = false;
+        else if (arg == "--bake-ao" && i + 1 < argc) bakeAORays = std::max(0, atoi(argv[++i]));
+        else if (arg == "--no-shader-cache") shaderBinaryCache = false;
+        else if (arg == "--software") softwareRendering = true;
+        else if (arg == "--threads" && i + 1 < argc) jobThreads = std::max(0, atoi(argv[++i]));
+        else if (arg == "--capture-at" && i + 1 < argc) captureFrame = atoll(argv[++i]);
+        else if (arg == "--capture" && i + 1 < argc) capturePath = argv[++i];
+        else if (arg == "--perf-report" && i + 1 < argc) perfReportPath = argv[++i];
+        else if (arg == "--budget-draws" && i + 1 < argc) perfReport.budget.drawCalls = strtoull(argv[++i], NULL, 10);
+        else if (arg == "--budget-upload-kb" && i + 1 < argc) perfReport.budget.uploadBytes = strtoull(argv[++i], NULL, 10) * 1024;
+        else if (arg == "--gpu-budget-mb" && i + 1 < argc) renderBackend.memory().budget = (size_t)strtoull(argv[++i], NULL, 10) << 20;
+        else if (arg == "--res-scale" && i + 1 < argc) fixedResolutionScale = (float)atof(argv[++i]);
+        else if (arg == "--min-res-scale" && i + 1 < argc) minResolutionScale = (float)atof(argv[++i]);
+        else if (arg == "--video" && i + 1 < argc) {
+            videoPath = argv[++i];
+            videoToggleRequested = true;
         }
-    } else {
-        removeIdx = activePassengers.size() - 1;
+        else if (arg == "--poster" && i + 1 < argc) posterPaths.push_back(argv[++i]);
+        else if (arg == "--stream-budget-kb" && i + 1 < argc) streamBudgetKB = std::max(1, atoi(argv[++i]));
+        else if (arg == "--checkpoint" && i + 1 < argc) checkpointPath = argv[++i];
+        else if (arg == "--checkpoint-every" && i + 1 < argc) checkpointInterval = atof(argv[++i]);
+        else if (arg == "--restore" && i + 1 < argc) restorePath = argv[++i];
     }
-    
-    if (removeIdx >= 0) {
-        activePassengers[removeIdx].waypointIndex = 10;
-        activePassengers[removeIdx].isMoving = true;
+    if (softwareRendering && nightLightCount > 0) {
+        std::cout << "--night se ignorise uz --software (nocna svetla postoje samo na GPU-u)" << std::endl;
+        nightLightCount = 0;
+    }
+    if (softwareRendering && !posterPaths.empty()) {
+        std::cout << "--poster se ignorise uz --software (posteri se crtaju samo na GPU-u)" << std::endl;
+        posterPaths.clear();
     }
-}
 
-void updatePassengers(float dt) {
-    for (auto it = activePassengers.begin(); it != activePassengers.end(); ) {
-        if (it->isMoving) {
-            glm::vec3 direction = it->targetPosition - it->position;
-            float distance = glm::length(direction);
-            
-            it->walkAnimTime += dt * 8.0f;
-            
-            if (distance < 0.05f) {
-                // Stigao do trenutnog waypoint-a
-                it->position = it->targetPosition;
-                
-                // ULAZAK U AUTOBUS
-                if (it->waypointIndex == 0) {
-                    it->waypointIndex = 1;
-                    it->targetPosition = glm::vec3(0.85f, -0.3f, -0.075f);
-                }
-                else if (it->waypointIndex == 1) {
-                    it->waypointIndex = 2;
-                    float centerZ = (it->finalPosition.z - 0.075f) / 2.0f - 0.075f;
-                    it->targetPosition = glm::vec3(0.7f, -0.3f, centerZ);
-                }
-                else if (it->waypointIndex == 2) {
-                    it->waypointIndex = 3;
-                    it->targetPosition = it->finalPosition;
-                }
-                else if (it->waypointIndex == 3) {
-                    it->isMoving = false;
-                    it->walkAnimTime = 0.0f;  // Resetuj animaciju kada stane
-                }
-                
-                // IZLAZAK IZ AUTOBUSA
-                else if (it->waypointIndex == 10) {
-                    it->waypointIndex = 11;
-                    float centerZ = (it->position.z - 0.075f) / 2.0f - 0.075f;
-                    it->targetPosition = glm::vec3(0.7f, -0.3f, centerZ); 
-                }
-                else if (it->waypointIndex == 11) {
-                    it->waypointIndex = 12;
-                    it->targetPosition = glm::vec3(0.85f, -0.3f, -0.075f); 
-                }
-                else if (it->waypointIndex == 12) {
-                    it->waypointIndex = 13;
-                    it->targetPosition = glm::vec3(1.05f, -0.3f, -0.075f); 
-                }
-                else if (it->waypointIndex == 13) {
-                    it->waypointIndex = 14;
-                    it->targetPosition = glm::vec3(1.2f, -0.3f, -0.075f);
-                }
-                else if (it->waypointIndex == 14) {
-                    it = activePassengers.erase(it);
-                    continue;
-                }
-            } else {
-                glm::vec3 moveDir = glm::normalize(direction);
-                
-                if (it->waypointIndex == 0 || it->waypointIndex == 12 || it->waypointIndex == 13) {
-                    it->position += moveDir * (it->moveSpeed * 0.7f) * dt; 
-                } else {
-                    it->position += moveDir * it->moveSpeed * dt; 
-                }
-            }
+    if (replayPath != NULL && inputReplayer.open(replayPath)) {
+        seed = inputReplayer.getSeed();
+        replayActive = true;
+        std::cout << "Reprodukcija snimka \"" << replayPath << "\" (" << inputReplayer.frameCount() << " frejmova)" << std::endl;
+    }
+    if (recordPath != NULL && inputRecorder.open(recordPath, seed)) {
+        std::cout << "Snimanje ulaza u \"" << recordPath << "\"" << std::endl;
+    }
+    std::cout << "Seed simulacije: " << seed << std::endl;
+    sim.seed(seed);
+
+    // Checkpoint zamenjuje stanje posle seed-a; snimak ulaza i dalje pocinje od seed-a
+    if (restorePath != NULL) {
+        if (replayActive || recordPath != NULL) {
+            std::cout << "--restore se ignorise uz --record/--replay (snimak ulaza pocinje od seed-a)" << std::endl;
         } else {
-            it->walkAnimTime = 0.0f;
+            CheckpointDriverState driver;
+            if (loadCheckpoint(restorePath, sim, &driver)) {
+                simThread.restoreDriver(driver);
+                std::cout << "Nastavak iz \"" << restorePath << "\": " << sim.simTime << " s simulacije, "
+                          << sim.passengers << " putnika" << std::endl;
+            }
         }
-        ++it;
     }
-}
+    if (checkpointPath != NULL && checkpointWriter.open(checkpointPath, checkpointInterval)) {
+        simThread.setCheckpointWriter(&checkpointWriter);
+        std::cout << "Checkpoint: \"" << checkpointPath << "\" na svakih " << checkpointInterval << " s" << std::endl;
+    }
 
-// ========== MAIN ==========
-int main()
-{
-    srand(time(NULL));
+    // Dogadjaji simulacije idu u binarni dnevnik umesto na konzolu (std::endl u frejmu blokira)
+    if (telemetryPrefix != NULL && telemetryWriter.open(telemetryPrefix, 4 << 20, 8)) {
+        sim.telemetry = &telemetryWriter;
+        std::cout << "Telemetrija: " << telemetrySegmentPath(telemetryPrefix, 0) << " ..." << std::endl;
+    }
+    sim.logToConsole = verbose || sim.telemetry == nullptr;
 
     // ========== INICIJALIZACIJA GLFW ==========
     if (!glfwInit()) {
@@ -804,54 +681,62 @@ int main()
     std::cout << "GLSL verzija: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
 
     // ========== PODESAVANJA OPENGL ==========
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_DEPTH_TEST);  // INICIJALNO UKLJUČENO
-    glViewport(0, 0, mode->width, mode->height);
-    glLineWidth(3.0f);
-    glClearColor(0.5, 0.5, 0.5, 1.0);
-    
-    
-    glCullFace(GL_BACK);   
-    glFrontFace(GL_CCW);   
+    // Stanje koje se menja u frejmu (depth test, blending, culling, viewport) postavljaju komande
+    renderBackend.init(mode->width, mode->height);
 
     // ========== UCITAVANJE SEJDERA ==========
     std::cout << "\n=== UCITAVANJE SEJDERA ===" << std::endl;
-    unsigned int shader2D = createShader("Resource Files/Shaders/basic.vert", "Resource Files/Shaders/basic.frag");
-    unsigned int shader3D = createShader("Resource Files/Shaders/basic3d.vert", "Resource Files/Shaders/basic3d.frag");
-    
-    if (shader2D == 0 || shader3D == 0) {
+    const char* binaryCachePrefix = shaderBinaryCache ? SHADER_BINARY_CACHE_PREFIX : nullptr;
+    shaders2D.init("Resource Files/Shaders/basic.vert", "Resource Files/Shaders/basic.frag", SHADER2D_DEFINES, binaryCachePrefix);
+    shaders3D.init("Resource Files/Shaders/basic3d.vert", "Resource Files/Shaders/basic3d.frag", SHADER3D_DEFINES, binaryCachePrefix);
+    shadersBaked.init("Resource Files/Shaders/baked3d.vert", "Resource Files/Shaders/baked3d.frag", std::vector<std::string>(), binaryCachePrefix);
+
+    // Varijante koje se crtaju vec u prvom frejmu; ostale se prevode kad zatrebaju
+    uint32_t lightingVariant = nightLightCount > 0 ? SHADER3D_CLUSTERED_LIGHTS : 0;
+    shaders2D.warm({ 0, SHADER2D_UNIFORM_COLOR, SHADER2D_VERTEX_COLOR });
+    shaders3D.warm({ lightingVariant, lightingVariant | SHADER3D_INSTANCED | SHADER3D_SKINNED,
+                     lightingVariant | SHADER3D_CUSTOM_COLOR | SHADER3D_SKINNED,
+                     lightingVariant | SHADER3D_TEXTURED | SHADER3D_TRANSPARENT });
+    if (!posterPaths.empty()) shaders3D.warm({ lightingVariant | SHADER3D_TEXTURED });
+    std::cout << "Varijanti sejdera: " << shaders2D.variantCount() + shaders3D.variantCount()
+              << " (iz kesa: " << shaders2D.binaryHits() + shaders3D.binaryHits() << ")" << std::endl;
+
+    if (shaders2D.use(0) == 0 || shaders3D.use(lightingVariant) == 0 || shadersBaked.use(0) == 0) {
         std::cout << "GRESKA: Sejderi nisu ucitani!" << std::endl;
         return -1;
     }
     std::cout << "Sejderi uspesno ucitani!" << std::endl;
+    shader2D = renderBackend.addShader(&shaders2D);
+    shader3D = renderBackend.addShader(&shaders3D);
+    shaderBaked = renderBackend.addShader(&shadersBaked);
 
     // ========== UCITAVANJE TEKSTURA ==========
     std::cout << "\n=== UCITAVANJE TEKSTURA ===" << std::endl;
 
-    unsigned int busTexture = loadImageToTexture("Resource Files/Textures/2d_bus.png");
-    unsigned int stationTexture = loadImageToTexture("Resource Files/Textures/bus_station.png");
-    unsigned int controlTexture = loadImageToTexture("Resource Files/Textures/bus_control.png");
-    unsigned int doorClosedTexture = loadImageToTexture("Resource Files/Textures/closed_doors.png");
-    unsigned int doorOpenTexture = loadImageToTexture("Resource Files/Textures/opened_doors.png");
-    unsigned int authorTexture = loadImageToTexture("Resource Files/Textures/author_text.png");
-    unsigned int passengersLabelTexture = loadImageToTexture("Resource Files/Textures/passangers_label.png");
-    unsigned int finesLabelTexture = loadImageToTexture("Resource Files/Textures/fines.png");
+    uint32_t busTexture = renderBackend.loadTexture("Resource Files/Textures/2d_bus.png");
+    uint32_t stationTexture = renderBackend.loadTexture("Resource Files/Textures/bus_station.png");
+    uint32_t controlTexture = renderBackend.loadTexture("Resource Files/Textures/bus_control.png");
+    uint32_t doorClosedTexture = renderBackend.loadTexture("Resource Files/Textures/closed_doors.png");
+    uint32_t doorOpenTexture = renderBackend.loadTexture("Resource Files/Textures/opened_doors.png");
+    uint32_t authorTexture = renderBackend.loadTexture("Resource Files/Textures/author_text.png");
+    uint32_t passengersLabelTexture = renderBackend.loadTexture("Resource Files/Textures/passangers_label.png");
+    uint32_t finesLabelTexture = renderBackend.loadTexture("Resource Files/Textures/fines.png");
 
-    unsigned int numberTextures[10];
+    uint32_t numberTextures[10];
     for (int i = 0; i < 10; i++) {
         std::string path = "Resource Files/Textures/number_" + std::to_string(i) + ".png";
-        numberTextures[i] = loadImageToTexture(path.c_str());
+        numberTextures[i] = renderBackend.loadTexture(path.c_str());
     }
 
-    if (busTexture == 0 || stationTexture == 0 || doorClosedTexture == 0 || passengersLabelTexture == 0 || finesLabelTexture == 0) {
+    if (busTexture == RENDER_NONE || stationTexture == RENDER_NONE || doorClosedTexture == RENDER_NONE ||
+        passengersLabelTexture == RENDER_NONE || finesLabelTexture == RENDER_NONE) {
         std::cout << "GRESKA: Neke teksture nisu ucitane!" << std::endl;
         return -1;
     }
 
     std::cout << "=== SVE TEKSTURE USPESNO UCITANE ===" << std::endl;
 
-    // ========== VAO/VBO/EBO ZA 2D TEKSTURE ==========
+    // ========== MREZE ZA 2D TEKSTURE ==========
     float vertices2D[] = {
         -0.5f, -0.5f,   0.0f, 0.0f,
          0.5f, -0.5f,   1.0f, 0.0f,
@@ -861,497 +746,75 @@ int main()
 
     unsigned int indices2D[] = { 0, 1, 2, 2, 3, 0 };
 
-    unsigned int VAO2D, VBO2D, EBO2D;
-    glGenVertexArrays(1, &VAO2D);
-    glGenBuffers(1, &VBO2D);
-    glGenBuffers(1, &EBO2D);
-
-    glBindVertexArray(VAO2D);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO2D);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices2D), vertices2D, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO2D);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices2D), indices2D, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    glBindVertexArray(0);
-
-    // ========== VAO/VBO ZA 3D SCENU ==========
-    float vertices3D[] = {
-        //X    Y    Z      R    G    B    A         S   T      Nx Ny Nz
-        
-        // KONTROLNI PANEL
-        -0.8,-0.3,-0.5,   0.2, 0.2, 0.2, 1.0,     0,  0,     0, 0, 1,
-         0.8,-0.3,-0.5,   0.2, 0.2, 0.2, 1.0,     1,  0,     0, 0, 1,
-         0.8,-0.5,-0.3,   0.2, 0.2, 0.2, 1.0,     1,  1,     0, 0, 1,
-        -0.8,-0.5,-0.3,   0.2, 0.2, 0.2, 1.0,     0,  1,     0, 0, 1,
-        
-        -0.8,-0.3,-0.5,   0.3, 0.3, 0.3, 1.0,     0,  0,     0, 1, 0,
-        -0.8,-0.5,-0.3,   0.3, 0.3, 0.3, 1.0,     0,  1,     0, 1, 0,
-         0.8,-0.5,-0.3,   0.3, 0.3, 0.3, 1.0,     1,  1,     0, 1, 0,
-         0.8,-0.3,-0.5,   0.3, 0.3, 0.3, 1.0,     1,  0,     0, 1, 0,
-        
-        // VETROBRANSKO STAKLO
-        -0.9, 0.4,-0.6,   0.6, 0.7, 0.8, 0.15,    0,  0,     0, 0, 1,
-         0.9, 0.4,-0.6,   0.6, 0.7, 0.8, 0.15,    1,  0,     0, 0, 1,
-         0.9,-0.3,-0.5,   0.6, 0.7, 0.8, 0.15,    1,  1,     0, 0, 1,
-        -0.9,-0.3,-0.5,   0.6, 0.7, 0.8, 0.15,    0,  1,     0, 0, 1,
-        
-        // RAM VETROBRANA - gore
-        -0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     0, 1, 0,
-         0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     0, 1, 0,
-         0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     0, 1, 0,
-        -0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     0, 1, 0,
-        
-        // RAM VETROBRANA - levo
-        -0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     -1, 0, 0,
-        -0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     -1, 0, 0,
-        -1.0, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     -1, 0, 0,
-        -1.0, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     -1, 0, 0,
-        
-        // RAM VETROBRANA - desno
-         0.9, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  0,     1, 0, 0,
-         1.0, 0.4,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  0,     1, 0, 0,
-         1.0, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     1,  1,     1, 0, 0,
-         0.9, 0.5,-0.6,   0.1, 0.1, 0.1, 1.0,     0,  1,     1, 0, 0,
-        
-        // LEVA STRANA KABINE
-        -1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     -1, 0, 0,
-        -1.0, 0.5,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     -1, 0, 0,
-        -1.0,-0.6,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     -1, 0, 0,
-        -1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     -1, 0, 0,
-        
-        // DESNA STRANA KABINE - gornji deo
-         1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
-         1.0, 0.35, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
-         1.0, 0.35,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
-         1.0, 0.5,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
-        
-        // POD KABINE
-        -1.0,-0.6, 0.5,   0.25, 0.25, 0.25, 1.0,     0,  0,     0, -1, 0,
-        -1.0,-0.6,-0.6,   0.25, 0.25, 0.25, 1.0,     0,  1,     0, -1, 0,
-         1.0,-0.6,-0.6,   0.25, 0.25, 0.25, 1.0,     1,  1,     0, -1, 0,
-         1.0,-0.6, 0.5,   0.25, 0.25, 0.25, 1.0,     1,  0,     0, -1, 0,
-        
-        // PLAFON KABINE
-        -1.0, 0.5, 0.5,   0.9, 0.9, 0.85, 1.0,     0,  0,     0, 1, 0,
-         1.0, 0.5, 0.5,   0.9, 0.9, 0.85, 1.0,     1,  0,     0, 1, 0,
-         1.0, 0.5,-0.6,   0.9, 0.9, 0.85, 1.0,     1,  1,     0, 1, 0,
-        -1.0, 0.5,-0.6,   0.9, 0.9, 0.85, 1.0,     0,  1,     0, 1, 0,
-        
-        // ZADNJA STRANA KABINE
-        -1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     0, 0, 1,
-        -1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     0, 0, 1,
-         1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     1,  1,     0, 0, 1,
-         1.0, 0.5, 0.5,   0.85, 0.80, 0.70, 1.0,     1,  0,     0, 0, 1,
-        
-        // VOLAN
-        -0.15, -0.15, -0.4,   0.1, 0.1, 0.1, 1.0,     0,  0,     0, 0, 1,
-         0.15, -0.15, -0.4,   0.1, 0.1, 0.1, 1.0,     1,  0,     0, 0, 1,
-         0.15, -0.35, -0.4,   0.1, 0.1, 0.1, 1.0,     1,  1,     0, 0, 1,
-        -0.15, -0.35, -0.4,   0.1, 0.1, 0.1, 1.0,     0,  1,     0, 0, 1,
-        
-        // 2D DISPLEJ
-         0.2,  -0.05, -0.4,   0.1, 0.2, 0.4, 1.0,     0,  1,     0, 0, 1,
-         0.5,  -0.05, -0.4,   0.1, 0.2, 0.4, 1.0,     1,  1,     0, 0, 1,
-         0.5,  -0.35, -0.4,   0.1, 0.2, 0.4, 1.0,     1,  0,     0, 0, 1,
-         0.2,  -0.35, -0.4,   0.1, 0.2, 0.4, 1.0,     0,  0,     0, 0, 1,
-        
-        // DESNA STRANA KABINE - prednji deo
-         1.0, 0.35,-0.25,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
-         1.0,-0.55,-0.25,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
-         1.0,-0.55,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
-         1.0, 0.35,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
-        
-        // DESNA STRANA KABINE - zadnji deo
-         1.0, 0.35, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
-         1.0,-0.55, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
-         1.0,-0.55, 0.1,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
-         1.0, 0.35, 0.1,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
-        
-        // DESNA STRANA KABINE - donji deo
-         1.0,-0.55, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  0,     1, 0, 0,
-         1.0,-0.6, 0.5,   0.85, 0.80, 0.70, 1.0,     0,  1,     1, 0, 0,
-         1.0,-0.6,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  1,     1, 0, 0,
-         1.0,-0.55,-0.6,   0.85, 0.80, 0.70, 1.0,     1,  0,     1, 0, 0,
-        
-        // VRATA - okvir gornji
-         1.0, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
-         1.02, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
-         1.02, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
-         1.0, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
-        
-        // Okvir vrata - levi
-         1.0, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
-         1.02, 0.35,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
-         1.02,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
-         1.0,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
-        
-        // Okvir vrata - desni
-         1.0, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
-         1.02, 0.35, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
-         1.02,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
-         1.0,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
-        
-        // Okvir vrata - donji
-         1.0,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     0,  0,     1, 0, 0,
-         1.02,-0.55, 0.1,   0.05, 0.05, 0.05, 1.0,     1,  0,     1, 0, 0,
-         1.02,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     1,  1,     1, 0, 0,
-         1.0,-0.55,-0.25,   0.05, 0.05, 0.05, 1.0,     0,  1,     1, 0, 0,
-        
-        // Površina vrata
-         1.015, 0.33, 0.08,   0.7, 0.7, 0.75, 1.0,     0,  0,     1, 0, 0,
-         1.015, 0.33,-0.23,   0.7, 0.7, 0.75, 1.0,     1,  0,     1, 0, 0,
-         1.015,-0.53,-0.23,   0.7, 0.7, 0.75, 1.0,     1,  1,     1, 0, 0,
-         1.015,-0.53, 0.08,   0.7, 0.7, 0.75, 1.0,     0,  1,     1, 0, 0,
-        
-        // SEDIŠTE VOZAČA - naslonska površina
-        -0.3, 0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  0,     0, 0, 1,
-         0.3, 0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  0,     0, 0, 1,
-         0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  1,     0, 0, 1,
-        -0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  1,     0, 0, 1,
-        
-        // SEDIŠTE VOZAČA - površina za sedenje
-        -0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     0,  0,     0, 1, 0,
-         0.3,-0.2, 0.3,   0.2, 0.3, 0.5, 1.0,     1,  0,     0, 1, 0,
-         0.3,-0.2, 0.0,   0.2, 0.3, 0.5, 1.0,     1,  1,     0, 1, 0,
-        -0.3,-0.2, 0.0,   0.2, 0.3, 0.5, 1.0,     0,  1,     0, 1, 0,
-    };
-    
-    unsigned int stride = (3 + 4 + 2 + 3) * sizeof(float);
-    
-    unsigned int VAO3D;
-    glGenVertexArrays(1, &VAO3D);
-    glBindVertexArray(VAO3D);
-
-    unsigned int VBO3D;
-    glGenBuffers(1, &VBO3D);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO3D);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices3D), vertices3D, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
-    // HUMANOID VAO
-    std::vector<float> humanoidVertices;
-    
-    // GLAVA
-    float headVertices[] = {
-        // Prednja strana glave (blago zaobljena)
-        -0.05f,  0.18f,  0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.05f,  0.18f,  0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana glave
-        -0.05f,  0.18f, -0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.05f,  0.18f, -0.07f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana glave (zaobljena)
-        -0.06f,  0.19f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f,  0.19f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana glave (zaobljena)
-         0.06f,  0.19f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-         0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.06f,  0.19f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-        // Vrh glave (zaobljen)
-        -0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-        -0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-         0.05f,  0.30f,  0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-         0.05f,  0.30f, -0.06f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-        // Vrat (povezuje glavu i trup)
-        -0.03f,  0.18f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.03f,  0.18f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.03f,  0.18f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-        -0.03f,  0.18f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-    };
-    
-    // TRUP
-    float torsoVertices[] = {
-        // Prednja strana trupa (širok na ramenima)
-        -0.09f, -0.05f,  0.06f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.09f, -0.05f,  0.06f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.09f,  0.17f,  0.05f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.09f,  0.17f,  0.05f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana trupa
-        -0.09f, -0.05f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        -0.09f,  0.17f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.09f,  0.17f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.09f, -0.05f, -0.04f,  0.3f, 0.5f, 0.8f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana trupa
-        -0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.09f,  0.17f,  0.05f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        -0.09f,  0.17f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana trupa
-         0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-         0.09f,  0.17f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.09f,  0.17f,  0.05f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-        // Gornji deo trupa (ramena)
-        -0.09f,  0.17f, -0.04f,  0.32f, 0.52f, 0.82f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-        -0.09f,  0.17f,  0.05f,  0.32f, 0.52f, 0.82f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-         0.09f,  0.17f,  0.05f,  0.32f, 0.52f, 0.82f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-         0.09f,  0.17f, -0.04f,  0.32f, 0.52f, 0.82f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-        // Donji deo trupa (struk)
-        -0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.09f, -0.05f, -0.04f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-        -0.09f, -0.05f,  0.06f,  0.28f, 0.48f, 0.78f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-    };
-    
-    // LEVA RUKA
-    float leftArmVertices[] = {
-        // Prednja strana
-        -0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        -0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        -0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana
-        -0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        -0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-        -0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-        -0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana
-        -0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        -0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana (blizu trupa)
-        -0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-        -0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-        -0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-        -0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-    };
-    
-    // DESNA RUKA
-    float rightArmVertices[] = {
-        // Prednja strana
-         0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-         0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana
-         0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-         0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana (blizu trupa)
-         0.09f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-         0.09f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-         0.09f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-         0.09f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana
-         0.12f, -0.04f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-         0.12f,  0.16f, -0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.12f,  0.16f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.12f, -0.04f,  0.03f,  1.0f, 0.85f, 0.7f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-    };
-    
-    // LEVA NOGA
-    float leftLegVertices[] = {
-        // Prednja strana
-        -0.06f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        -0.02f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        -0.02f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.06f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana
-        -0.06f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        -0.06f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-        -0.02f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-        -0.02f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana
-        -0.06f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana
-        -0.02f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-        -0.02f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-        -0.02f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-        -0.02f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-    };
-    
-    // DESNA NOGA
-    float rightLegVertices[] = {
-        // Prednja strana
-         0.02f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.06f, -0.28f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.06f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-         0.02f, -0.05f,  0.04f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Zadnja strana
-         0.02f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-         0.02f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.06f, -0.05f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.06f, -0.28f, -0.02f,  0.2f, 0.2f, 0.6f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        // Leva strana
-         0.02f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-         0.02f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-         0.02f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-         0.02f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana
-         0.06f, -0.28f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-         0.06f, -0.05f, -0.02f,  0.18f, 0.18f, 0.58f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.06f, -0.05f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.06f, -0.28f,  0.04f,  0.18f, 0.18f, 0.58f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-    };
-    
-    // KOSA
-    float hairVertices[] = {
-        // Gornji deo kose (pokriva vrh glave)
-        -0.06f,  0.30f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-         0.06f,  0.30f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-         0.06f,  0.35f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-        -0.06f,  0.35f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-        // Prednji deo kose (šiške)
-        -0.06f,  0.28f,  0.09f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.06f,  0.28f,  0.09f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.06f,  0.32f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.06f,  0.32f,  0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Leva strana kose
-        -0.07f,  0.28f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.07f,  0.28f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f,  0.34f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        -0.06f,  0.34f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f, -1.0f, 0.0f, 0.0f,
-        // Desna strana kose
-         0.07f,  0.28f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-         0.06f,  0.34f, -0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.06f,  0.34f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f, 0.0f,
-         0.07f,  0.28f,  0.06f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f,
-        // Zadnji deo kose
-        -0.06f,  0.30f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-        -0.06f,  0.34f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.06f,  0.34f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, -1.0f,
-         0.06f,  0.30f, -0.08f,  0.2f, 0.15f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, -1.0f,
-    };
-    
-    // KAPICA (za kontrolora) - policijska šilterica
-    float capVertices[] = {
-        // Vrh kapice (glavni deo)
-        -0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-         0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 1.0f, 0.0f,
-         0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-        -0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 1.0f, 0.0f,
-        // Prednja strana kapice
-        -0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        -0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-         0.07f,  0.33f,  0.0f,   0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-         0.07f,  0.30f,  0.07f,  0.05f, 0.05f, 0.1f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-        // Šilterica (štitnik kapice)
-        -0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 0.0f,  0.0f, 0.0f, 1.0f,
-         0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        -0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 1.0f,  0.0f, 0.0f, 1.0f,
-        // Donji deo štitnika
-        -0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.09f,  0.27f,  0.16f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 0.0f,  0.0f, -1.0f, 0.0f,
-         0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  1.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-        -0.09f,  0.28f,  0.08f,  0.02f, 0.02f, 0.05f, 1.0f,  0.0f, 1.0f,  0.0f, -1.0f, 0.0f,
-    };
-    
-    for (int i = 0; i < sizeof(headVertices) / sizeof(float); i++) humanoidVertices.push_back(headVertices[i]);
-    for (int i = 0; i < sizeof(torsoVertices) / sizeof(float); i++) humanoidVertices.push_back(torsoVertices[i]);
-    for (int i = 0; i < sizeof(leftArmVertices) / sizeof(float); i++) humanoidVertices.push_back(leftArmVertices[i]);
-    for (int i = 0; i < sizeof(rightArmVertices) / sizeof(float); i++) humanoidVertices.push_back(rightArmVertices[i]);
-    for (int i = 0; i < sizeof(leftLegVertices) / sizeof(float); i++) humanoidVertices.push_back(leftLegVertices[i]);
-    for (int i = 0; i < sizeof(rightLegVertices) / sizeof(float); i++) humanoidVertices.push_back(rightLegVertices[i]);
-
-    unsigned int humanoidVAO, humanoidVBO;
-    glGenVertexArrays(1, &humanoidVAO);
-    glGenBuffers(1, &humanoidVBO);
-
-    glBindVertexArray(humanoidVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, humanoidVBO);
-    glBufferData(GL_ARRAY_BUFFER, humanoidVertices.size() * sizeof(float), humanoidVertices.data(), GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-
-    glBindVertexArray(0);
-
-    // ========== VAO ZA KOSU ==========
-    std::vector<float> hairOnlyVertices;
-    for (int i = 0; i < sizeof(hairVertices) / sizeof(float); i++) {
-        hairOnlyVertices.push_back(hairVertices[i]);
-    }
-    
-    unsigned int hairVAO, hairVBO;
-    glGenVertexArrays(1, &hairVAO);
-    glGenBuffers(1, &hairVBO);
-    
-    glBindVertexArray(hairVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, hairVBO);
-    glBufferData(GL_ARRAY_BUFFER, hairOnlyVertices.size() * sizeof(float), hairOnlyVertices.data(), GL_STATIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-    
-    glBindVertexArray(0);
-
-    // ========== VAO ZA KAPICU (SAMO ZA KONTROLORA) ==========
-    std::vector<float> capOnlyVertices;
-    for (int i = 0; i < sizeof(capVertices) / sizeof(float); i++) {
-        capOnlyVertices.push_back(capVertices[i]);
+    uint32_t quadBuffer = renderBackend.createBuffer(vertices2D, sizeof(vertices2D), BUFFER_STATIC);
+    uint32_t quadIndexBuffer = renderBackend.createBuffer(indices2D, sizeof(indices2D), BUFFER_STATIC);
+    quadMesh = renderBackend.createMesh({
+        { 0, quadBuffer, 2, 4 * sizeof(float), 0, 0 },
+        { 1, quadBuffer, 2, 4 * sizeof(float), 2 * sizeof(float), 0 }
+    }, quadIndexBuffer);
+
+    // ========== MREZE ZA 3D SCENU ==========
+    std::vector<float> vertices3D;
+    buildCabinVertices(vertices3D);
+    uint32_t cabinMesh = create3DMesh(vertices3D);
+
+    // ========== MREZA ZA PUTNIKE (SVE VARIJANTE) ==========
+    // Jedan bafer temena i jedan bafer indeksa; varijanta bira baseVertex i opsege indeksa.
+    // Uz svako teme ide i indeks kosti (atribut 5) za SKINNED varijantu.
+    buildHumanoidVariants(passengerMeshes);
+    uint32_t passengerBuffer = renderBackend.createBuffer(passengerMeshes.vertices.data(),
+                                                          passengerMeshes.vertices.size() * sizeof(float), BUFFER_STATIC);
+    uint32_t passengerBoneBuffer = renderBackend.createBuffer(passengerMeshes.bones.data(),
+                                                              passengerMeshes.bones.size() * sizeof(float), BUFFER_STATIC);
+    uint32_t passengerIndexBuffer = renderBackend.createBuffer(passengerMeshes.indices.data(),
+                                                               passengerMeshes.indices.size() * sizeof(uint32_t), BUFFER_STATIC);
+    std::vector<MeshAttribute> passengerAttributes = vertex3DAttributes(passengerBuffer);
+    passengerAttributes.push_back({ 5, passengerBoneBuffer, 1, sizeof(float), 0, 0 });
+    uint32_t passengerMesh = renderBackend.createMesh(passengerAttributes, passengerIndexBuffer);
+
+    // ========== MREZA ZA GUZVU NA PERONU (INSTANCIRANO) ==========
+    // Osnovni humanoid kao lista trouglova, da bi cela guzva bila jedan instancirani poziv
+    std::vector<float> crowdVertices;
+    std::vector<float> crowdBones;
+    buildHumanoidTriangles(defaultHumanoidParams(), crowdVertices, crowdBones);
+    buildHumanoidSkeleton(defaultHumanoidParams(), crowdSkeleton);
+    crowdVertexCount = (int)crowdVertices.size() / VERTEX_3D_FLOATS;
+
+    uint32_t crowdBuffer = renderBackend.createBuffer(crowdVertices.data(), crowdVertices.size() * sizeof(float), BUFFER_STATIC);
+    uint32_t crowdBoneBuffer = renderBackend.createBuffer(crowdBones.data(), crowdBones.size() * sizeof(float), BUFFER_STATIC);
+    std::vector<MeshAttribute> crowdAttributes = vertex3DAttributes(crowdBuffer);
+    crowdAttributes.push_back({ 5, crowdBoneBuffer, 1, sizeof(float), 0, 0 });
+    // Podaci po instanci: world matrica iz BusScene (4 kolone na lokacijama 6-9)
+    crowdInstanceBuffer = renderBackend.createBuffer(NULL, 0, BUFFER_STREAM);
+    for (uint32_t column = 0; column < 4; column++) {
+        crowdAttributes.push_back({ 6 + column, crowdInstanceBuffer, 4, (int)sizeof(glm::mat4), (int)(column * 4 * sizeof(float)), 1 });
     }
-    
-    unsigned int capVAO, capVBO;
-    glGenVertexArrays(1, &capVAO);
-    glGenBuffers(1, &capVBO);
-    
-    glBindVertexArray(capVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, capVBO);
-    glBufferData(GL_ARRAY_BUFFER, capOnlyVertices.size() * sizeof(float), capOnlyVertices.data(), GL_STATIC_DRAW);
-    
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(7 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, stride, (void*)(10 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-    
-    glBindVertexArray(0);
+    crowdMesh = renderBackend.createMesh(crowdAttributes);
 
     // ========== INICIJALIZACIJA ==========
     initStations();
-    setupPathVAO();
-    setupCircleVAO();
-    setupDisplayFramebuffer();
+    setupPathMesh();
+    setupCircleMesh();
+    displayTarget = renderBackend.createTarget(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    uint32_t displayTexture = renderBackend.targetTexture(displayTarget);
     setupRoad3D();
     setupStation3D();
+    if (!posterPaths.empty()) setupPosters();
+    perfOverlay.init(renderBackend);
+    clusteredLighting.init(renderBackend);
+    initBonePalette();
+    jobs.init(jobThreads);
+
+    // Cilj umanjene scene je pune velicine; kontroler menja samo viewport, pa nema
+    // pravljenja ciljeva tokom voznje
+    dynamicResolution.init(SCENE_BUDGET_MS, minResolutionScale);
+    if (fixedResolutionScale > 0.0f) dynamicResolution.setFixed(fixedResolutionScale);
+    if (!softwareRendering && !(dynamicResolution.isFixed() && dynamicResolution.scale() >= 1.0f)) {
+        sceneTarget = renderBackend.createTarget(mode->width, mode->height);
+    }
+    sceneTimer = renderBackend.createTimer();
+
     
-    glm::mat4 model = glm::mat4(1.0f);
     glm::vec3 cameraPos = glm::vec3(0.0, 0.0, 0.15);
     glm::vec3 cameraUp = glm::vec3(0.0, 1.0, 0.0);
     
@@ -1369,8 +832,48 @@ int main()
     glm::vec3 materialKA = glm::vec3(0.4f, 0.4f, 0.4f);  // Ambient refleksija
     glm::vec3 materialKD = glm::vec3(0.8f, 0.8f, 0.8f);  // Diffuse refleksija 
     glm::vec3 materialKS = glm::vec3(0.5f, 0.5f, 0.5f);  // Specular refleksija
+
+    // Nocu je "sunce" priguseno, svet osvetljavaju svetla duz puta; kabina zadrzava svoje svetlo
+    bool night = nightLightCount > 0;
+    glm::vec3 worldLightKA = night ? lightKA * 0.15f : lightKA;
+    glm::vec3 worldLightKD = night ? lightKD * 0.1f : lightKD;
+    glm::vec3 worldLightKS = night ? lightKS * 0.1f : lightKS;
+    const float zNear = 0.05f, zFar = 1000.0f;
+    if (night) {
+        std::cout << "Nocna voznja: " << nightLightCount << " svetala duz puta" << std::endl;
+    }
+
+    // Svetlo i kamera su nepomicni, pa se staticki kvadri peku jednom. Nocu put osvetljavaju
+    // pokretna svetla, pa tada sve ide kroz shaders3D.
+    bakedLighting = bakeLighting && !night && !softwareRendering;
+    if (bakedLighting) {
+        BakeLight bakeLight = { lightPos, lightKA, lightKD, lightKS };
+        BakeMaterial bakeMaterial = { materialKA, materialKD, materialKS, materialShine };
+        int cabinQuads = (int)(vertices3D.size() / (4 * VERTEX_3D_FLOATS));
+        setupBakedLighting(vertices3D.data(), cabinQuads, cabinMesh, bakeLight, bakeMaterial, cameraPos);
+    }
     
+    // Scena za softversko crtanje (--software ili F12) - iste vrednosti kao za sejdere
+    SoftSceneSettings softScene;
+    softScene.cameraPos = cameraPos;
+    softScene.cameraUp = cameraUp;
+    softScene.light = { lightPos, lightKA, lightKD, lightKS };
+    softScene.material = { materialKA, materialKD, materialKS, materialShine };
+    softScene.zNear = zNear;
+    softScene.zFar = zFar;
+    softScene.roadLength = ROAD_LENGTH;
+    softScene.stationDistance = STATION_DISTANCE;
+    if (softwareRendering) {
+        if (!softwareRenderer.init(mode->width, mode->height, softScene, &jobs)) {
+            std::cout << "GRESKA: Softversko crtanje nije pokrenuto!" << std::endl;
+            return -1;
+        }
+        setupSoftwareTexture(mode->width, mode->height);
+        std::cout << "Softversko crtanje: " << softwareRenderer.threadCount() << " niti" << std::endl;
+    }
+
     auto lastTime = std::chrono::high_resolution_clock::now();
+    long long frameIndex = 0;
 
     std::cout << "\n========================================" << std::endl;
     std::cout << "=== PROGRAM POKRENUT ===" << std::endl;
@@ -1380,9 +883,18 @@ int main()
     std::cout << "  K - kontrola ulazi" << std::endl;
     std::cout << "  1/2 - ukljuci/iskljuci depth test" << std::endl;
     std::cout << "  3/4 - ukljuci/iskljuci face culling" << std::endl;
+    std::cout << "  F3 - statistika frejmova" << std::endl;
+    std::cout << "  F9 - snimanje videa / pauza (" << videoPath << ")" << std::endl;
+    std::cout << "  F10 - snimak komandi frejma (" << capturePath << ")" << std::endl;
+    std::cout << "  F12 - snimak ekrana (screenshot_*.ppm)" << std::endl;
     std::cout << "  ESC - izlaz" << std::endl;
     std::cout << "========================================\n" << std::endl;
 
+    // ========== NIT SIMULACIJE ==========
+    // Od ovog trenutka sim pripada niti simulacije; glavna nit cita samo snimke
+    sim.stationCrowd.setJobSystem(&jobs);
+    simThread.start(&inputRecorder, replayActive ? &inputReplayer : nullptr);
+
     // ========== GLAVNA PETLJA ==========
     while (!glfwWindowShouldClose(window))
     {
@@ -1396,479 +908,383 @@ int main()
         }
         float dt = deltaTime.count();
         lastTime = currentTime;
+        glStats.reset();
 
-        // ========== LOGIKA ==========
-        // Testiranje dubine
-        if (glfwGetKey(window, GLFW_KEY_1) == GLFW_PRESS && !key1Pressed) {
-            depthTestEnabled = true;
-            glEnable(GL_DEPTH_TEST);
-            std::cout << "Depth Test: UKLJUČEN" << std::endl;
-            key1Pressed = true;
-        }
-        if (glfwGetKey(window, GLFW_KEY_1) == GLFW_RELEASE) {
-            key1Pressed = false;
-        }
-        
-        if (glfwGetKey(window, GLFW_KEY_2) == GLFW_PRESS && !key2Pressed) {
-            depthTestEnabled = false;
-            glDisable(GL_DEPTH_TEST);
-            std::cout << "Depth Test: ISKLJUČEN" << std::endl;
-            key2Pressed = true;
-        }
-        if (glfwGetKey(window, GLFW_KEY_2) == GLFW_RELEASE) {
-            key2Pressed = false;
-        }
+        // ========== SNIMAK SIMULACIJE ==========
+        // Najnovije objavljeno stanje; simulacija za to vreme vec racuna sledeci korak
+        const SimSnapshot& snap = simThread.acquireSnapshot();
 
-        // Odstranjivanje lica
-        if (glfwGetKey(window, GLFW_KEY_3) == GLFW_PRESS && !key3Pressed) {
-            faceCullingEnabled = true;
-            glEnable(GL_CULL_FACE);
-            std::cout << "Face Culling: UKLJUČEN (uklanja zadnja lica - GL_BACK)" << std::endl;
-            key3Pressed = true;
+        // ========== STRIMOVANJE TEKSTURA ==========
+        // Upload van liste komandi, u svom prolazu (bajtovi ulaze u budzet uploada)
+        if (posterMesh != RENDER_NONE) {
+            glStats.beginPass("stream");
+            updatePosters(snap);
         }
-        if (glfwGetKey(window, GLFW_KEY_3) == GLFW_RELEASE) {
-            key3Pressed = false;
-        }
-        
-        if (glfwGetKey(window, GLFW_KEY_4) == GLFW_PRESS && !key4Pressed) {
-            faceCullingEnabled = false;
-            glDisable(GL_CULL_FACE);
-            std::cout << "Face Culling: ISKLJUČEN" << std::endl;
-            key4Pressed = true;
-        }
-        if (glfwGetKey(window, GLFW_KEY_4) == GLFW_RELEASE) {
-            key4Pressed = false;
-        }
-
 
-        bool isBusMoving = !busAtStation;
-
-        if (isBusMoving) {
-            wheelRotation = sin(glfwGetTime() * 0.8f) * 15.0f;
-            busShakeTime += 0.016f;
-            busShakeOffset = sin(busShakeTime * busShakeSpeed) * busShakeAmplitude;
+        // ========== ZAPIS FREJMA ==========
+        // Crtanje se samo zapisuje; izvrsava se ispod, posle zapisa celog frejma
+        RenderCommandList& list = frameCommands;
+        list.reset();
+        list.setState(STATE_BLEND, true);
+        list.setState(STATE_CULL_FACE, snap.faceCullingEnabled);
+
+        bool scaledScene = sceneTarget != RENDER_NONE && dynamicResolution.scale() < 1.0f;
+        float sceneScale = scaledScene ? dynamicResolution.scale() : 1.0f;
+        int sceneWidth = scaledScene ? dynamicResolution.scaledWidth(mode->width) : mode->width;
+        int sceneHeight = scaledScene ? dynamicResolution.scaledHeight(mode->height) : mode->height;
+
+        if (softwareRendering) {
+            // ========== SOFTVERSKO CRTANJE ==========
+            list.beginPass("software");
+            softwareRenderer.render(snap);
+            presentSoftwareFrame(list);
         } else {
-            if (wheelRotation > 0.5f) {
-                wheelRotation -= wheelRotationSpeed * 0.5f;
-            } else if (wheelRotation < -0.5f) {
-                wheelRotation += wheelRotationSpeed * 0.5f;
+            // ========== RENDEROVANJE 2D DISPLEJA ==========
+            list.beginPass("display");
+            render2DDisplay(list, snap, numberTextures, busTexture, doorClosedTexture, 
+                           doorOpenTexture, passengersLabelTexture, finesLabelTexture, controlTexture);
+
+            // ========== RENDEROVANJE 3D SCENE ==========
+            // Umanjena scena ide u donji levi ugao sceneTarget-a; razmera ekrana ostaje ista
+            list.beginPass("scene");
+            if (scaledScene) {
+                list.setTarget(sceneTarget);
+                list.setViewport(sceneWidth, sceneHeight);
             } else {
-                wheelRotation = 0.0f;
+                list.setTarget(RENDER_SCREEN);
             }
-            busShakeOffset = 0.0f;
-            busShakeTime = 0.0f;
-        }
+            list.beginTimer(sceneTimer);
+            if (night) list.clear(glm::vec4(0.02f, 0.03f, 0.08f, 1.0f));
+            else list.clear(glm::vec4(0.53f, 0.81f, 0.92f, 1.0f));
+            list.setState(STATE_DEPTH_TEST, snap.depthTestEnabled);
+
+            list.usePipeline(shader3D, lightingVariant);
+
+            // Preracunavaju se samo cvorovi cija se lokalna matrica promenila (i njihovi potomci)
+            busScene.update(snap, STATION_DISTANCE);
+            const glm::mat4& shakeModel = busScene.cabin();
+
+            glm::mat4 view = glm::lookAt(cameraPos, cameraPos + snap.cameraFront, cameraUp);
+            float aspect = (float)mode->width / (float)mode->height;
+            glm::mat4 projection = glm::perspective(glm::radians(snap.fov), aspect, zNear, zFar);
+
+            list.setMat4(shader3D, "uM", shakeModel);
+            list.setMat4(shader3D, "uV", view);
+            list.setMat4(shader3D, "uP", projection);
+            // Nevezan program dobija vrednosti pri svom sledecem use()
+            list.setMat4(shaderBaked, "uV", view);
+            list.setMat4(shaderBaked, "uP", projection);
+        
+            // Phong lighting uniforms
+            list.setVec3(shader3D, "uLight.pos", lightPos);
+            list.setVec3(shader3D, "uLight.kA", lightKA);
+            list.setVec3(shader3D, "uLight.kD", lightKD);
+            list.setVec3(shader3D, "uLight.kS", lightKS);
+        
+            list.setFloat(shader3D, "uMaterial.shine", materialShine);
+            list.setVec3(shader3D, "uMaterial.kA", materialKA);
+            list.setVec3(shader3D, "uMaterial.kD", materialKD);
+            list.setVec3(shader3D, "uMaterial.kS", materialKS);
+        
+            list.setVec3(shader3D, "uViewPos", cameraPos);
 
-        // Logika simulacije autobusa
-        if (busAtStation) {
-            stationTimer += dt;
-
-            if (leftMousePressed && !passengerEntering && !passengerExiting) {
-                if (passengers < 50) {
-                    passengers++;
-                    addPassenger(false);
-                    passengerEntering = true;
-                    passengerAnimTimer = 0.0f;
-                    std::cout << "Usao putnik. Ukupno: " << passengers << std::endl;
-                }
-            }
-            if (rightMousePressed && !passengerEntering && !passengerExiting) {
-                if (passengers > 0) {
-                    passengers--;
-                    removePassenger(false);
-                    passengerExiting = true;
-                    passengerAnimTimer = 0.0f;
-                    std::cout << "Izasao putnik. Ukupno: " << passengers << std::endl;
-                }
+            glm::mat4 worldModel = glm::mat4(1.0f);
+        
+            float distanceToNextStation = (1.0f - snap.busProgress) * STATION_DISTANCE;
+
+            // Klasterovana svetla: raspodela po klasterima za ovaj pogled, pa upload u TBO-e
+            if (night) {
+                buildRouteLights(-distanceToNextStation, STATION_DISTANCE, ROAD_LENGTH, snap.simTime,
+                                 nightLightCount, routeLights);
+                lightGrid.build(routeLights, view, glm::radians(snap.fov), aspect, zNear, zFar);
+                clusteredLighting.record(list, shader3D, sceneWidth, sceneHeight, lightGrid);
             }
 
-            if (keyKPressed && !isInspectorInBus && !passengerEntering && !passengerExiting) {
-                if (passengers < 50) {
-                    isInspectorInBus = true;
-                    passengers++;
-                    addPassenger(true);
-                    inspectorExitStation = (currentStation + 1) % NUM_STATIONS;
-                    passengerEntering = true;
-                    passengerAnimTimer = 0.0f;
-                    std::cout << ">>> KONTROLA USLA U AUTOBUS na stanici " << currentStation << " <<<" << std::endl;
-                } else {
-                    std::cout << ">>> KONTROLA NE MOZE DA UDJE - AUTOBUS JE PUN (50 putnika) <<<" << std::endl;
-                }
-            }
+            // Poze svih agenata (putnici pa guzva) u paletu kostiju, jedan upload za ceo frejm
+            recordBonePalette(list, snap);
 
-            if (stationTimer >= STATION_WAIT_TIME) {
-                busAtStation = false;
-                stationTimer = 0.0f;
-                busProgress = 0.0f;
-                doorClosing = true;
-                doorOpening = false;
-                std::cout << "Autobus krece ka stanici " << nextStation << std::endl;
-            }
-        }
-        else {
-            busProgress += BUS_SPEED * dt;
-            if (busProgress >= 1.0f) {
-                busProgress = 1.0f;
-                busAtStation = true;
-                stationTimer = 0.0f;
-                currentStation = nextStation;
-                nextStation = (currentStation + 1) % NUM_STATIONS;
-                std::cout << "Autobus stigao na stanicu " << currentStation << std::endl;
-
-                doorOpening = true;
-                doorClosing = false;
-
-                if (isInspectorInBus && currentStation == inspectorExitStation) {
-                    passengers--;
-                    removePassenger(true);
-                    int passengersWithoutInspector = passengers;
-                    int maxFines = passengersWithoutInspector > 0 ? passengersWithoutInspector : 0;
-                    int fines = (maxFines > 0) ? (rand() % (maxFines + 1)) : 0;
-                    totalFines += fines;
-                    std::cout << ">>> KONTROLA IZASLA na stanici " << currentStation << "! Naplaceno " << fines << " kazni. Ukupno kazni: " << totalFines << " <<<" << std::endl;
-                    isInspectorInBus = false;
-                    inspectorExitStation = -1;
-                }
+            // ===== Kabina kao zaklon =====
+            // Neprozirni delovi kabine se crtaju prvi i upisuju 1 u stencil; svet se posle crta
+            // samo gde je stencil 0 (vetrobran, otvor vrata, procepi), pa se pikseli iza zidova
+            // i panela ne sencaju. Vetrobran i displej su prozirni, pa idu posle sveta.
+            list.setStencil(STENCIL_WRITE, 1);
+            list.setMat4(shader3D, "uM", shakeModel);
+
+            list.bindMesh(cabinMesh);
+
+            // Staticki delovi kabine su peceni; volan, displej i vrata se pomeraju/teksturisu
+            if (bakedLighting) {
+                list.bindTexture(LIGHTMAP_TEXTURE_UNIT, lightmapTexture);
+                list.setMat4(shaderBaked, "uM", shakeModel);
+                list.usePipeline(shaderBaked, 0);
             }
-        }
-        
-        // Automatska animacija vrata
-        if (doorOpening) {
-            doorOffset += doorSpeed;
-            if (doorOffset >= doorMaxOffset) {
-                doorOffset = doorMaxOffset;
-                doorOpening = false;
+            for (int i = 0; i < 11; ++i) {
+                if (i != 2) list.draw(PRIMITIVE_TRIANGLE_FAN, i * 4, 4);
             }
-        }
-        if (doorClosing) {
-            doorOffset -= doorSpeed;
-            if (doorOffset <= 0.0f) {
-                doorOffset = 0.0f;
-                doorClosing = false;
+            for (int i = 13; i < 20; ++i) {
+                list.draw(PRIMITIVE_TRIANGLE_FAN, i * 4, 4);
             }
-        }
-
-        if (passengerEntering || passengerExiting) {
-            passengerAnimTimer += dt;
-            if (passengerAnimTimer >= passengerAnimDuration) {
-                passengerEntering = false;
-                passengerExiting = false;
-                passengerAnimTimer = 0.0f;
+            // Sedista
+            for (int i = 21; i < 23; ++i) {
+                list.draw(PRIMITIVE_TRIANGLE_FAN, i * 4, 4);
             }
-        }
-
-        updatePassengers(dt);
-
-        leftMousePressed = false;
-        rightMousePressed = false;
-        keyKPressed = false;
+            list.usePipeline(shader3D, lightingVariant);
 
-        // ========== RENDEROVANJE 2D DISPLEJA ==========
-        render2DDisplay(shader2D, VAO2D, numberTextures, busTexture, doorClosedTexture, 
-                       doorOpenTexture, passengersLabelTexture, finesLabelTexture, controlTexture);
-
-        // ========== RENDEROVANJE 3D SCENE ==========
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glViewport(0, 0, mode->width, mode->height);
-        glClearColor(0.53f, 0.81f, 0.92f, 1.0f);  
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); 
+            // Animacija volana
+            list.setMat4(shader3D, "uM", busScene.wheel());
+            list.draw(PRIMITIVE_TRIANGLE_FAN, 11 * 4, 4);
 
-        glUseProgram(shader3D);
+            // Animacija vrata
+            list.setMat4(shader3D, "uM", busScene.door());
+            list.draw(PRIMITIVE_TRIANGLE_FAN, 20 * 4, 4);
 
-        glm::mat4 shakeModel = model;
-        shakeModel = glm::translate(shakeModel, glm::vec3(0.0f, busShakeOffset, 0.0f));
+            // ===== Svet kroz otvore kabine =====
+            list.setStencil(STENCIL_EQUAL, 0);
+            list.setMat4(shader3D, "uM", worldModel);
 
-        glm::mat4 view = glm::lookAt(cameraPos, cameraPos + cameraFront, cameraUp);
-        glm::mat4 projection = glm::perspective(glm::radians(fov), (float)mode->width / (float)mode->height, 0.05f, 1000.0f);
-
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(shakeModel));
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uV"), 1, GL_FALSE, glm::value_ptr(view));
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uP"), 1, GL_FALSE, glm::value_ptr(projection));
+            // Phong lighting za svet
+            list.setVec3(shader3D, "uLight.kA", worldLightKA);
+            list.setVec3(shader3D, "uLight.kD", worldLightKD);
+            list.setVec3(shader3D, "uLight.kS", worldLightKS);
         
-        // Phong lighting uniforms
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.pos"), 1, glm::value_ptr(lightPos));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kA"), 1, glm::value_ptr(lightKA));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kD"), 1, glm::value_ptr(lightKD));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kS"), 1, glm::value_ptr(lightKS));
+            list.bindMesh(roadMesh);
+            if (bakedLighting) {
+                list.setMat4(shaderBaked, "uM", worldModel);
+                list.usePipeline(shaderBaked, 0);
+            }
         
-        glUniform1f(glGetUniformLocation(shader3D, "uMaterial.shine"), materialShine);
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kA"), 1, glm::value_ptr(materialKA));
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kD"), 1, glm::value_ptr(materialKD));
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kS"), 1, glm::value_ptr(materialKS));
+            for (int i = 0; i < 4; ++i) {
+                list.draw(PRIMITIVE_TRIANGLE_FAN, i * 4, 4);
+            }
+            list.usePipeline(shader3D, lightingVariant);
         
-        glUniform3fv(glGetUniformLocation(shader3D, "uViewPos"), 1, glm::value_ptr(cameraPos));
+            list.bindMesh(stationMesh);
         
-        glUniform1i(glGetUniformLocation(shader3D, "useTex"), false);
-        glUniform1i(glGetUniformLocation(shader3D, "transparent"), true);
-        glUniform1i(glGetUniformLocation(shader3D, "useCustomColor"), false);
+            for (int stationIdx = 0; stationIdx < VISIBLE_STATIONS; stationIdx++) {
+                list.setMat4(shader3D, "uM", busScene.station(stationIdx));
+            
+                for (int i = 0; i < 9; ++i) {
+                    list.draw(PRIMITIVE_TRIANGLE_FAN, i * 4, 4);
+                }
+            }
 
-        glm::mat4 worldModel = glm::mat4(1.0f);
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(worldModel));
+            // Posteri - siva zamena dok slika ne stigne na GPU
+            if (posterMesh != RENDER_NONE) {
+                list.bindMesh(posterMesh);
+                list.usePipeline(shader3D, lightingVariant | SHADER3D_TEXTURED);
+                list.setInt(shader3D, "uTex", 0);
+                for (int stationIdx = 0; stationIdx < VISIBLE_STATIONS; stationIdx++) {
+                    int station = (snap.nextStation + stationIdx) % NUM_STATIONS;
+                    list.bindTexture(0, textureStreamer.texture(posterHandles[station]));
+                    list.setMat4(shader3D, "uM", busScene.station(stationIdx));
+                    list.draw(PRIMITIVE_TRIANGLE_FAN, 0, 4);
+                }
+                list.usePipeline(shader3D, lightingVariant);
+            }
+
+            // Guzva na peronima - jedan instancirani poziv po stanici; bafer se salje samo kad se
+            // neki agent pomerio
+            if (busScene.crowdChanged() && busScene.crowdSize() > 0) {
+                list.updateBuffer(crowdInstanceBuffer, busScene.crowdInstances(), busScene.crowdSize() * sizeof(glm::mat4));
+            }
+            list.bindMesh(crowdMesh);
+            list.usePipeline(shader3D, lightingVariant | SHADER3D_INSTANCED | SHADER3D_SKINNED);
+            list.setInt(shader3D, "uBones", BONE_PALETTE_TEXTURE_UNIT);
+            list.setInt(shader3D, "uBoneBase", (int)snap.activePassengers.size() * HUMANOID_BONES);
+            list.setInt(shader3D, "uBonesPerInstance", HUMANOID_BONES);
+            for (int stationIdx = 0; stationIdx < VISIBLE_STATIONS; stationIdx++) {
+                list.setMat4(shader3D, "uM", busScene.station(stationIdx));
+                list.drawInstanced(PRIMITIVE_TRIANGLES, 0, crowdVertexCount, snap.crowdCount);
+            }
+            list.usePipeline(shader3D, lightingVariant);
+            list.setStencil(STENCIL_OFF);
         
-        // Phong lighting za svet
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.pos"), 1, glm::value_ptr(lightPos));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kA"), 1, glm::value_ptr(lightKA));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kD"), 1, glm::value_ptr(lightKD));
-        glUniform3fv(glGetUniformLocation(shader3D, "uLight.kS"), 1, glm::value_ptr(lightKS));
+            // ===== Prozirni delovi kabine, preko sveta =====
+            list.setMat4(shader3D, "uM", shakeModel);
+            list.setVec3(shader3D, "uLight.kA", lightKA);
+            list.setVec3(shader3D, "uLight.kD", lightKD);
+            list.setVec3(shader3D, "uLight.kS", lightKS);
+
+            list.bindMesh(cabinMesh);
+
+            // Vetrobran
+            if (bakedLighting) {
+                list.setMat4(shaderBaked, "uM", shakeModel);
+                list.usePipeline(shaderBaked, 0);
+            }
+            list.draw(PRIMITIVE_TRIANGLE_FAN, 2 * 4, 4);
+
+            // Crtanje 2D displeja sa teksturom
+            list.usePipeline(shader3D, lightingVariant | SHADER3D_TEXTURED | SHADER3D_TRANSPARENT);
+            list.bindTexture(0, displayTexture);
+            list.setInt(shader3D, "uTex", 0);
+            list.draw(PRIMITIVE_TRIANGLE_FAN, 12 * 4, 4);
+
+            // Crtanje putnika (boja delova tela je uniforma, ne boja temena)
+            list.beginPass("passengers");
+            // Sve varijante su u jednoj mrezi, pa se mreza vezuje jednom; po delu tela jedan poziv
+            list.bindMesh(passengerMesh);
+            list.usePipeline(shader3D, lightingVariant | SHADER3D_CUSTOM_COLOR | SHADER3D_SKINNED);
+            list.setInt(shader3D, "uBones", BONE_PALETTE_TEXTURE_UNIT);
         
-        glUniform1f(glGetUniformLocation(shader3D, "uMaterial.shine"), materialShine);
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kA"), 1, glm::value_ptr(materialKA));
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kD"), 1, glm::value_ptr(materialKD));
-        glUniform3fv(glGetUniformLocation(shader3D, "uMaterial.kS"), 1, glm::value_ptr(materialKS));
+            for (size_t i = 0; i < snap.activePassengers.size(); i++) {
+                const Passenger& p = snap.activePassengers[i];
+                const HumanoidVariant& variant = passengerMeshes.variants[clampHumanoidVariant(p.characterModel)];
+                auto drawPart = [&](HumanoidPart part) {
+                    const HumanoidIndexRange& range = variant.parts[part];
+                    if (range.count > 0) list.drawIndexed(PRIMITIVE_TRIANGLES, range.count, range.first, variant.baseVertex);
+                };
+            
+                // Noge, ruke i sedanje su u paleti kostiju; uM postavlja putnika u kabinu
+                list.setMat4(shader3D, "uM", busScene.passenger(i));
+                list.setInt(shader3D, "uBoneBase", (int)i * HUMANOID_BONES);
+                list.setVec3(shader3D, "uCustomColor", glm::vec3(1.0f, 0.85f, 0.7f));
+                drawPart(HUMANOID_SKIN);
+            
+                list.setVec3(shader3D, "uCustomColor", p.shirtColor);
+                drawPart(HUMANOID_SHIRT);
+            
+                list.setVec3(shader3D, "uCustomColor", p.pantsColor);
+                drawPart(HUMANOID_LEFT_LEG);
+                drawPart(HUMANOID_RIGHT_LEG);
+            
+                // Kosa (boja putnika) ili tamnoplava kapica kontrolora
+                glm::vec3 headwearColor = variant.params.cap ? glm::vec3(0.02f, 0.02f, 0.08f) : p.hairColor;
+                list.setVec3(shader3D, "uCustomColor", headwearColor);
+                drawPart(HUMANOID_HEADWEAR);
+            }
         
-        glBindVertexArray(roadVAO);
+            list.endTimer(sceneTimer);
+
+            // HUD i overlay su uvek u punoj rezoluciji, preko razvucene scene
+            if (scaledScene) {
+                list.beginPass("upscale");
+                list.blit(sceneTarget, sceneWidth, sceneHeight, RENDER_SCREEN);
+            }
+
+            list.beginPass("hud");
+            list.setTarget(RENDER_SCREEN);
+            list.setState(STATE_DEPTH_TEST, false);
         
+            list.usePipeline(shader2D, 0);
+            list.bindMesh(quadMesh);
         
-        for (int i = 0; i < 4; ++i) {
-            glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-        }
+            // Identity matrix za 2D prostor
+            float identityMatrix[16] = {
+                1.0f, 0.0f, 0.0f, 0.0f,
+                0.0f, 1.0f, 0.0f, 0.0f,
+                0.0f, 0.0f, 1.0f, 0.0f,
+                0.0f, 0.0f, 0.0f, 1.0f
+            };
+            list.setMat4(shader2D, "uModel", identityMatrix);
         
-        glBindVertexArray(station3DVAO);
+            list.bindTexture(0, authorTexture);
         
-        float distanceToNextStation = (1.0f - busProgress) * STATION_DISTANCE;
+            list.setFloat(shader2D, "uAlpha", 1.0f);
         
-        for (int stationIdx = 0; stationIdx < 5; stationIdx++) {
-            float stationZ = -distanceToNextStation - (stationIdx * STATION_DISTANCE);
-            
-            glm::mat4 stationModel = glm::mat4(1.0f);
-            stationModel = glm::translate(stationModel, glm::vec3(6.0f, 0.0f, stationZ));
-            glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(stationModel));
-            
-            for (int i = 0; i < 9; ++i) {
-                glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-            }
+            setModelMatrix(list, 0.7f, 0.8f, 0.25f, 0.15f);
+            list.drawIndexed(PRIMITIVE_TRIANGLES, 6);
         }
-        
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(shakeModel));
 
-        glBindVertexArray(VAO3D);
+        renderBackend.execute(list);
 
-        for (int i = 0; i < 11; ++i) {
-            glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
+        frameIndex++;
+        if (captureRequested || frameIndex == captureFrame) {
+            captureRequested = false;
+            renderBackend.saveCapture(capturePath, list);
         }
 
-        // Animacija volana
-        glm::mat4 wheelModel = shakeModel;
-        glm::vec3 wheelCenter = glm::vec3(0.0f, -0.25f, -0.4f);
-        wheelModel = glm::translate(wheelModel, wheelCenter);
-        wheelModel = glm::rotate(wheelModel, glm::radians(wheelRotation), glm::vec3(0.0f, 0.0f, 1.0f));
-        wheelModel = glm::translate(wheelModel, -wheelCenter);
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(wheelModel));
-        glDrawArrays(GL_TRIANGLE_FAN, 11 * 4, 4);
-
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(shakeModel));
-
-        // Crtanje 2D displeja sa teksturom
-        glUniform1i(glGetUniformLocation(shader3D, "useTex"), true);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, displayTexture);
-        glUniform1i(glGetUniformLocation(shader3D, "uTex"), 0);
-        glDrawArrays(GL_TRIANGLE_FAN, 12 * 4, 4);
-        glUniform1i(glGetUniformLocation(shader3D, "useTex"), false);
-
-        // Crtanje ostatka kabine
-        for (int i = 13; i < 20; ++i) {
-            glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
+        if (screenshotRequested) {
+            screenshotRequested = false;
+            saveScreenshot(snap, mode->width, mode->height, softScene);
         }
 
-        // Animacija vrata
-        glm::mat4 doorModel = shakeModel;
-        doorModel = glm::translate(doorModel, glm::vec3(-doorOffset * 0.3f, 0.0f, doorOffset));
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(doorModel));
-        glDrawArrays(GL_TRIANGLE_FAN, 20 * 4, 4);
-
-        glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(shakeModel));
-        
-        // Crtanje sedista
-        for (int i = 21; i < 23; ++i) {
-            glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
+        // ========== STATISTIKA FREJMA ==========
+        // CPU vreme crtanja je do ovde (bez overlay-a i bez cekanja na swap); simulacija meri svoje na svojoj niti
+        auto renderEndTime = std::chrono::high_resolution_clock::now();
+        float renderMs = std::chrono::duration<float, std::milli>(renderEndTime - currentTime).count();
+        frameStats.push(dt * 1000.0f, snap.simCpuMs, renderMs);
+        // Razmera za sledeci frejm; GPU vreme scene kasni frejm-dva (prsten upita)
+        float sceneGpuMs = renderBackend.timerMs(sceneTimer);
+        if (!softwareRendering) {
+            dynamicResolution.update(sceneGpuMs, renderMs);
+            perfOverlay.setResolution(sceneScale, sceneWidth, sceneHeight, sceneGpuMs);
+        }
+        if (showPerfOverlay) {
+            perfOverlay.build(frameStats, glStats, perfReport.budget, (float)mode->width / (float)mode->height, FRAME_TIME * 1000.0f);
+            overlayCommands.reset();
+            overlayCommands.beginPass("overlay");
+            overlayCommands.setTarget(RENDER_SCREEN);
+            overlayCommands.setState(STATE_DEPTH_TEST, false);
+            overlayCommands.setState(STATE_BLEND, true);
+            perfOverlay.record(overlayCommands, shader2D, SHADER2D_VERTEX_COLOR);
+            renderBackend.execute(overlayCommands);
         }
 
-        // Crtanje putnika
-        glBindVertexArray(humanoidVAO);
-        
-        for (const auto& p : activePassengers) {
-            glm::mat4 passengerModel = shakeModel;
-            passengerModel = glm::translate(passengerModel, p.position);
-            
-            if (p.isMoving) {
-                glm::vec3 direction = glm::normalize(p.targetPosition - p.position);
-                float angle = atan2(direction.x, direction.z);
-                passengerModel = glm::rotate(passengerModel, angle, glm::vec3(0.0f, 1.0f, 0.0f));
-            } else {
-                passengerModel = glm::rotate(passengerModel, glm::radians(180.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-            }
-            
-            glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(passengerModel));
-            
-            glUniform1i(glGetUniformLocation(shader3D, "useCustomColor"), 1);
-            
-            glm::vec3 skinColor = glm::vec3(1.0f, 0.85f, 0.7f);
-            
-            glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(skinColor));
-            for (int i = 0; i < 7; ++i) {
-                glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-            }
-            
-            glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(p.shirtColor));
-            for (int i = 7; i < 13; ++i) {
-                glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-            }
-            
-            glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(p.shirtColor));
-            for (int i = 13; i < 17; ++i) {
-                glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-            }
-            
-            glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(p.shirtColor));
-            for (int i = 17; i < 21; ++i) {
-                glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-            }
-            
-            // ========== ANIMACIJA HODANJA ==========
-            glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(p.pantsColor));
-            
-            if (p.isMoving) {
-                float leftLegAngle = sin(p.walkAnimTime) * 25.0f; 
-                glm::vec3 hipPivot = glm::vec3(-0.04f, -0.05f, 0.01f);
-                
-                glm::mat4 leftLegModel = passengerModel; 
-                leftLegModel = glm::translate(leftLegModel, hipPivot);  
-                leftLegModel = glm::rotate(leftLegModel, glm::radians(leftLegAngle), glm::vec3(1.0f, 0.0f, 0.0f));  // Rotiraj oko X-ose
-                leftLegModel = glm::translate(leftLegModel, -hipPivot);  
-                glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(leftLegModel));
-                
-                for (int i = 21; i < 25; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-                
-                
-                float rightLegAngle = -sin(p.walkAnimTime) * 25.0f;
-                glm::vec3 hipPivotRight = glm::vec3(0.04f, -0.05f, 0.01f);  
-                
-                glm::mat4 rightLegModel = passengerModel;  
-                rightLegModel = glm::translate(rightLegModel, hipPivotRight); 
-                rightLegModel = glm::rotate(rightLegModel, glm::radians(rightLegAngle), glm::vec3(1.0f, 0.0f, 0.0f));  // Rotiraj oko X-ose
-                rightLegModel = glm::translate(rightLegModel, -hipPivotRight);  
-                glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(rightLegModel));
-                
-                for (int i = 25; i < 29; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-            } else {
-                glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(passengerModel));
-                for (int i = 21; i < 25; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-                for (int i = 25; i < 29; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-            }
-            
-            if (p.isInspector) {
-                // KAPICA
-                glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(passengerModel));
-                
-                glBindVertexArray(capVAO);
-                
-                glm::vec3 capColor = glm::vec3(0.02f, 0.02f, 0.08f);  // Tamnoplava
-                glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(capColor));
-                
-                for (int i = 0; i < 4; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-                
-                glBindVertexArray(humanoidVAO);
-            } else {
-                // KOSA
-                glUniformMatrix4fv(glGetUniformLocation(shader3D, "uM"), 1, GL_FALSE, glm::value_ptr(passengerModel));
-                
-                glBindVertexArray(hairVAO);
-                
-                // Koristi hair boju putnika (random)
-                glUniform3fv(glGetUniformLocation(shader3D, "uCustomColor"), 1, glm::value_ptr(p.hairColor));
-                
-                for (int i = 0; i < 5; ++i) {
-                    glDrawArrays(GL_TRIANGLE_FAN, i * 4, 4);
-                }
-                
-                glBindVertexArray(humanoidVAO);
+        // ========== SNIMANJE VIDEA ==========
+        // Fajl se otvara pri prvom ukljucivanju; pauza samo preskace frejmove
+        if (videoToggleRequested) {
+            videoToggleRequested = false;
+            if (videoRecorder.isOpen() || videoRecorder.open(videoPath, mode->width, mode->height, (int)TARGET_FPS, &renderBackend.memory())) {
+                videoRecording = !videoRecording;
+                std::cout << "Video: " << (videoRecording ? "snimanje" : "pauza") << std::endl;
             }
         }
-        
-        glUniform1i(glGetUniformLocation(shader3D, "isInspector"), 0);
-        glUniform1i(glGetUniformLocation(shader3D, "useCustomColor"), false);
+        if (videoRecording) videoRecorder.captureFrame(renderBackend.framebuffer(RENDER_SCREEN));
+        else videoRecorder.poll();
 
-        GLboolean depthTestWasEnabled = glIsEnabled(GL_DEPTH_TEST);
-        glDisable(GL_DEPTH_TEST);
-        
-        glUseProgram(shader2D);
-        glBindVertexArray(VAO2D);
-        
-        // Identity matrix za 2D prostor
-        float identityMatrix[16] = {
-            1.0f, 0.0f, 0.0f, 0.0f,
-            0.0f, 1.0f, 0.0f, 0.0f,
-            0.0f, 0.0f, 1.0f, 0.0f,
-            0.0f, 0.0f, 0.0f, 1.0f
-        };
-        glUniformMatrix4fv(glGetUniformLocation(shader2D, "uModel"), 1, GL_FALSE, identityMatrix);
-        
-        glBindTexture(GL_TEXTURE_2D, authorTexture);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        
-        glUniform1f(glGetUniformLocation(shader2D, "uAlpha"), 1.0f);
-        
-        setModelMatrix(shader2D, 0.7f, 0.8f, 0.25f, 0.15f);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-        
-        // VRATI prethodno stanje depth testa
-        if (depthTestWasEnabled) {
-            glEnable(GL_DEPTH_TEST);
-        }
+        perfReport.addFrame(glStats);
+        renderBackend.endFrame();
 
         glfwSwapBuffers(window);
     }
 
+    simThread.stop();
+    videoRecorder.close();
+    if (checkpointWriter.isOpen()) {
+        checkpointWriter.close();
+        std::cout << "Checkpoint: upisano " << checkpointWriter.writtenCount() << ", preskoceno "
+                  << checkpointWriter.skippedCount() << std::endl;
+    }
+
+    renderBackend.memory().print();
+    if (perfReportPath != NULL) {
+        FrameSummary summary;
+        frameStats.summarize(summary);
+        perfReport.write(perfReportPath, summary, renderBackend.memory());
+    }
+
     // ========== CISCENJE ==========
-    glDeleteVertexArrays(1, &VAO2D);
-    glDeleteBuffers(1, &VBO2D);
-    glDeleteBuffers(1, &EBO2D);
-    glDeleteVertexArrays(1, &VAO3D);
-    glDeleteBuffers(1, &VBO3D);
-    glDeleteVertexArrays(1, &humanoidVAO);
-    glDeleteBuffers(1, &humanoidVBO);
-    glDeleteVertexArrays(1, &hairVAO);
-    glDeleteBuffers(1, &hairVBO);
-    glDeleteVertexArrays(1, &capVAO);
-    glDeleteBuffers(1, &capVBO);
-    glDeleteVertexArrays(1, &pathVAO);
-    glDeleteBuffers(1, &pathVBO);
-    glDeleteVertexArrays(1, &circleVAO);
-    glDeleteBuffers(1, &circleVBO);
-    glDeleteVertexArrays(1, &roadVAO);
-    glDeleteBuffers(1, &roadVBO);
-    glDeleteVertexArrays(1, &station3DVAO);
-    glDeleteBuffers(1, &station3DVBO);
-    glDeleteProgram(shader2D);
-    glDeleteProgram(shader3D);
-
-    glDeleteTextures(1, &busTexture);
-    glDeleteTextures(1, &stationTexture);
-    glDeleteTextures(1, &controlTexture);
-    glDeleteTextures(1, &doorClosedTexture);
-    glDeleteTextures(1, &doorOpenTexture);
-    glDeleteTextures(1, &authorTexture);
-    glDeleteTextures(1, &passengersLabelTexture);
-    glDeleteTextures(1, &finesLabelTexture);
-    glDeleteTextures(10, numberTextures);
-
-    glDeleteFramebuffers(1, &displayFBO);
-    glDeleteTextures(1, &displayTexture);
-    glDeleteRenderbuffers(1, &displayRBO);
+    // Svaki vlasnik vraca svoje resurse; sto ostane, backend ispisuje kao curenje
+    uint32_t ownedTextures[] = { busTexture, stationTexture, controlTexture, doorClosedTexture, doorOpenTexture,
+                                 authorTexture, passengersLabelTexture, finesLabelTexture, lightmapTexture, softwareTexture };
+    for (uint32_t texture : ownedTextures) {
+        if (texture != RENDER_NONE) renderBackend.releaseTexture(texture);
+    }
+    for (uint32_t texture : numberTextures) {
+        if (texture != RENDER_NONE) renderBackend.releaseTexture(texture);
+    }
+    // Mreze oslobadjaju i svoje bafere (instance guzve, lightmap UV-ove)
+    for (uint32_t mesh : { quadMesh, pathMesh, circleMesh, cabinMesh, passengerMesh, crowdMesh, roadMesh, stationMesh }) {
+        renderBackend.releaseMesh(mesh);
+    }
+    if (posterMesh != RENDER_NONE) renderBackend.releaseMesh(posterMesh);
+    textureStreamer.destroy();
+    renderBackend.releaseTarget(displayTarget);
+    if (sceneTarget != RENDER_NONE) renderBackend.releaseTarget(sceneTarget);
+    perfOverlay.destroy(renderBackend);
+    clusteredLighting.destroy(renderBackend);
+    if (bonePaletteTexture != RENDER_NONE) renderBackend.releaseTexture(bonePaletteTexture);
+    if (bonePaletteBuffer != RENDER_NONE) renderBackend.releaseBuffer(bonePaletteBuffer);
+    jobs.destroy();
+    renderBackend.destroy();
+    shaders2D.destroy();
+    shaders3D.destroy();
+    shadersBaked.destroy();
+    softwareRenderer.destroy();
+
+    inputRecorder.close();
+    telemetryWriter.close();
 
     glfwDestroyWindow(window);
     glfwTerminate();
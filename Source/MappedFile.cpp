@@ -0,0 +1,101 @@
+#include "../Header/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+    if (this != &other) {
+        close();
+        mapping = other.mapping;
+        mappedBytes = other.mappedBytes;
+#ifdef _WIN32
+        fileHandle = other.fileHandle;
+        mapHandle = other.mapHandle;
+        other.fileHandle = nullptr;
+        other.mapHandle = nullptr;
+#endif
+        other.mapping = nullptr;
+        other.mappedBytes = 0;
+    }
+    return *this;
+}
+
+// Prazan fajl se ne moze mapirati, pa open vraca false
+bool MappedFile::open(const std::string& path, bool sequential) {
+    close();
+
+#ifdef _WIN32
+    HANDLE fh = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                            OPEN_EXISTING, sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(fh, &fileSize);
+    mappedBytes = (size_t)fileSize.QuadPart;
+    if (mappedBytes == 0) {
+        CloseHandle(fh);
+        return false;
+    }
+    HANDLE mh = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mh == NULL) {
+        CloseHandle(fh);
+        mappedBytes = 0;
+        return false;
+    }
+    fileHandle = fh;
+    mapHandle = mh;
+    mapping = MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    mappedBytes = (size_t)st.st_size;
+    void* p = mmap(NULL, mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);    // Mapiranje ostaje vazece i posle zatvaranja deskriptora
+    mapping = (p == MAP_FAILED) ? nullptr : p;
+    if (mapping != nullptr && sequential) {
+        madvise(p, mappedBytes, MADV_SEQUENTIAL);
+    }
+#endif
+
+    if (mapping == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (mapping != nullptr) UnmapViewOfFile(mapping);
+    if (mapHandle != nullptr) CloseHandle((HANDLE)mapHandle);
+    if (fileHandle != nullptr) CloseHandle((HANDLE)fileHandle);
+    mapHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (mapping != nullptr) munmap((void*)mapping, mappedBytes);
+#endif
+    mapping = nullptr;
+    mappedBytes = 0;
+}
@@ -0,0 +1,185 @@
+#include "../Header/NavGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <queue>
+
+static const float DIAGONAL_COST = 1.41421356f;
+
+// ========== MREZA ==========
+void NavGrid::build(const SeatLayout& layout, float cellSize) {
+    this->cellSize = cellSize;
+    invCellSize = 1.0f / cellSize;
+
+    places.clear();
+    for (const SeatPlace& p : layout.places) places.push_back(p.position);
+    doors = layout.doors;
+    if (doors.empty()) {
+        std::cout << "NavGrid: raspored \"" << layout.name << "\" nema ulaz, koristi se prvo mesto" << std::endl;
+        doors.push_back(places.empty() ? glm::vec3(0.0f) : places[0]);
+    }
+    placeCount = (int)places.size();
+
+    // Obuhvat mesta (sa otiskom sedista) i ulaza
+    glm::vec2 minXZ(doors[0].x, doors[0].z), maxXZ = minXZ;
+    float half = NAV_SEAT_FOOTPRINT * 0.5f;
+    for (const glm::vec3& p : places) {
+        minXZ = glm::min(minXZ, glm::vec2(p.x - half, p.z - half));
+        maxXZ = glm::max(maxXZ, glm::vec2(p.x + half, p.z + half));
+    }
+    for (const glm::vec3& d : doors) {
+        minXZ = glm::min(minXZ, glm::vec2(d.x, d.z));
+        maxXZ = glm::max(maxXZ, glm::vec2(d.x, d.z));
+    }
+    origin = minXZ - glm::vec2(NAV_MARGIN);
+    gridW = std::max(1, (int)std::ceil((maxXZ.x - minXZ.x + 2.0f * NAV_MARGIN) * invCellSize));
+    gridH = std::max(1, (int)std::ceil((maxXZ.y - minXZ.y + 2.0f * NAV_MARGIN) * invCellSize));
+
+    // Celija pripada sedistu ako joj je centar unutar otiska
+    owner.assign(gridW * gridH, -1);
+    for (int i = 0; i < placeCount; i++) {
+        if (layout.places[i].type != PlaceType::Seat) continue;
+        const glm::vec3& p = places[i];
+        int x0 = std::max(0, (int)std::ceil((p.x - half - origin.x) * invCellSize - 0.5f));
+        int x1 = std::min(gridW - 1, (int)std::floor((p.x + half - origin.x) * invCellSize - 0.5f));
+        int z0 = std::max(0, (int)std::ceil((p.z - half - origin.y) * invCellSize - 0.5f));
+        int z1 = std::min(gridH - 1, (int)std::floor((p.z + half - origin.y) * invCellSize - 0.5f));
+        for (int z = z0; z <= z1; z++) {
+            for (int x = x0; x <= x1; x++) owner[z * gridW + x] = i;
+        }
+    }
+
+    // Kes putanja za sve parove (ulaz, mesto)
+    paths.assign(doors.size() * placeCount, std::vector<glm::vec3>());
+    lengths.assign(doors.size() * placeCount, 0.0f);
+    int unreachable = 0;
+    for (int d = 0; d < (int)doors.size(); d++) {
+        for (int place = 0; place < placeCount; place++) {
+            std::vector<glm::vec3>& out = paths[d * placeCount + place];
+            if (!findPath(doors[d], place, out)) unreachable++;
+            float length = 0.0f;
+            for (size_t k = 1; k < out.size(); k++) length += glm::length(out[k] - out[k - 1]);
+            lengths[d * placeCount + place] = length;
+        }
+    }
+    if (unreachable > 0) {
+        std::cout << "NavGrid: " << unreachable << " putanja u rasporedu \"" << layout.name
+                  << "\" nije nadjeno, putnici idu pravo" << std::endl;
+    }
+}
+
+int NavGrid::nearestDoor(int place) const {
+    int best = 0;
+    for (int d = 1; d < (int)doors.size(); d++) {
+        if (pathLength(d, place) < pathLength(best, place)) best = d;
+    }
+    return best;
+}
+
+// Sediste je prepreka za sve osim za putnika kome je to cilj
+bool NavGrid::walkable(int x, int z, int place) const {
+    if (x < 0 || z < 0 || x >= gridW || z >= gridH) return false;
+    int o = owner[z * gridW + x];
+    return o < 0 || o == place;
+}
+
+int NavGrid::cellOf(float x, float z) const {
+    int cx = std::min(gridW - 1, std::max(0, (int)std::floor((x - origin.x) * invCellSize)));
+    int cz = std::min(gridH - 1, std::max(0, (int)std::floor((z - origin.y) * invCellSize)));
+    return cz * gridW + cx;
+}
+
+glm::vec3 NavGrid::cellCenter(int cell, float y) const {
+    return glm::vec3(origin.x + ((cell % gridW) + 0.5f) * cellSize, y, origin.y + ((cell / gridW) + 0.5f) * cellSize);
+}
+
+// Uzorci na pola celije duz duzi; dovoljno za prolaze sire od jedne celije
+bool NavGrid::lineOfSight(const glm::vec3& a, const glm::vec3& b, int place) const {
+    glm::vec2 delta(b.x - a.x, b.z - a.z);
+    int steps = std::max(1, (int)std::ceil(glm::length(delta) * invCellSize * 2.0f));
+    for (int i = 0; i <= steps; i++) {
+        float t = (float)i / steps;
+        int cell = cellOf(a.x + delta.x * t, a.z + delta.y * t);
+        if (!walkable(cell % gridW, cell / gridW, place)) return false;
+    }
+    return true;
+}
+
+// ========== A* ==========
+bool NavGrid::findPath(const glm::vec3& from, int place, std::vector<glm::vec3>& out) const {
+    out.clear();
+    const glm::vec3& goal = places[place];
+    int start = cellOf(from.x, from.z);
+    int target = cellOf(goal.x, goal.z);
+
+    // Oktilna heuristika (tacna za 8 suseda bez prepreka)
+    int tx = target % gridW, tz = target / gridW;
+    auto heuristic = [&](int cell) {
+        int dx = std::abs(cell % gridW - tx), dz = std::abs(cell / gridW - tz);
+        return (float)std::max(dx, dz) + (DIAGONAL_COST - 1.0f) * (float)std::min(dx, dz);
+    };
+
+    std::vector<float> cost(gridW * gridH, 1e30f);
+    std::vector<int> cameFrom(gridW * gridH, -1);
+    std::vector<uint8_t> closed(gridW * gridH, 0);
+    typedef std::pair<float, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    cost[start] = 0.0f;
+    open.push(Entry(heuristic(start), start));
+
+    static const int dx[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    static const int dz[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+    bool found = false;
+    while (!open.empty()) {
+        int cell = open.top().second;
+        open.pop();
+        if (closed[cell]) continue;
+        closed[cell] = 1;
+        if (cell == target) {
+            found = true;
+            break;
+        }
+
+        int cx = cell % gridW, cz = cell / gridW;
+        for (int k = 0; k < 8; k++) {
+            int nx = cx + dx[k], nz = cz + dz[k];
+            if (!walkable(nx, nz, place)) continue;
+            // Dijagonala samo ako su oba susedna pravca prohodna (ne sece ugao sedista)
+            if (k >= 4 && (!walkable(cx + dx[k], cz, place) || !walkable(cx, cz + dz[k], place))) continue;
+            int next = nz * gridW + nx;
+            float newCost = cost[cell] + (k >= 4 ? DIAGONAL_COST : 1.0f);
+            if (newCost < cost[next]) {
+                cost[next] = newCost;
+                cameFrom[next] = cell;
+                open.push(Entry(newCost + heuristic(next), next));
+            }
+        }
+    }
+
+    if (!found) {
+        out.push_back(from);
+        out.push_back(goal);
+        return false;
+    }
+
+    // Celije od cilja do starta; krajnje tacke su tacan ulaz i tacno mesto
+    std::vector<glm::vec3> cells;
+    for (int cell = cameFrom[target]; cell >= 0 && cell != start; cell = cameFrom[cell]) {
+        cells.push_back(cellCenter(cell, from.y));
+    }
+    cells.push_back(from);
+    std::reverse(cells.begin(), cells.end());
+    cells.push_back(goal);
+
+    // Ispravljanje: iz tekuce tacke ide se dok god je sledeca celija putanje vidljiva
+    out.push_back(cells[0]);
+    size_t current = 0;
+    while (current + 1 < cells.size()) {
+        size_t next = current + 1;
+        while (next + 1 < cells.size() && lineOfSight(cells[current], cells[next + 1], place)) next++;
+        out.push_back(cells[next]);
+        current = next;
+    }
+    return true;
+}
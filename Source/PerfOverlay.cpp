@@ -0,0 +1,195 @@
+#include "../Header/PerfOverlay.h"
+
+#include <algorithm>
+#include <cstdio>
+
+static const int OVERLAY_VERTEX_FLOATS = 8;
+
+// Font 3x5: redovi odozgo nadole, '1' je upaljen piksel
+struct Glyph {
+    char c;
+    const char* bits;
+};
+
+static const Glyph FONT_3X5[] = {
+    { '0', "111101101101111" }, { '1', "010110010010111" }, { '2', "111001111100111" },
+    { '3', "111001111001111" }, { '4', "101101111001001" }, { '5', "111100111001111" },
+    { '6', "111100111101111" }, { '7', "111001001001001" }, { '8', "111101111101111" },
+    { '9', "111101111001111" }, { 'A', "010101111101101" }, { 'B', "110101110101110" },
+    { 'C', "011100100100011" }, { 'D', "110101101101110" }, { 'E', "111100110100111" },
+    { 'F', "111100110100100" }, { 'G', "011100101101011" }, { 'H', "101101111101101" },
+    { 'I', "111010010010111" }, { 'K', "101101110101101" }, { 'L', "100100100100111" },
+    { 'M', "101111111101101" }, { 'N', "110101101101101" }, { 'O', "010101101101010" },
+    { 'P', "110101110100100" }, { 'R', "110101110101101" }, { 'S', "011100010001110" },
+    { 'T', "111010010010010" }, { 'U', "101101101101111" }, { 'V', "101101101101010" },
+    { 'W', "101101111111101" },
+    { 'X', "101101010101101" }, { 'Y', "101101010010010" },
+    { '.', "000000000000010" }, { ':', "000010000010000" }, { '/', "001001010100100" },
+    { '-', "000000111000000" },
+};
+
+static const char* findGlyph(char c) {
+    if (c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
+    for (const Glyph& g : FONT_3X5) {
+        if (g.c == c) return g.bits;
+    }
+    return nullptr;     // Razmak i nepoznati znakovi
+}
+
+// ========== GL RESURSI ==========
+void PerfOverlay::init(GLRenderBackend& backend) {
+    int stride = OVERLAY_VERTEX_FLOATS * sizeof(float);
+    buffer = backend.createBuffer(NULL, 0, BUFFER_STREAM);
+    mesh = backend.createMesh({
+        { 0, buffer, 2, stride, 0, 0 },
+        { 1, buffer, 2, stride, 2 * sizeof(float), 0 },
+        { 2, buffer, 4, stride, 4 * sizeof(float), 0 }
+    });
+}
+
+void PerfOverlay::destroy(GLRenderBackend& backend) {
+    if (mesh != RENDER_NONE) backend.releaseMesh(mesh);
+    mesh = buffer = RENDER_NONE;
+}
+
+// ========== GEOMETRIJA ==========
+void PerfOverlay::addRect(float x0, float y0, float x1, float y1, float r, float g, float b, float a) {
+    const float corners[6][2] = { { x0, y0 }, { x1, y0 }, { x1, y1 }, { x1, y1 }, { x0, y1 }, { x0, y0 } };
+    for (const auto& c : corners) {
+        vertices.insert(vertices.end(), { c[0], c[1], 0.0f, 0.0f, r, g, b, a });
+    }
+}
+
+float PerfOverlay::addText(const char* text, float x, float y, float r, float g, float b) {
+    // y je gornja ivica reda; izmedju znakova je jedan prazan piksel
+    for (const char* c = text; *c != '\0'; c++) {
+        const char* bits = findGlyph(*c);
+        if (bits != nullptr) {
+            for (int row = 0; row < 5; row++) {
+                for (int col = 0; col < 3; col++) {
+                    if (bits[row * 3 + col] != '1') continue;
+                    float px = x + col * pixelW;
+                    float py = y - row * pixelH;
+                    addRect(px, py - pixelH, px + pixelW, py, r, g, b, 1.0f);
+                }
+            }
+        }
+        x += 4 * pixelW;
+    }
+    return x;
+}
+
+void PerfOverlay::build(const FrameStats& stats, const GLStats& gl, const GLBudget& budget, float aspect, float targetFrameMs) {
+    vertices.clear();
+
+    pixelW = 0.004f;
+    pixelH = pixelW * aspect;
+
+    FrameSummary s;
+    stats.summarize(s);
+
+    const float left = -0.98f, top = 0.97f;
+    const float graphW = 0.48f, graphH = 0.18f;
+    const float lineH = 7 * pixelH;
+    // 9 redova teksta (+ razmera scene) + jedan po prolazu
+    int lines = 10 + gl.passCount + (resolutionScale > 0.0f ? 1 : 0);
+    const float panelBottom = top - graphH - lines * lineH - 0.04f;
+    addRect(left, panelBottom, left + graphW + 0.04f, top, 0.0f, 0.0f, 0.0f, 0.6f);
+
+    // ===== Grafik: jedan stubic po frejmu, skala do 3x ciljnog trajanja =====
+    float gx = left + 0.02f, gy = top - 0.02f - graphH;
+    float scaleMs = targetFrameMs * 3.0f;
+    addRect(gx, gy, gx + graphW, gy + graphH, 0.1f, 0.1f, 0.1f, 0.8f);
+    if (s.count > 0) {
+        float barW = graphW / FRAME_STATS_WINDOW;
+        for (int i = 0; i < stats.size(); i++) {
+            float ms = stats.frameAt(i);
+            float h = std::min(ms / scaleMs, 1.0f) * graphH;
+            float x = gx + (FRAME_STATS_WINDOW - stats.size() + i) * barW;
+            if (ms <= targetFrameMs * 1.2f) addRect(x, gy, x + barW, gy + h, 0.2f, 0.8f, 0.2f, 1.0f);
+            else if (ms <= targetFrameMs * 2.0f) addRect(x, gy, x + barW, gy + h, 0.9f, 0.8f, 0.1f, 1.0f);
+            else addRect(x, gy, x + barW, gy + h, 0.9f, 0.15f, 0.1f, 1.0f);
+        }
+    }
+    float targetY = gy + targetFrameMs / scaleMs * graphH;
+    addRect(gx, targetY, gx + graphW, targetY + pixelH * 0.5f, 1.0f, 1.0f, 1.0f, 0.7f);
+
+    // ===== Tekst =====
+    char line[64];
+    float ty = gy - 0.015f;
+    snprintf(line, sizeof(line), "FRAME %d  P50 %.1f  P95 %.1f", s.count, s.p50, s.p95);
+    addText(line, gx, ty, 1.0f, 1.0f, 1.0f);
+    ty -= lineH;
+    bool hitch = s.max > targetFrameMs * 2.0f;     // Zastoj u prozoru - crveno
+    snprintf(line, sizeof(line), "P99 %.1f  MAX %.1f MS", s.p99, s.max);
+    addText(line, gx, ty, 1.0f, hitch ? 0.4f : 1.0f, hitch ? 0.3f : 1.0f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "SIM %.2f AVG  %.2f MAX", s.simAvg, s.simMax);
+    addText(line, gx, ty, 0.6f, 0.85f, 1.0f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "RENDER %.2f AVG  %.2f MAX", s.renderAvg, s.renderMax);
+    addText(line, gx, ty, 1.0f, 0.8f, 0.5f);
+    ty -= lineH;
+    if (resolutionScale > 0.0f) {
+        int n = snprintf(line, sizeof(line), "RES %.2f %dX%d", resolutionScale, resolutionWidth, resolutionHeight);
+        if (sceneGpuMs >= 0.0f) snprintf(line + n, sizeof(line) - n, " GPU %.1fMS", sceneGpuMs);
+        // Umanjena scena - zuto
+        bool scaled = resolutionScale < 1.0f;
+        addText(line, gx, ty, 1.0f, 1.0f, scaled ? 0.3f : 1.0f);
+        ty -= lineH;
+    }
+
+    // ===== GL pozivi: preko budzeta - crveno =====
+    GLCounters c = gl.total();
+    bool drawsOver = budget.drawsOver(c), uploadOver = budget.uploadOver(c);
+    snprintf(line, sizeof(line), "DRAWS %llu / %llu", (unsigned long long)c.drawCalls, (unsigned long long)budget.drawCalls);
+    addText(line, gx, ty, 1.0f, drawsOver ? 0.4f : 1.0f, drawsOver ? 0.3f : 1.0f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "TRIS %llu", (unsigned long long)c.triangles);
+    addText(line, gx, ty, 1.0f, 1.0f, 1.0f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "STATE %llu  PROG %llu  UNIF %llu", (unsigned long long)c.stateChanges,
+             (unsigned long long)c.programBinds, (unsigned long long)c.uniformUploads);
+    addText(line, gx, ty, 0.8f, 0.8f, 0.8f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "TEX %llu  VAO %llu", (unsigned long long)c.textureBinds, (unsigned long long)c.vertexArrayBinds);
+    addText(line, gx, ty, 0.8f, 0.8f, 0.8f);
+    ty -= lineH;
+    snprintf(line, sizeof(line), "UPLOAD %.1f / %.0f KB", c.uploadBytes() / 1024.0, budget.uploadBytes / 1024.0);
+    addText(line, gx, ty, 1.0f, uploadOver ? 0.4f : 1.0f, uploadOver ? 0.3f : 1.0f);
+
+    for (int i = 0; i < gl.passCount; i++) {
+        const GLPassStats& pass = gl.passes[i];
+        ty -= lineH;
+        snprintf(line, sizeof(line), "- %s %llu DR  %.1f KB", pass.name[0] != '\0' ? pass.name : "OSTALO",
+                 (unsigned long long)pass.counters.drawCalls, pass.counters.uploadBytes() / 1024.0);
+        addText(line, gx, ty, 0.6f, 0.85f, 1.0f);
+    }
+}
+
+void PerfOverlay::setResolution(float scale, int width, int height, float gpuMs) {
+    resolutionScale = scale;
+    resolutionWidth = width;
+    resolutionHeight = height;
+    sceneGpuMs = gpuMs;
+}
+
+// ========== CRTANJE ==========
+void PerfOverlay::record(RenderCommandList& list, uint32_t shader2D, uint32_t vertexColorKey) {
+    if (vertices.empty()) return;
+
+    list.updateBuffer(buffer, vertices.data(), vertices.size() * sizeof(float));
+
+    float identityMatrix[16] = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    list.usePipeline(shader2D, vertexColorKey);
+    list.setMat4(shader2D, "uModel", identityMatrix);
+    list.setFloat(shader2D, "uAlpha", 1.0f);
+
+    list.bindMesh(mesh);
+    list.draw(PRIMITIVE_TRIANGLES, 0, (int)(vertices.size() / OVERLAY_VERTEX_FLOATS));
+}
@@ -0,0 +1,142 @@
+#include "../Header/PerfReport.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+void PerfReport::Totals::add(const GLCounters& c) {
+    for (int i = 0; i < GL_COUNTER_COUNT; i++) {
+        uint64_t value = c.*GL_COUNTERS[i].field;
+        sum[i] += value;
+        max[i] = std::max(max[i], value);
+    }
+}
+
+// ========== BUDZET ==========
+void PerfReport::warn(const GLStats& gl, const char* text, bool upload) {
+    const GLPassStats* worst = nullptr;
+    uint64_t worstValue = 0;
+    for (int i = 0; i < gl.passCount; i++) {
+        const GLCounters& c = gl.passes[i].counters;
+        uint64_t value = upload ? c.uploadBytes() : c.drawCalls;
+        if (worst == nullptr || value > worstValue) {
+            worst = &gl.passes[i];
+            worstValue = value;
+        }
+    }
+    std::cout << "UPOZORENJE: frejm " << frames << " - " << text;
+    if (worst != nullptr) {
+        std::cout << ", najvise u prolazu \"" << (worst->name[0] != '\0' ? worst->name : "van prolaza") << "\" (";
+        if (upload) std::cout << worstValue / 1024 << " KB)";
+        else std::cout << worstValue << ")";
+    }
+    std::cout << std::endl;
+}
+
+void PerfReport::addFrame(const GLStats& gl) {
+    GLCounters total = gl.total();
+    frame.add(total);
+
+    for (int i = 0; i < gl.passCount; i++) {
+        const GLPassStats& pass = gl.passes[i];
+        auto it = std::find_if(passes.begin(), passes.end(), [&](const PassTotals& p) { return p.name == pass.name; });
+        if (it == passes.end()) {
+            passes.emplace_back();
+            passes.back().name = pass.name;
+            it = passes.end() - 1;
+        }
+        it->frames++;
+        it->totals.add(pass.counters);
+    }
+
+    char text[128];
+    if (budget.drawsOver(total)) {
+        drawsOverFrames++;
+        if (!drawsOver && (int64_t)frames - lastDrawsWarning >= WARN_INTERVAL) {
+            snprintf(text, sizeof(text), "%llu poziva crtanja (budzet %llu)",
+                     (unsigned long long)total.drawCalls, (unsigned long long)budget.drawCalls);
+            warn(gl, text, false);
+            lastDrawsWarning = (int64_t)frames;
+        }
+        drawsOver = true;
+    } else {
+        drawsOver = false;
+    }
+    if (budget.uploadOver(total)) {
+        uploadOverFrames++;
+        if (!uploadOver && (int64_t)frames - lastUploadWarning >= WARN_INTERVAL) {
+            snprintf(text, sizeof(text), "%llu KB uploada (budzet %llu KB)",
+                     (unsigned long long)(total.uploadBytes() / 1024), (unsigned long long)(budget.uploadBytes / 1024));
+            warn(gl, text, true);
+            lastUploadWarning = (int64_t)frames;
+        }
+        uploadOver = true;
+    } else {
+        uploadOver = false;
+    }
+    frames++;
+}
+
+// ========== JSON ==========
+static const char* const GPU_MEMORY_JSON_NAMES[GPU_MEMORY_CATEGORIES] = { "textures", "buffers", "targets" };
+
+// Za svaki brojac {"avg": prosek po frejmu, "max": najveca vrednost u jednom frejmu}
+static void writeCounters(std::ostream& os, const uint64_t* sum, const uint64_t* max, uint64_t frames, const char* indent) {
+    char line[160];
+    for (int i = 0; i < GL_COUNTER_COUNT; i++) {
+        snprintf(line, sizeof(line), "%s\"%s\": {\"avg\": %.2f, \"max\": %llu}%s\n", indent, GL_COUNTERS[i].name,
+                 frames > 0 ? (double)sum[i] / frames : 0.0, (unsigned long long)max[i], (i + 1 < GL_COUNTER_COUNT) ? "," : "");
+        os << line;
+    }
+}
+
+bool PerfReport::write(const char* path, const FrameSummary& s, const GpuMemory& memory) const {
+    std::ofstream os(path);
+    if (!os.is_open()) {
+        std::cout << "Izvestaj performansi: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    char line[512];
+    snprintf(line, sizeof(line),
+             "{\n  \"frames\": %llu,\n"
+             "  \"frame_ms\": {\"window\": %d, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f, "
+             "\"sim_avg\": %.3f, \"sim_max\": %.3f, \"render_avg\": %.3f, \"render_max\": %.3f},\n"
+             "  \"budget\": {\"draw_calls\": %llu, \"upload_bytes\": %llu},\n"
+             "  \"over_budget_frames\": {\"draw_calls\": %llu, \"upload_bytes\": %llu},\n",
+             (unsigned long long)frames, s.count, s.p50, s.p95, s.p99, s.max, s.simAvg, s.simMax, s.renderAvg, s.renderMax,
+             (unsigned long long)budget.drawCalls, (unsigned long long)budget.uploadBytes,
+             (unsigned long long)drawsOverFrames, (unsigned long long)uploadOverFrames);
+    os << line;
+
+    os << "  \"gl\": {\n";
+    writeCounters(os, frame.sum, frame.max, frames, "    ");
+    os << "  },\n  \"passes\": [\n";
+    for (size_t i = 0; i < passes.size(); i++) {
+        const PassTotals& p = passes[i];
+        snprintf(line, sizeof(line), "    {\"name\": \"%s\", \"frames\": %llu,\n", p.name.c_str(), (unsigned long long)p.frames);
+        os << line;
+        writeCounters(os, p.totals.sum, p.totals.max, p.frames, "     ");
+        os << "    }" << (i + 1 < passes.size() ? "," : "") << "\n";
+    }
+    os << "  ],\n  \"gpu_memory\": {\n";
+    for (int i = 0; i < GPU_MEMORY_CATEGORIES; i++) {
+        snprintf(line, sizeof(line), "    \"%s\": {\"objects\": %d, \"bytes\": %llu, \"high_water\": %llu},\n",
+                 GPU_MEMORY_JSON_NAMES[i], memory.objects[i], (unsigned long long)memory.current[i],
+                 (unsigned long long)memory.highWater[i]);
+        os << line;
+    }
+    snprintf(line, sizeof(line), "    \"total\": {\"bytes\": %llu, \"high_water\": %llu, \"budget\": %llu, "
+             "\"evictions\": %d, \"reloads\": %d}\n  }\n}\n",
+             (unsigned long long)memory.total(), (unsigned long long)memory.totalHighWater,
+             (unsigned long long)memory.budget, memory.evictions, memory.reloads);
+    os << line;
+
+    if (!os) {
+        std::cout << "Izvestaj performansi: greska pri upisu u \"" << path << "\"!" << std::endl;
+        return false;
+    }
+    std::cout << "Izvestaj performansi: " << frames << " frejmova -> " << path << std::endl;
+    return true;
+}
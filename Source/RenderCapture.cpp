@@ -0,0 +1,235 @@
+#include "../Header/GLRenderBackend.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+// ========== SNIMAK FREJMA ==========
+// Zaglavlje, sejderi (putanje + #define-ovi), lista sa trenutnim vrednostima uniformi
+// (postavljene pri inicijalizaciji se ne ponavljaju u frejmu), bafere, mreze, teksture,
+// ciljevi i na kraju lista komandi frejma. Sadrzaj bafera i tekstura se cita sa GPU-a,
+// pa snimak ne zavisi od toga odakle su podaci dosli (fajlovi, bejkovanje, simulacija).
+
+static const char CAPTURE_MAGIC[4] = { 'K', 'R', 'C', 'P' };
+static const uint32_t CAPTURE_VERSION = 1;
+
+struct CaptureHeader {
+    char magic[4];
+    uint32_t version;
+    int32_t screenWidth, screenHeight;
+    uint32_t shaderCount, bufferCount, meshCount, textureCount, targetCount;
+};
+
+template <typename T>
+static void writeValue(std::ostream& out, const T& value) {
+    out.write((const char*)&value, sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::istream& in, T& value) {
+    in.read((char*)&value, sizeof(T));
+    return (bool)in;
+}
+
+static void writeString(std::ostream& out, const std::string& s) {
+    writeValue(out, (uint32_t)s.size());
+    out.write(s.data(), s.size());
+}
+
+static bool readString(std::istream& in, std::string& s) {
+    uint32_t length = 0;
+    if (!readValue(in, length)) return false;
+    s.assign(length, '\0');
+    in.read(&s[0], length);
+    return (bool)in;
+}
+
+// Teksture sa float formatom (lightmap) se citaju kao float, ostale kao RGBA8
+static bool isFloatFormat(GLenum internalFormat) {
+    switch (internalFormat) {
+    case GL_R16F: case GL_RG16F: case GL_RGB16F: case GL_RGBA16F:
+    case GL_R32F: case GL_RG32F: case GL_RGB32F: case GL_RGBA32F:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool GLRenderBackend::saveCapture(const std::string& path, const RenderCommandList& list) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Snimak frejma: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    CaptureHeader header;
+    memcpy(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    header.version = CAPTURE_VERSION;
+    header.screenWidth = targets[RENDER_SCREEN].width;
+    header.screenHeight = targets[RENDER_SCREEN].height;
+    header.shaderCount = (uint32_t)shaders.size();
+    header.bufferCount = (uint32_t)buffers.size();
+    header.meshCount = (uint32_t)meshes.size();
+    header.textureCount = (uint32_t)textures.size();
+    header.targetCount = (uint32_t)targets.size() - 1;
+    writeValue(file, header);
+
+    RenderCommandList uniforms;
+    for (size_t i = 0; i < shaders.size(); i++) {
+        const ShaderCache* cache = shaders[i].cache;
+        writeString(file, cache->vertexPath());
+        writeString(file, cache->fragmentPath());
+        writeValue(file, (uint32_t)cache->defines().size());
+        for (const std::string& name : cache->defines()) writeString(file, name);
+        cache->recordUniforms(uniforms, (uint32_t)i);
+    }
+    uniforms.write(file);
+
+    std::vector<uint8_t> data;
+    for (const Buffer& b : buffers) {
+        // Oslobodjen bafer ostaje u tabeli (indeksi se ne pomeraju), ali bez sadrzaja
+        size_t bytes = b.released ? 0 : b.bytes;
+        data.resize(bytes);
+        glBindBuffer(GL_COPY_READ_BUFFER, b.id);
+        if (bytes > 0) glGetBufferSubData(GL_COPY_READ_BUFFER, 0, bytes, data.data());
+        writeValue(file, (uint8_t)b.usage);
+        writeValue(file, (uint64_t)bytes);
+        file.write((const char*)data.data(), bytes);
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+
+    for (const Mesh& m : meshes) {
+        writeValue(file, m.indexBuffer);
+        writeValue(file, (uint32_t)m.attributes.size());
+        file.write((const char*)m.attributes.data(), m.attributes.size() * sizeof(MeshAttribute));
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    for (uint32_t i = 0; i < textures.size(); i++) {
+        makeResident(i);
+        const Texture& t = textures[i];
+        writeValue(file, (uint32_t)t.target);
+        writeValue(file, (uint32_t)t.internalFormat);
+        writeValue(file, (int32_t)t.width);
+        writeValue(file, (int32_t)t.height);
+        writeValue(file, t.buffer);
+        writeValue(file, (uint32_t)t.filter);
+        if (t.target != GL_TEXTURE_2D) continue;
+
+        bool floats = isFloatFormat(t.internalFormat);
+        data.resize((size_t)t.width * t.height * (floats ? 4 * sizeof(float) : 4));
+        if (t.released) {
+            std::fill(data.begin(), data.end(), 0);
+        } else {
+            glBindTexture(GL_TEXTURE_2D, t.id);
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, floats ? GL_FLOAT : GL_UNSIGNED_BYTE, data.data());
+        }
+        file.write((const char*)data.data(), data.size());
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+    for (size_t i = 1; i < targets.size(); i++) writeValue(file, targets[i].colorTexture);
+
+    list.write(file);
+    if (!file) {
+        std::cout << "Snimak frejma: greska pri upisu u \"" << path << "\"!" << std::endl;
+        return false;
+    }
+    std::cout << "Snimak frejma: " << list.commands().size() << " komandi, " << buffers.size() << " bafera, "
+              << textures.size() << " tekstura -> " << path << std::endl;
+    return true;
+}
+
+bool GLRenderBackend::loadCapture(const std::string& path, RenderCommandList& list) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Snimak frejma: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    CaptureHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file || memcmp(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0 || header.version != CAPTURE_VERSION) {
+        std::cout << "Snimak frejma: \"" << path << "\" nije ispravan snimak!" << std::endl;
+        return false;
+    }
+    targets[RENDER_SCREEN].width = header.screenWidth;
+    targets[RENDER_SCREEN].height = header.screenHeight;
+    fromCapture = true;
+
+    for (uint32_t i = 0; i < header.shaderCount; i++) {
+        std::string vs, fs;
+        uint32_t defineCount = 0;
+        readString(file, vs);
+        readString(file, fs);
+        readValue(file, defineCount);
+        std::vector<std::string> defineNames(defineCount);
+        for (std::string& name : defineNames) readString(file, name);
+
+        ownedShaders.emplace_back();
+        ownedShaders.back().init(vs.c_str(), fs.c_str(), defineNames, nullptr);
+        shaders.push_back({ &ownedShaders.back(), true });
+    }
+    RenderCommandList uniforms;
+    if (!uniforms.read(file)) {
+        std::cout << "Snimak frejma: \"" << path << "\" je skracen!" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    for (uint32_t i = 0; i < header.bufferCount; i++) {
+        uint8_t usage = 0;
+        uint64_t bytes = 0;
+        readValue(file, usage);
+        readValue(file, bytes);
+        data.resize((size_t)bytes);
+        file.read((char*)data.data(), (std::streamsize)bytes);
+        createBuffer(data.data(), (size_t)bytes, (RenderBufferUsage)usage);
+    }
+
+    for (uint32_t i = 0; i < header.meshCount; i++) {
+        uint32_t indexBuffer = RENDER_NONE, attributeCount = 0;
+        readValue(file, indexBuffer);
+        readValue(file, attributeCount);
+        std::vector<MeshAttribute> attributes(attributeCount);
+        file.read((char*)attributes.data(), attributeCount * sizeof(MeshAttribute));
+        createMesh(attributes, indexBuffer);
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (uint32_t i = 0; i < header.textureCount; i++) {
+        uint32_t target = 0, internalFormat = 0, buffer = 0, filter = 0;
+        int32_t width = 0, height = 0;
+        readValue(file, target);
+        readValue(file, internalFormat);
+        readValue(file, width);
+        readValue(file, height);
+        readValue(file, buffer);
+        readValue(file, filter);
+        if (target != GL_TEXTURE_2D) {
+            createBufferTexture(buffer, internalFormat);
+            continue;
+        }
+
+        bool floats = isFloatFormat(internalFormat);
+        data.resize((size_t)width * height * (floats ? 4 * sizeof(float) : 4));
+        file.read((char*)data.data(), data.size());
+        createTexture(width, height, internalFormat, GL_RGBA, floats ? GL_FLOAT : GL_UNSIGNED_BYTE, data.data(), filter);
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    for (uint32_t i = 0; i < header.targetCount; i++) {
+        uint32_t colorTexture = 0;
+        readValue(file, colorTexture);
+        createTargetFor(colorTexture);
+    }
+
+    if (!file || !list.read(file)) {
+        std::cout << "Snimak frejma: \"" << path << "\" je skracen!" << std::endl;
+        return false;
+    }
+    execute(uniforms);
+    return true;
+}
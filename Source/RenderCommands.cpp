@@ -0,0 +1,228 @@
+#include "../Header/RenderCommands.h"
+
+#include <istream>
+#include <ostream>
+
+#include <glm/gtc/type_ptr.hpp>
+
+int constantComponents(RenderConstantType type) {
+    switch (type) {
+    case CONSTANT_IVEC3:
+    case CONSTANT_VEC3: return 3;
+    case CONSTANT_VEC2: return 2;
+    case CONSTANT_MAT4: return 16;
+    default: return 1;
+    }
+}
+
+// ========== ZAPISIVANJE ==========
+void RenderCommandList::reset() {
+    commandList.clear();
+    valueList.clear();
+    blobList.clear();
+    ownedBlobs.clear();
+}
+
+void RenderCommandList::push(RenderCommandType type, uint8_t sub, uint16_t slot, uint32_t a, uint32_t b, uint32_t c, uint32_t data) {
+    RenderCommand cmd;
+    cmd.type = type;
+    cmd.sub = sub;
+    cmd.slot = slot;
+    cmd.a = a;
+    cmd.b = b;
+    cmd.c = c;
+    cmd.data = data;
+    commandList.push_back(cmd);
+}
+
+uint32_t RenderCommandList::nameIndex(const char* name) {
+    auto it = nameLookup.find(name);
+    if (it != nameLookup.end()) return it->second;
+    uint32_t index = (uint32_t)nameList.size();
+    nameList.push_back(name);
+    nameLookup[name] = index;
+    return index;
+}
+
+void RenderCommandList::beginPass(const char* name) {
+    push(RENDER_BEGIN_PASS, 0, 0, nameIndex(name), 0, 0, 0);
+}
+
+void RenderCommandList::setTarget(uint32_t target) {
+    push(RENDER_SET_TARGET, 0, 0, target, 0, 0, 0);
+}
+
+void RenderCommandList::clear(const glm::vec4& color) {
+    uint32_t offset = (uint32_t)valueList.size();
+    valueList.insert(valueList.end(), { color.r, color.g, color.b, color.a });
+    push(RENDER_CLEAR, 0, 0, 0, 0, 0, offset);
+}
+
+void RenderCommandList::setState(RenderState state, bool enabled) {
+    push(RENDER_SET_STATE, state, 0, enabled ? 1 : 0, 0, 0, 0);
+}
+
+void RenderCommandList::setStencil(RenderStencilMode mode, int ref) {
+    push(RENDER_SET_STENCIL, mode, 0, (uint32_t)ref, 0, 0, 0);
+}
+
+void RenderCommandList::setLineWidth(float width) {
+    uint32_t offset = (uint32_t)valueList.size();
+    valueList.push_back(width);
+    push(RENDER_SET_LINE_WIDTH, 0, 0, 0, 0, 0, offset);
+}
+
+void RenderCommandList::setViewport(int width, int height) {
+    push(RENDER_SET_VIEWPORT, 0, 0, (uint32_t)width, (uint32_t)height, 0, 0);
+}
+
+void RenderCommandList::blit(uint32_t source, int width, int height, uint32_t destination) {
+    uint32_t offset = (uint32_t)valueList.size();
+    valueList.insert(valueList.end(), { (float)width, (float)height });
+    push(RENDER_BLIT, 0, 0, source, destination, 0, offset);
+}
+
+void RenderCommandList::beginTimer(uint32_t timer) {
+    push(RENDER_BEGIN_TIMER, 0, 0, timer, 0, 0, 0);
+}
+
+void RenderCommandList::endTimer(uint32_t timer) {
+    push(RENDER_END_TIMER, 0, 0, timer, 0, 0, 0);
+}
+
+void RenderCommandList::usePipeline(uint32_t shader, uint32_t variant) {
+    push(RENDER_USE_PIPELINE, 0, (uint16_t)shader, variant, 0, 0, 0);
+}
+
+void RenderCommandList::setConstant(uint32_t shader, const char* name, RenderConstantType type, const float* values) {
+    uint32_t offset = (uint32_t)valueList.size();
+    valueList.insert(valueList.end(), values, values + constantComponents(type));
+    push(RENDER_SET_CONSTANT, type, (uint16_t)shader, nameIndex(name), 0, 0, offset);
+}
+
+void RenderCommandList::setInt(uint32_t shader, const char* name, int value) {
+    float v = (float)value;
+    setConstant(shader, name, CONSTANT_INT, &v);
+}
+
+void RenderCommandList::setFloat(uint32_t shader, const char* name, float value) {
+    setConstant(shader, name, CONSTANT_FLOAT, &value);
+}
+
+void RenderCommandList::setIVec3(uint32_t shader, const char* name, int x, int y, int z) {
+    float v[3] = { (float)x, (float)y, (float)z };
+    setConstant(shader, name, CONSTANT_IVEC3, v);
+}
+
+void RenderCommandList::setVec2(uint32_t shader, const char* name, float x, float y) {
+    float v[2] = { x, y };
+    setConstant(shader, name, CONSTANT_VEC2, v);
+}
+
+void RenderCommandList::setVec3(uint32_t shader, const char* name, const glm::vec3& value) {
+    setConstant(shader, name, CONSTANT_VEC3, glm::value_ptr(value));
+}
+
+void RenderCommandList::setMat4(uint32_t shader, const char* name, const float* value) {
+    setConstant(shader, name, CONSTANT_MAT4, value);
+}
+
+void RenderCommandList::setMat4(uint32_t shader, const char* name, const glm::mat4& value) {
+    setConstant(shader, name, CONSTANT_MAT4, glm::value_ptr(value));
+}
+
+void RenderCommandList::bindMesh(uint32_t mesh) {
+    push(RENDER_BIND_MESH, 0, 0, mesh, 0, 0, 0);
+}
+
+void RenderCommandList::bindTexture(uint32_t unit, uint32_t texture) {
+    push(RENDER_BIND_TEXTURE, 0, (uint16_t)unit, texture, 0, 0, 0);
+}
+
+void RenderCommandList::updateBuffer(uint32_t buffer, const void* data, size_t bytes) {
+    if (bytes == 0) return;
+    blobList.push_back({ data, bytes });
+    push(RENDER_UPDATE_BUFFER, 0, 0, buffer, (uint32_t)blobList.size() - 1, 0, 0);
+}
+
+void RenderCommandList::updateTexture(uint32_t texture, const void* pixels, size_t bytes, int rowLength) {
+    blobList.push_back({ pixels, bytes });
+    push(RENDER_UPDATE_TEXTURE, 0, 0, texture, (uint32_t)blobList.size() - 1, (uint32_t)rowLength, 0);
+}
+
+void RenderCommandList::draw(RenderPrimitive primitive, int first, int count) {
+    push(RENDER_DRAW, primitive, 0, (uint32_t)first, (uint32_t)count, 0, 0);
+}
+
+void RenderCommandList::drawIndexed(RenderPrimitive primitive, int count, int first, int baseVertex) {
+    push(RENDER_DRAW_INDEXED, primitive, 0, (uint32_t)first, (uint32_t)count, (uint32_t)baseVertex, 0);
+}
+
+void RenderCommandList::drawInstanced(RenderPrimitive primitive, int first, int count, int instances) {
+    push(RENDER_DRAW_INSTANCED, primitive, 0, (uint32_t)first, (uint32_t)count, (uint32_t)instances, 0);
+}
+
+// ========== BINARNI OBLIK ==========
+// Broj komandi, komande, broj vrednosti, vrednosti, imena (duzina + znakovi), blob-ovi
+// (duzina + bajtovi). Citalac je ista verzija programa, pa nema konverzije redosleda bajtova.
+template <typename T>
+static void writeValue(std::ostream& out, const T& value) {
+    out.write((const char*)&value, sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::istream& in, T& value) {
+    in.read((char*)&value, sizeof(T));
+    return (bool)in;
+}
+
+void RenderCommandList::write(std::ostream& out) const {
+    writeValue(out, (uint32_t)commandList.size());
+    out.write((const char*)commandList.data(), commandList.size() * sizeof(RenderCommand));
+    writeValue(out, (uint32_t)valueList.size());
+    out.write((const char*)valueList.data(), valueList.size() * sizeof(float));
+    writeValue(out, (uint32_t)nameList.size());
+    for (const std::string& name : nameList) {
+        writeValue(out, (uint32_t)name.size());
+        out.write(name.data(), name.size());
+    }
+    writeValue(out, (uint32_t)blobList.size());
+    for (const RenderBlob& blob : blobList) {
+        writeValue(out, (uint64_t)blob.bytes);
+        out.write((const char*)blob.data, blob.bytes);
+    }
+}
+
+bool RenderCommandList::read(std::istream& in) {
+    reset();
+    nameList.clear();
+    nameLookup.clear();
+
+    uint32_t count = 0;
+    if (!readValue(in, count)) return false;
+    commandList.resize(count);
+    in.read((char*)commandList.data(), count * sizeof(RenderCommand));
+    if (!readValue(in, count)) return false;
+    valueList.resize(count);
+    in.read((char*)valueList.data(), count * sizeof(float));
+
+    if (!readValue(in, count)) return false;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t length = 0;
+        if (!readValue(in, length)) return false;
+        std::string name(length, '\0');
+        in.read(&name[0], length);
+        nameIndex(name.c_str());
+    }
+
+    if (!readValue(in, count)) return false;
+    ownedBlobs.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t bytes = 0;
+        if (!readValue(in, bytes)) return false;
+        ownedBlobs[i].resize((size_t)bytes);
+        in.read((char*)ownedBlobs[i].data(), (std::streamsize)bytes);
+        blobList.push_back({ ownedBlobs[i].data(), (size_t)bytes });
+    }
+    return (bool)in;
+}
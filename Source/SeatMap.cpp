@@ -0,0 +1,174 @@
+#include "../Header/SeatMap.h"
+
+#include <cmath>
+#include <iostream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Indeks najnizeg postavljenog bita (v != 0)
+static int findFirstSet(uint64_t v) {
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long idx;
+    _BitScanForward64(&idx, v);
+    return (int)idx;
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    if (_BitScanForward(&idx, (unsigned long)(v & 0xFFFFFFFFu))) return (int)idx;
+    _BitScanForward(&idx, (unsigned long)(v >> 32));
+    return (int)idx + 32;
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+// ========== RASPOREDI ==========
+void addSeatRows(SeatLayout& layout, glm::vec3 origin, int rows, int cols, glm::vec2 spacing) {
+    for (int row = 0; row < rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            SeatPlace p;
+            p.position = glm::vec3(origin.x + col * spacing.x, origin.y, origin.z + row * spacing.y);
+            p.type = PlaceType::Seat;
+            layout.places.push_back(p);
+        }
+    }
+}
+
+void addStandingZone(SeatLayout& layout, float y, glm::vec2 minXZ, glm::vec2 maxXZ, float spacing) {
+    int nx = (int)std::floor((maxXZ.x - minXZ.x) / spacing + 0.5f) + 1;
+    int nz = (int)std::floor((maxXZ.y - minXZ.y) / spacing + 0.5f) + 1;
+    for (int iz = 0; iz < nz; iz++) {
+        for (int ix = 0; ix < nx; ix++) {
+            SeatPlace p;
+            p.position = glm::vec3(minXZ.x + ix * spacing, y, minXZ.y + iz * spacing);
+            p.type = PlaceType::Standing;
+            layout.places.push_back(p);
+        }
+    }
+}
+
+SeatLayout makeSoloBusLayout() {
+    SeatLayout layout;
+    layout.name = "solo";
+    // 8 redova po 4 sedista desno i pozadi vozaca
+    addSeatRows(layout, glm::vec3(0.5f, -0.3f, 0.8f), 8, 4, glm::vec2(0.25f, 0.4f));
+    // Zona za stajanje na zadnjoj platformi (4 x 5)
+    addStandingZone(layout, -0.3f, glm::vec2(0.5f, 4.0f), glm::vec2(1.25f, 5.0f), 0.25f);
+    // Prednja vrata, pored vozaca
+    layout.doors.push_back(glm::vec3(1.05f, -0.3f, -0.075f));
+    return layout;
+}
+
+SeatLayout makeArticulatedBusLayout() {
+    SeatLayout layout;
+    layout.name = "articulated";
+    // Prednji i zadnji deo zajedno: 16 redova po 4 sedista
+    addSeatRows(layout, glm::vec3(0.5f, -0.3f, 0.8f), 16, 4, glm::vec2(0.25f, 0.4f));
+    // Zona za stajanje kod zgloba i na zadnjoj platformi (4 x 13)
+    addStandingZone(layout, -0.3f, glm::vec2(0.5f, 7.2f), glm::vec2(1.25f, 10.2f), 0.25f);
+    // Prednja vrata i vrata ispred zgloba
+    layout.doors.push_back(glm::vec3(1.05f, -0.3f, -0.075f));
+    layout.doors.push_back(glm::vec3(1.05f, -0.3f, 7.0f));
+    return layout;
+}
+
+// ========== BITMAPA SLOBODNIH MESTA ==========
+int SeatMap::FreeBits::take() {
+    if (summary == 0) return -1;
+
+    int w = findFirstSet(summary);
+    int b = findFirstSet(words[w]);
+    words[w] &= words[w] - 1;  // Brise najnizi postavljeni bit
+    if (words[w] == 0) {
+        summary &= ~(1ull << w);
+    }
+    count--;
+    return w * 64 + b;
+}
+
+void SeatMap::FreeBits::remove(int slot) {
+    int w = slot >> 6;
+    words[w] &= ~(1ull << (slot & 63));
+    if (words[w] == 0) {
+        summary &= ~(1ull << w);
+    }
+    count--;
+}
+
+void SeatMap::FreeBits::put(int slot) {
+    int w = slot >> 6;
+    words[w] |= 1ull << (slot & 63);
+    summary |= 1ull << w;
+    count++;
+}
+
+// ========== SEAT MAP ==========
+SeatMap::SeatMap(const SeatLayout& layout) : layout(layout) {
+    placeToSlot.resize(layout.places.size());
+
+    for (int i = 0; i < (int)layout.places.size(); i++) {
+        FreeBits& bits = layout.places[i].type == PlaceType::Seat ? freeSeats : freeStanding;
+        if ((int)bits.slotToPlace.size() >= MAX_PLACES_PER_TYPE) {
+            std::cout << "SeatMap: raspored \"" << layout.name << "\" ima previse mesta, visak se ignorise!" << std::endl;
+            placeToSlot[i] = -1;
+            continue;
+        }
+        placeToSlot[i] = (int)bits.slotToPlace.size();
+        bits.slotToPlace.push_back(i);
+    }
+
+    freeSeats.words.resize((freeSeats.slotToPlace.size() + 63) / 64);
+    freeStanding.words.resize((freeStanding.slotToPlace.size() + 63) / 64);
+    reset();
+}
+
+void SeatMap::reset() {
+    FreeBits* pools[2] = { &freeSeats, &freeStanding };
+    for (FreeBits* bits : pools) {
+        bits->summary = 0;
+        bits->count = 0;
+        for (auto& w : bits->words) w = 0;
+        for (int slot = 0; slot < (int)bits->slotToPlace.size(); slot++) {
+            bits->put(slot);
+        }
+    }
+}
+
+int SeatMap::acquire() {
+    int place = acquire(PlaceType::Seat);
+    if (place < 0) {
+        place = acquire(PlaceType::Standing);
+    }
+    return place;
+}
+
+int SeatMap::acquire(PlaceType type) {
+    FreeBits& bits = type == PlaceType::Seat ? freeSeats : freeStanding;
+    int slot = bits.take();
+    return slot < 0 ? -1 : bits.slotToPlace[slot];
+}
+
+bool SeatMap::occupy(int place) {
+    if (!isFree(place)) return false;
+
+    FreeBits& bits = layout.places[place].type == PlaceType::Seat ? freeSeats : freeStanding;
+    bits.remove(placeToSlot[place]);
+    return true;
+}
+
+void SeatMap::release(int place) {
+    if (place < 0 || place >= (int)placeToSlot.size() || placeToSlot[place] < 0) return;
+    if (isFree(place)) return;  // Dvostruko oslobadjanje se ignorise
+
+    FreeBits& bits = layout.places[place].type == PlaceType::Seat ? freeSeats : freeStanding;
+    bits.put(placeToSlot[place]);
+}
+
+bool SeatMap::isFree(int place) const {
+    if (place < 0 || place >= (int)placeToSlot.size() || placeToSlot[place] < 0) return false;
+
+    const FreeBits& bits = layout.places[place].type == PlaceType::Seat ? freeSeats : freeStanding;
+    int slot = placeToSlot[place];
+    return (bits.words[slot >> 6] >> (slot & 63)) & 1ull;
+}
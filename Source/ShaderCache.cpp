@@ -0,0 +1,312 @@
+#include "../Header/ShaderCache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "../Header/GLStats.h"
+#include "../Header/RenderCommands.h"
+#include "../Header/Util.h"
+
+GLuint ShaderCache::activeProgram = 0;
+
+static const char BINARY_MAGIC[4] = { 'K', 'S', 'H', 'B' };
+
+struct BinaryHeader {
+    char magic[4];
+    uint32_t format;
+    uint64_t sourceHash;
+    uint32_t length;
+    uint32_t reserved;
+};
+
+// FNV-1a
+static uint64_t hashBytes(uint64_t h, const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static uint64_t hashString(uint64_t h, const std::string& s) {
+    return hashBytes(h, s.c_str(), s.size() + 1);
+}
+
+static std::string readText(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+// ========== INICIJALIZACIJA ==========
+void ShaderCache::init(const char* vs, const char* fs, const std::vector<std::string>& names,
+                       const char* binaryCachePrefix) {
+    vsPath = vs;
+    fsPath = fs;
+    defineNames = names;
+    cachePrefix = (binaryCachePrefix != nullptr && GLEW_ARB_get_program_binary) ? binaryCachePrefix : "";
+
+    // Binarni program vazi samo za isti izvor, iste #define-ove i isti drajver
+    uint64_t h = 14695981039346656037ull;
+    h = hashString(h, readText(vsPath));
+    h = hashString(h, readText(fsPath));
+    for (const std::string& name : defineNames) h = hashString(h, name);
+    const GLubyte* driver[3] = { glGetString(GL_VENDOR), glGetString(GL_RENDERER), glGetString(GL_VERSION) };
+    for (const GLubyte* s : driver) {
+        if (s != nullptr) h = hashString(h, (const char*)s);
+    }
+    sourceHash = h;
+}
+
+void ShaderCache::destroy() {
+    for (Variant& v : variants) {
+        if (v.program == activeProgram) activeProgram = 0;
+        glDeleteProgram(v.program);
+    }
+    variants.clear();
+    variantIndex.clear();
+    bound = -1;
+}
+
+// ========== VARIJANTE ==========
+std::string ShaderCache::binaryPath(uint32_t key) const {
+    // Ime fragment sejdera bez putanje i ekstenzije
+    size_t slash = fsPath.find_last_of("/\\");
+    std::string name = fsPath.substr(slash == std::string::npos ? 0 : slash + 1);
+    name = name.substr(0, name.find('.'));
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), "_%04x.bin", key);
+    return cachePrefix + name + suffix;
+}
+
+GLuint ShaderCache::loadBinary(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return 0;
+
+    BinaryHeader header;
+    file.read((char*)&header, sizeof(header));
+    if (!file || memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 || header.sourceHash != sourceHash) {
+        return 0;
+    }
+    std::vector<char> binary(header.length);
+    file.read(binary.data(), binary.size());
+    if (!file) return 0;
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, header.format, binary.data(), (GLsizei)binary.size());
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) {
+        // Drajver je odbio binarni oblik (npr. posle azuriranja) - prevodi se iz izvora
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void ShaderCache::saveBinary(const std::string& path, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, NULL, &format, binary.data());
+
+    BinaryHeader header;
+    memcpy(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    header.format = format;
+    header.sourceHash = sourceHash;
+    header.length = (uint32_t)length;
+    header.reserved = 0;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Kes sejdera: ne mogu da upisem \"" << path << "\"" << std::endl;
+        return;
+    }
+    file.write((const char*)&header, sizeof(header));
+    file.write(binary.data(), binary.size());
+}
+
+GLuint ShaderCache::build(uint32_t key) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    std::string path;
+    if (!cachePrefix.empty()) {
+        path = binaryPath(key);
+        GLuint program = loadBinary(path);
+        if (program != 0) {
+            cacheHits++;
+            return program;
+        }
+    }
+
+    std::string defines;
+    for (size_t i = 0; i < defineNames.size(); i++) {
+        if (key & (1u << i)) defines += "#define " + defineNames[i] + "\n";
+    }
+    GLuint program = createShader(vsPath.c_str(), fsPath.c_str(), defines.c_str());
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked == GL_TRUE && !path.empty()) saveBinary(path, program);
+
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "Varijanta sejdera " << fsPath << " [";
+    for (size_t i = 0, n = 0; i < defineNames.size(); i++) {
+        if (key & (1u << i)) std::cout << (n++ ? " " : "") << defineNames[i];
+    }
+    std::cout << "] prevedena za " << elapsed.count() << " ms" << std::endl;
+    return program;
+}
+
+int ShaderCache::variantFor(uint32_t key) {
+    auto it = variantIndex.find(key);
+    if (it != variantIndex.end()) return it->second;
+
+    Variant v;
+    v.key = key;
+    v.program = build(key);
+    v.syncedVersion = 0;
+    v.locations.assign(uniforms.size(), -2);
+    variants.push_back(v);
+    int index = (int)variants.size() - 1;
+    variantIndex[key] = index;
+    return index;
+}
+
+unsigned int ShaderCache::use(uint32_t key) {
+    int index = bound >= 0 && variants[bound].key == key ? bound : variantFor(key);
+    Variant& v = variants[index];
+    bound = index;
+    if (v.program != activeProgram) {
+        useProgram(v.program);
+        activeProgram = v.program;
+    }
+
+    // Dopuni uniforme promenjene dok je bila vezana neka druga varijanta
+    if (v.syncedVersion < version) {
+        for (size_t i = 0; i < uniforms.size(); i++) {
+            if (uniforms[i].version > v.syncedVersion) upload(v, (int)i);
+        }
+        v.syncedVersion = version;
+    }
+    return v.program;
+}
+
+void ShaderCache::warm(const std::vector<uint32_t>& keys) {
+    for (uint32_t key : keys) variantFor(key);
+}
+
+// ========== UNIFORME ==========
+ShaderCache::Uniform& ShaderCache::uniformFor(const char* name, UniformType type) {
+    auto it = uniformIndex.find(name);
+    if (it != uniformIndex.end()) return uniforms[it->second];
+
+    Uniform u;
+    u.name = name;
+    u.type = type;
+    memset(u.f, 0, sizeof(u.f));
+    memset(u.i, 0, sizeof(u.i));
+    u.version = 0;
+    uniforms.push_back(u);
+    uniformIndex[name] = (int)uniforms.size() - 1;
+    for (Variant& v : variants) v.locations.push_back(-2);
+    return uniforms.back();
+}
+
+void ShaderCache::upload(Variant& v, int index) {
+    GLint& location = v.locations[index];
+    const Uniform& u = uniforms[index];
+    if (location == -2) location = glGetUniformLocation(v.program, u.name.c_str());
+    if (location < 0) return;     // Varijanta je izbacila ovu uniformu
+
+    switch (u.type) {
+    case UNIFORM_INT: uniform1i(location, u.i[0]); break;
+    case UNIFORM_FLOAT: uniform1f(location, u.f[0]); break;
+    case UNIFORM_IVEC3: uniform3i(location, u.i[0], u.i[1], u.i[2]); break;
+    case UNIFORM_VEC2: uniform2f(location, u.f[0], u.f[1]); break;
+    case UNIFORM_VEC3: uniform3fv(location, u.f); break;
+    case UNIFORM_MAT4: uniformMatrix4fv(location, u.f); break;
+    }
+}
+
+void ShaderCache::changed(Uniform& u) {
+    u.version = ++version;
+    // Vezana varijanta koja je i aktivni program dobija vrednost odmah i ostaje uskladjena
+    if (bound >= 0 && variants[bound].program == activeProgram) {
+        Variant& v = variants[bound];
+        upload(v, (int)(&u - uniforms.data()));
+        if (v.syncedVersion == version - 1) v.syncedVersion = version;
+    }
+}
+
+void ShaderCache::setInt(const char* name, int value) {
+    Uniform& u = uniformFor(name, UNIFORM_INT);
+    if (u.version != 0 && u.i[0] == value) return;
+    u.i[0] = value;
+    changed(u);
+}
+
+void ShaderCache::setFloat(const char* name, float value) {
+    Uniform& u = uniformFor(name, UNIFORM_FLOAT);
+    if (u.version != 0 && u.f[0] == value) return;
+    u.f[0] = value;
+    changed(u);
+}
+
+void ShaderCache::setIVec3(const char* name, int x, int y, int z) {
+    Uniform& u = uniformFor(name, UNIFORM_IVEC3);
+    if (u.version != 0 && u.i[0] == x && u.i[1] == y && u.i[2] == z) return;
+    u.i[0] = x;
+    u.i[1] = y;
+    u.i[2] = z;
+    changed(u);
+}
+
+void ShaderCache::setVec2(const char* name, float x, float y) {
+    Uniform& u = uniformFor(name, UNIFORM_VEC2);
+    if (u.version != 0 && u.f[0] == x && u.f[1] == y) return;
+    u.f[0] = x;
+    u.f[1] = y;
+    changed(u);
+}
+
+void ShaderCache::setVec3(const char* name, const glm::vec3& value) {
+    Uniform& u = uniformFor(name, UNIFORM_VEC3);
+    if (u.version != 0 && memcmp(u.f, &value[0], 3 * sizeof(float)) == 0) return;
+    memcpy(u.f, &value[0], 3 * sizeof(float));
+    changed(u);
+}
+
+void ShaderCache::setMat4(const char* name, const float* value) {
+    Uniform& u = uniformFor(name, UNIFORM_MAT4);
+    if (u.version != 0 && memcmp(u.f, value, 16 * sizeof(float)) == 0) return;
+    memcpy(u.f, value, 16 * sizeof(float));
+    changed(u);
+}
+
+void ShaderCache::setMat4(const char* name, const glm::mat4& value) {
+    setMat4(name, &value[0][0]);
+}
+
+void ShaderCache::recordUniforms(RenderCommandList& list, uint32_t shader) const {
+    for (const Uniform& u : uniforms) {
+        if (u.version == 0) continue;
+        const char* name = u.name.c_str();
+        switch (u.type) {
+        case UNIFORM_INT: list.setInt(shader, name, u.i[0]); break;
+        case UNIFORM_FLOAT: list.setFloat(shader, name, u.f[0]); break;
+        case UNIFORM_IVEC3: list.setIVec3(shader, name, u.i[0], u.i[1], u.i[2]); break;
+        case UNIFORM_VEC2: list.setVec2(shader, name, u.f[0], u.f[1]); break;
+        case UNIFORM_VEC3: list.setVec3(shader, name, u.f[0], u.f[1], u.f[2]); break;
+        case UNIFORM_MAT4: list.setMat4(shader, name, u.f); break;
+        }
+    }
+}
@@ -0,0 +1,254 @@
+#include "../Header/SimThread.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+typedef InputClock SimClock;     // Isti sat kao vremenske oznake ulaza
+
+// Ako simulacija zaostane vise od ovoliko koraka, preskace se zaostatak umesto sustizanja
+static const int MAX_CATCH_UP_STEPS = 5;
+
+SimThread::SimThread(BusSimulation& simulation, float step) : sim(simulation), stepSeconds(step) {}
+
+SimThread::~SimThread() {
+    stop();
+}
+
+void SimThread::start(InputRecorder* inputRecorder, InputReplayer* inputReplayer) {
+    recorder = inputRecorder;
+    replayer = inputReplayer;
+    replayActive = replayer != nullptr;
+
+    // Prvi snimak pre pokretanja niti, da prvi frejm ne crta podrazumevano stanje
+    writeSnapshot(snapshots.writeBuffer(), 0.0f);
+    snapshots.publish();
+
+    running.store(true);
+    thread = std::thread(&SimThread::run, this);
+}
+
+void SimThread::stop() {
+    if (!running.exchange(false)) return;
+    thread.join();
+}
+
+const SimSnapshot& SimThread::acquireSnapshot() {
+    snapshots.update();
+    return snapshots.readBuffer();
+}
+
+// ========== PETLJA SIMULACIJE ==========
+void SimThread::run() {
+    auto stepDuration = std::chrono::duration_cast<SimClock::duration>(std::chrono::duration<float>(stepSeconds));
+    auto nextTick = SimClock::now();
+
+    while (running.load(std::memory_order_acquire)) {
+        // Korak "pocinje" u zakazanom trenutku i trosi sve sto se desilo pre njega
+        int64_t deadlineNs = std::chrono::duration_cast<std::chrono::nanoseconds>(nextTick.time_since_epoch()).count();
+        FrameInput input;
+        collectInput(input, deadlineNs);
+        input.dt = stepSeconds;
+        tick(input);
+
+        nextTick += stepDuration;
+        auto now = SimClock::now();
+        if (now - nextTick > stepDuration * MAX_CATCH_UP_STEPS) {
+            nextTick = now;
+        }
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
+// ========== ULAZ ==========
+// Dogadjaji se primenjuju redom. Drugi klik (ili isti taster) u istom koraku ceka sledeci
+// korak umesto da se spoji sa prvim, pa se brzi klikovi ne gube.
+void SimThread::collectInput(FrameInput& out, int64_t deadlineNs) {
+    queue.drain(pendingEvents);
+
+    // Tokom reprodukcije ulaz dolazi iz snimka, uzivo dogadjaji se odbacuju
+    if (replayActive) {
+        pendingEvents.clear();
+        return;
+    }
+
+    size_t consumed = 0;
+    for (; consumed < pendingEvents.size(); consumed++) {
+        const TimedInputEvent& e = pendingEvents[consumed];
+        if (e.timeNs > deadlineNs) break;
+
+        bool deferred = false;
+        switch (e.type) {
+        case INPUT_LEFT_CLICK:
+            deferred = out.leftClick;
+            out.leftClick = true;
+            break;
+        case INPUT_RIGHT_CLICK:
+            deferred = out.rightClick;
+            out.rightClick = true;
+            break;
+        case INPUT_KEY:
+            if (e.key == 'K') {
+                deferred = out.keyK;
+                out.keyK = true;
+            } else if (e.key >= '1' && e.key <= '4') {
+                deferred = out.numberKeys[e.key - '1'];
+                out.numberKeys[e.key - '1'] = true;
+            }
+            break;
+        case INPUT_MOUSE_DELTA:
+            out.mouseDx += e.x;
+            out.mouseDy += e.y;
+            break;
+        case INPUT_SCROLL:
+            out.scroll += e.y;
+            break;
+        }
+        if (deferred) break;
+    }
+    pendingEvents.erase(pendingEvents.begin(), pendingEvents.begin() + consumed);
+}
+
+void SimThread::tick(FrameInput input) {
+    auto start = SimClock::now();
+
+    // Pri reprodukciji se ulaz zamenjuje snimljenim (ukljucujuci dt)
+    if (replayActive && !replayer->nextFrame(input)) {
+        replayActive = false;
+        std::cout << "Reprodukcija zavrsena posle " << frame << " frejmova, nastavlja se uzivo." << std::endl;
+        input.dt = stepSeconds;
+    }
+    if (recorder != nullptr) {
+        recorder->recordFrame(frame, (float)sim.simTime, input);
+    }
+    frame++;
+
+    if (input.mouseDx != 0.0f || input.mouseDy != 0.0f) {
+        applyMouseLook(input.mouseDx, input.mouseDy);
+    }
+    if (input.scroll != 0.0f) {
+        applyScroll(input.scroll);
+    }
+
+    // Testiranje dubine i odstranjivanje lica - GL stanje postavlja nit za crtanje iz snimka
+    if (input.numberKeys[0]) {
+        depthTestEnabled = true;
+        std::cout << "Depth Test: UKLJUČEN" << std::endl;
+    }
+    if (input.numberKeys[1]) {
+        depthTestEnabled = false;
+        std::cout << "Depth Test: ISKLJUČEN" << std::endl;
+    }
+    if (input.numberKeys[2]) {
+        faceCullingEnabled = true;
+        std::cout << "Face Culling: UKLJUČEN (uklanja zadnja lica - GL_BACK)" << std::endl;
+    }
+    if (input.numberKeys[3]) {
+        faceCullingEnabled = false;
+        std::cout << "Face Culling: ISKLJUČEN" << std::endl;
+    }
+
+    SimInput simInput;
+    simInput.addPassenger = input.leftClick;
+    simInput.removePassenger = input.rightClick;
+    simInput.sendInspector = input.keyK;
+    sim.step(input.dt, simInput);
+    if (checkpoints != nullptr) {
+        checkpoints->update(sim, driverState());
+    }
+
+    float cpuMs = std::chrono::duration<float, std::milli>(SimClock::now() - start).count();
+    writeSnapshot(snapshots.writeBuffer(), cpuMs);
+    snapshots.publish();
+}
+
+// ========== KAMERA ==========
+void SimThread::applyMouseLook(float xoffset, float yoffset) {
+    float sensitivity = 0.1f;
+    xoffset *= sensitivity;
+    yoffset *= sensitivity;
+
+    yaw += xoffset;
+    pitch += yoffset;
+
+    if (yaw > 0.0f)
+        yaw = 0.0f;
+    if (yaw < -180.0f)
+        yaw = -180.0f;
+
+    if (pitch > 90.0f)
+        pitch = 90.0f;
+    if (pitch < -90.0f)
+        pitch = -90.0f;
+
+    glm::vec3 direction;
+    direction.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
+    direction.y = sin(glm::radians(pitch));
+    direction.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
+    cameraFront = glm::normalize(direction);
+}
+
+void SimThread::applyScroll(float yoffset) {
+    fov -= yoffset;
+    if (fov < 1.0f)
+        fov = 1.0f;
+    if (fov > 45.0f)
+        fov = 45.0f;
+}
+
+// ========== CHECKPOINT ==========
+CheckpointDriverState SimThread::driverState() const {
+    CheckpointDriverState driver;
+    driver.frame = frame;
+    driver.yaw = yaw;
+    driver.pitch = pitch;
+    driver.fov = fov;
+    driver.cameraFront = cameraFront;
+    driver.depthTestEnabled = depthTestEnabled;
+    driver.faceCullingEnabled = faceCullingEnabled;
+    return driver;
+}
+
+void SimThread::restoreDriver(const CheckpointDriverState& driver) {
+    frame = driver.frame;
+    yaw = driver.yaw;
+    pitch = driver.pitch;
+    fov = driver.fov;
+    cameraFront = driver.cameraFront;
+    depthTestEnabled = driver.depthTestEnabled != 0;
+    faceCullingEnabled = driver.faceCullingEnabled != 0;
+}
+
+// ========== SNIMAK STANJA ==========
+void SimThread::writeSnapshot(SimSnapshot& out, float cpuMs) {
+    out.frame = frame;
+    out.simCpuMs = cpuMs;
+    copySimulationState(sim, out);
+
+    out.cameraFront = cameraFront;
+    out.fov = fov;
+    out.depthTestEnabled = depthTestEnabled;
+    out.faceCullingEnabled = faceCullingEnabled;
+}
+
+void copySimulationState(BusSimulation& sim, SimSnapshot& out) {
+    out.simTime = sim.simTime;
+
+    out.currentStation = sim.currentStation;
+    out.nextStation = sim.nextStation;
+    out.busProgress = sim.busProgress;
+    out.busAtStation = sim.busAtStation;
+    out.passengers = sim.passengers;
+    out.totalFines = sim.totalFines;
+    out.isInspectorInBus = sim.isInspectorInBus;
+
+    out.doorOffset = sim.doorOffset;
+    out.wheelRotation = sim.wheelRotation;
+    out.busShakeOffset = sim.busShakeOffset;
+
+    // assign ponovo koristi kapacitet slota, pa posle zagrevanja nema alokacija
+    out.activePassengers.assign(sim.activePassengers.begin(), sim.activePassengers.end());
+    sim.stationCrowd.writeInstances(out.crowdInstances);
+    sim.stationCrowd.writeAnimation(out.crowdAnimation);
+    out.crowdCount = sim.stationCrowd.size();
+}
@@ -0,0 +1,276 @@
+#include "../Header/SkeletalAnimation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../Header/JobSystem.h"
+
+static const float QUAT_SCALE = 32767.0f * 1.41421356f;    // Ostale komponente su u [-1/sqrt2, 1/sqrt2]
+static const int PALETTE_BATCH = 32;                        // Agenata po seriji posla
+
+// ========== KVANTIZACIJA ==========
+PackedQuat packQuat(const glm::quat& q) {
+    float c[4] = { q.x, q.y, q.z, q.w };
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (std::fabs(c[i]) > std::fabs(c[largest])) largest = i;
+    }
+    // q i -q su ista rotacija; izostavljena komponenta je uvek pozitivna
+    float sign = c[largest] < 0.0f ? -1.0f : 1.0f;
+    PackedQuat p;
+    p.largest = (uint16_t)largest;
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i == largest) continue;
+        float v = std::max(-1.0f, std::min(1.0f, c[i] * sign * 1.41421356f));
+        p.v[k++] = (int16_t)std::lround(v * 32767.0f);
+    }
+    return p;
+}
+
+glm::quat unpackQuat(const PackedQuat& p) {
+    float c[4];
+    float sum = 0.0f;
+    for (int i = 0, k = 0; i < 4; i++) {
+        if (i == p.largest) continue;
+        c[i] = p.v[k++] / QUAT_SCALE;
+        sum += c[i] * c[i];
+    }
+    c[p.largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+    return glm::quat(c[3], c[0], c[1], c[2]);
+}
+
+// ========== KLIPOVI ==========
+// Kljuc se zadaje Ojlerovim uglovima u stepenima (x napred/nazad, y okret, z u stranu).
+// Ruka ili noga sa negativnim x ide napred; glava i trup sa pozitivnim x se naginju napred.
+struct KeyPose {
+    glm::vec3 euler[HUMANOID_BONES];
+    float pelvisOffset;
+};
+
+static KeyPose restKey() {
+    KeyPose k;
+    for (glm::vec3& e : k.euler) e = glm::vec3(0.0f);
+    k.pelvisOffset = 0.0f;
+    return k;
+}
+
+static AnimationClip makeClip(float duration, bool loop, int next, const std::vector<KeyPose>& keys) {
+    AnimationClip clip;
+    clip.duration = duration;
+    clip.loop = loop;
+    clip.next = next;
+    clip.keyCount = (int)keys.size();
+    for (const KeyPose& key : keys) {
+        for (int b = 0; b < HUMANOID_BONES; b++) {
+            clip.rotations.push_back(packQuat(glm::quat(glm::radians(key.euler[b]))));
+        }
+        clip.pelvisOffset.push_back((int16_t)std::lround(key.pelvisOffset * PELVIS_OFFSET_SCALE));
+    }
+    return clip;
+}
+
+static KeyPose walkKey(float phase) {
+    // Kao stara animacija hodanja: noge +-25 stepeni; ruke idu suprotno od noge iste strane
+    float s = std::sin(phase);
+    KeyPose k = restKey();
+    k.euler[BONE_LEFT_LEG].x = 25.0f * s;
+    k.euler[BONE_RIGHT_LEG].x = -25.0f * s;
+    k.euler[BONE_LEFT_ARM].x = -18.0f * s;
+    k.euler[BONE_RIGHT_ARM].x = 18.0f * s;
+    k.euler[BONE_SPINE].y = 4.0f * s;
+    k.pelvisOffset = -0.008f * s * s;
+    return k;
+}
+
+static KeyPose sitKey(float legs, float lean, float arms, float pelvis) {
+    KeyPose k = restKey();
+    k.euler[BONE_LEFT_LEG].x = k.euler[BONE_RIGHT_LEG].x = legs;
+    k.euler[BONE_LEFT_ARM].x = k.euler[BONE_RIGHT_ARM].x = arms;
+    k.euler[BONE_SPINE].x = lean;
+    k.pelvisOffset = pelvis;
+    return k;
+}
+
+static AnimationLibrary buildHumanoidAnimations() {
+    AnimationLibrary lib;
+
+    std::vector<KeyPose> idle(4, restKey());
+    const float idleSpine[4] = { 0.0f, 1.5f, 0.0f, -1.0f };
+    const float idleHead[4] = { 0.0f, 6.0f, 0.0f, -6.0f };
+    for (int i = 0; i < 4; i++) {
+        idle[i].euler[BONE_SPINE].x = idleSpine[i];
+        idle[i].euler[BONE_HEAD].y = idleHead[i];
+        idle[i].euler[BONE_LEFT_ARM].z = -3.0f;
+        idle[i].euler[BONE_RIGHT_ARM].z = 3.0f;
+    }
+    lib.clips[CLIP_IDLE] = makeClip(3.0f, true, -1, idle);
+
+    // Jedan korak (ceo ciklus nogu) traje 2*pi/8 s
+    std::vector<KeyPose> walk;
+    for (int i = 0; i < 8; i++) walk.push_back(walkKey(6.2831853f * i / 8.0f));
+    lib.clips[CLIP_WALK] = makeClip(6.2831853f / 8.0f, true, -1, walk);
+
+    // Sedanje: naginje se napred dok se spusta, na kraju su noge vodoravne
+    const KeyPose seated = sitKey(-90.0f, 0.0f, -30.0f, -0.12f);
+    lib.clips[CLIP_SIT_DOWN] = makeClip(0.8f, false, CLIP_SEATED, {
+        restKey(),
+        sitKey(-25.0f, 20.0f, -10.0f, -0.03f),
+        sitKey(-55.0f, 25.0f, -20.0f, -0.08f),
+        sitKey(-80.0f, 12.0f, -28.0f, -0.11f),
+        seated
+    });
+
+    std::vector<KeyPose> sitting(4, seated);
+    const float sittingHead[4] = { 0.0f, 10.0f, 0.0f, -4.0f };
+    for (int i = 0; i < 4; i++) {
+        sitting[i].euler[BONE_HEAD].y = sittingHead[i];
+        sitting[i].euler[BONE_SPINE].x = (i % 2) * 1.5f;
+    }
+    lib.clips[CLIP_SEATED] = makeClip(4.0f, true, -1, sitting);
+
+    lib.clips[CLIP_STAND_UP] = makeClip(0.6f, false, CLIP_WALK, {
+        seated,
+        sitKey(-60.0f, 25.0f, -20.0f, -0.09f),
+        sitKey(-25.0f, 15.0f, -8.0f, -0.03f),
+        restKey()
+    });
+
+    // Kontrolor: desna ruka napred (citac karata), pogled niz red sedista
+    std::vector<KeyPose> check(4, restKey());
+    const float checkArm[4] = { -75.0f, -70.0f, -78.0f, -70.0f };
+    const float checkTurn[4] = { -10.0f, 0.0f, 10.0f, 0.0f };
+    for (int i = 0; i < 4; i++) {
+        check[i].euler[BONE_RIGHT_ARM].x = checkArm[i];
+        check[i].euler[BONE_LEFT_ARM].x = -40.0f;
+        check[i].euler[BONE_HEAD].x = 12.0f;
+        check[i].euler[BONE_HEAD].y = checkTurn[i] * 0.5f;
+        check[i].euler[BONE_SPINE].y = checkTurn[i];
+    }
+    lib.clips[CLIP_CHECK_TICKETS] = makeClip(2.0f, true, -1, check);
+
+    return lib;
+}
+
+const AnimationLibrary& humanoidAnimations() {
+    static const AnimationLibrary library = buildHumanoidAnimations();
+    return library;
+}
+
+// ========== STANJE AGENTA ==========
+void playClip(AnimationState& state, int clip, float fadeSeconds) {
+    if (state.clip == clip) return;
+    state.previousClip = state.clip;
+    state.previousTime = state.time;
+    state.clip = (uint8_t)clip;
+    state.time = 0.0f;
+    state.fadeSeconds = fadeSeconds;
+    state.blend = fadeSeconds > 0.0f ? 0.0f : 1.0f;
+}
+
+void advanceAnimation(AnimationState& state, float dt) {
+    state.time += dt;
+    state.previousTime += dt;
+    if (state.blend < 1.0f) {
+        state.blend = state.fadeSeconds > 0.0f ? std::min(1.0f, state.blend + dt / state.fadeSeconds) : 1.0f;
+    }
+
+    const AnimationClip& clip = humanoidAnimations().clips[state.clip];
+    if (!clip.loop && clip.next >= 0 && state.time >= clip.duration) {
+        // Poslednji kljuc i prvi kljuc sledeceg klipa su ista poza, pa je pretapanje kratko
+        float overflow = state.time - clip.duration;
+        playClip(state, clip.next, 0.1f);
+        state.time = overflow;
+    }
+}
+
+// ========== POZA ==========
+// Po komponentama, jednim mnozenjem reciprocnom duzinom (vruca petlja poza)
+static glm::quat nlerp(const glm::quat& a, const glm::quat& b, float t) {
+    float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    float ta = 1.0f - t;
+    float tb = dot < 0.0f ? -t : t;
+    glm::quat q(a.w * ta + b.w * tb, a.x * ta + b.x * tb, a.y * ta + b.y * tb, a.z * ta + b.z * tb);
+    float invLength = 1.0f / std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    return glm::quat(q.w * invLength, q.x * invLength, q.y * invLength, q.z * invLength);
+}
+
+void sampleClip(const AnimationClip& clip, float time, Pose& out) {
+    int n = clip.keyCount;
+    float interval = clip.duration / (clip.loop ? n : std::max(1, n - 1));
+    float t = clip.loop ? std::fmod(std::max(0.0f, time), clip.duration) : std::min(std::max(0.0f, time), clip.duration);
+
+    float f = t / interval;
+    int k0 = std::min((int)f, n - 1);
+    float frac = std::min(1.0f, f - (float)k0);
+    int k1 = clip.loop ? (k0 + 1) % n : std::min(k0 + 1, n - 1);
+
+    const PackedQuat* a = &clip.rotations[k0 * HUMANOID_BONES];
+    const PackedQuat* b = &clip.rotations[k1 * HUMANOID_BONES];
+    for (int bone = 0; bone < HUMANOID_BONES; bone++) {
+        out.rotation[bone] = nlerp(unpackQuat(a[bone]), unpackQuat(b[bone]), frac);
+    }
+    float offset0 = clip.pelvisOffset[k0] / PELVIS_OFFSET_SCALE;
+    float offset1 = clip.pelvisOffset[k1] / PELVIS_OFFSET_SCALE;
+    out.pelvisOffset = offset0 + (offset1 - offset0) * frac;
+}
+
+void evaluatePose(const AnimationState& state, Pose& out) {
+    const AnimationLibrary& lib = humanoidAnimations();
+    sampleClip(lib.clips[state.clip], state.time, out);
+    if (state.blend >= 1.0f) return;
+
+    Pose previous;
+    sampleClip(lib.clips[state.previousClip], state.previousTime, previous);
+    for (int bone = 0; bone < HUMANOID_BONES; bone++) {
+        out.rotation[bone] = nlerp(previous.rotation[bone], out.rotation[bone], state.blend);
+    }
+    out.pelvisOffset = previous.pelvisOffset + (out.pelvisOffset - previous.pelvisOffset) * state.blend;
+}
+
+void poseToPalette(const Skeleton& skeleton, const Pose& pose, float* out) {
+    glm::mat4 global[HUMANOID_BONES];
+    for (int bone = 0; bone < HUMANOID_BONES; bone++) {
+        // T(pivot) * R * T(-pivot): rotacija ostaje, pomak je pivot - R * pivot
+        const glm::vec3& pivot = skeleton.pivot[bone];
+        glm::mat4 local = glm::mat4_cast(pose.rotation[bone]);
+        glm::vec3 offset = pivot - glm::mat3(local) * pivot;
+        if (bone == BONE_PELVIS) offset.y += pose.pelvisOffset;
+        local[3] = glm::vec4(offset, 1.0f);
+        int parent = skeleton.parent[bone];
+        global[bone] = parent < 0 ? local : global[parent] * local;
+
+        float* rows = out + bone * PALETTE_FLOATS_PER_BONE;
+        for (int r = 0; r < 3; r++) {
+            for (int c = 0; c < 4; c++) rows[r * 4 + c] = global[bone][c][r];
+        }
+    }
+}
+
+// ========== PALETA SVIH AGENATA ==========
+void evaluatePalettes(const std::vector<AnimatedAgent>& agents, JobSystem* jobs, std::vector<float>& out) {
+    out.resize(agents.size() * PALETTE_FLOATS_PER_AGENT);
+    auto evaluateRange = [&](int first, int last) {
+        Pose pose;
+        for (int i = first; i < last; i++) {
+            evaluatePose(agents[i].state, pose);
+            poseToPalette(*agents[i].skeleton, pose, &out[(size_t)i * PALETTE_FLOATS_PER_AGENT]);
+        }
+    };
+    if (jobs != nullptr) {
+        jobs->parallelFor((int)agents.size(), PALETTE_BATCH, evaluateRange);
+    } else {
+        evaluateRange(0, (int)agents.size());
+    }
+}
+
+AnimationState crowdAnimationState(float walkTime, float walkWeight) {
+    AnimationState state;
+    state.previousClip = CLIP_IDLE;
+    state.previousTime = walkTime;
+    state.clip = CLIP_WALK;
+    state.time = walkTime;
+    state.blend = std::min(1.0f, std::max(0.0f, walkWeight));
+    return state;
+}
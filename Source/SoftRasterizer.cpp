@@ -0,0 +1,598 @@
+#include "../Header/SoftRasterizer.h"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include "../Header/Geometry.h"
+#include "../Header/JobSystem.h"
+#include "../Header/SkeletalAnimation.h"
+
+// Rub za odsecanje po x/y: trouglovi se odsecaju tek izvan 4x sirine ekrana, pa ivice ekrana
+// obicno ne prave nova temena, a koordinate u pikselima ostaju male za float
+static const float GUARD_BAND = 4.0f;
+// Temena se zaokruzuju na 1/256 piksela, kao podpikselna preciznost GPU-a
+static const float SUBPIXEL = 256.0f;
+
+// Normala je na pomaku 10 kao u glVertexAttribPointer u Main-u, da senka bude ista kao na GPU-u
+static const int NORMAL_OFFSET = 10;
+
+// Slotovi atributa u ClipVertex::attr
+static const int ATTR_POSITION = 0;
+static const int ATTR_NORMAL = 3;
+static const int ATTR_COLOR = 6;
+static const int ATTR_UV = 10;
+
+// max(x, 0) koji za NaN vraca 0, kao max u GLSL-u na GPU-u
+static float maxZero(float x) {
+    return x > 0.0f ? x : 0.0f;
+}
+
+// pow za celobrojni sjaj (32) mnozenjem, inace std::pow
+static float powShine(float x, float shine) {
+    int n = (int)shine;
+    if ((float)n != shine || n < 0 || n > 256) return std::pow(x, shine);
+    float result = 1.0f;
+    while (n > 0) {
+        if (n & 1) result *= x;
+        x *= x;
+        n >>= 1;
+    }
+    return result;
+}
+
+static uint32_t packColor(const glm::vec4& c) {
+    glm::vec4 v = glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f;
+    return (uint32_t)v.r | ((uint32_t)v.g << 8) | ((uint32_t)v.b << 16) | ((uint32_t)v.a << 24);
+}
+
+static glm::vec4 unpackColor(uint32_t c) {
+    return glm::vec4((float)(c & 0xff), (float)((c >> 8) & 0xff), (float)((c >> 16) & 0xff), (float)(c >> 24)) * (1.0f / 255.0f);
+}
+
+// ========== TEKSTURA I BAFER ==========
+glm::vec4 SoftTexture::sample(float u, float v) const {
+    if (width == 0 || height == 0) return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    float x = u * width - 0.5f;
+    float y = v * height - 0.5f;
+    float fx = std::floor(x), fy = std::floor(y);
+    float tx = x - fx, ty = y - fy;
+    int x0 = std::max(0, std::min((int)fx, width - 1));
+    int x1 = std::max(0, std::min((int)fx + 1, width - 1));
+    int y0 = std::max(0, std::min((int)fy, height - 1));
+    int y1 = std::max(0, std::min((int)fy + 1, height - 1));
+
+    auto texel = [&](int px, int py) {
+        const uint8_t* t = &rgba[((size_t)py * width + px) * 4];
+        return glm::vec4(t[0], t[1], t[2], t[3]);
+    };
+    glm::vec4 bottom = glm::mix(texel(x0, y0), texel(x1, y0), tx);
+    glm::vec4 top = glm::mix(texel(x0, y1), texel(x1, y1), tx);
+    return glm::mix(bottom, top, ty) * (1.0f / 255.0f);
+}
+
+void SoftFramebuffer::resize(int w, int h) {
+    width = w;
+    height = h;
+    stride = (w + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE * SOFT_TILE_SIZE;
+    rows = (h + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE * SOFT_TILE_SIZE;
+    color.assign((size_t)stride * rows, 0);
+    depth.assign((size_t)stride * rows, 1.0f);
+}
+
+void SoftFramebuffer::readPixels(std::vector<uint8_t>& out) const {
+    out.resize((size_t)width * height * 4);
+    for (int y = 0; y < height; y++) {
+        memcpy(&out[(size_t)y * width * 4], &color[(size_t)y * stride], (size_t)width * 4);
+    }
+}
+
+void SoftFramebuffer::toTexture(SoftTexture& out) const {
+    out.width = width;
+    out.height = height;
+    readPixels(out.rgba);
+}
+
+// ========== NITI ==========
+void SoftRasterizer::init(JobSystem* jobs) {
+    this->jobs = jobs;
+}
+
+int SoftRasterizer::threadCount() const {
+    return jobs != nullptr ? jobs->threadCount() : 1;
+}
+
+// ========== STANJE ==========
+void SoftRasterizer::begin(SoftFramebuffer& framebuffer) {
+    if (target != nullptr) flush();
+    target = &framebuffer;
+    tilesX = framebuffer.stride / SOFT_TILE_SIZE;
+    tilesY = framebuffer.rows / SOFT_TILE_SIZE;
+    bins.resize(tilesX * tilesY);
+}
+
+void SoftRasterizer::clear(const glm::vec4& color) {
+    // Sve poslato pre clear-a bi bilo obrisano
+    triangles.clear();
+    for (std::vector<uint32_t>& bin : bins) bin.clear();
+    clearPending = true;
+    clearColor = packColor(color);
+}
+
+void SoftRasterizer::setState(const SoftDrawState& state) {
+    states.push_back(state);
+}
+
+// ========== TEMENA ==========
+void SoftRasterizer::processVertex3D(const float* v, const glm::mat4& model, ClipVertex& out) const {
+    const SoftDrawState& state = states.back();
+    glm::vec4 world = model * glm::vec4(v[0], v[1], v[2], 1.0f);
+    out.position = state.viewProjection * world;
+    // Umesto inverzne transponovane dovoljan je sam model: u sceni su samo rotacije, translacije
+    // i uniformne skale, a normala se normalizuje po pikselu
+    glm::vec3 normal = glm::mat3(model) * glm::vec3(v[NORMAL_OFFSET], v[NORMAL_OFFSET + 1], v[NORMAL_OFFSET + 2]);
+    out.attr[ATTR_POSITION] = world.x;
+    out.attr[ATTR_POSITION + 1] = world.y;
+    out.attr[ATTR_POSITION + 2] = world.z;
+    out.attr[ATTR_NORMAL] = normal.x;
+    out.attr[ATTR_NORMAL + 1] = normal.y;
+    out.attr[ATTR_NORMAL + 2] = normal.z;
+    for (int k = 0; k < 4; k++) out.attr[ATTR_COLOR + k] = v[3 + k];
+    out.attr[ATTR_UV] = v[7];
+    out.attr[ATTR_UV + 1] = v[8];
+}
+
+// Isto kao SKINNED varijanta basic3d: uM * matrica kosti temena
+glm::mat4 SoftRasterizer::skinnedModel(uint32_t vertex) const {
+    const SoftDrawState& state = states.back();
+    if (!state.palette) return state.model;
+    int bone = (int)(state.bones[vertex] + 0.5f);
+    return state.model * paletteMatrix(state.palette + bone * PALETTE_FLOATS_PER_BONE);
+}
+
+void SoftRasterizer::processVertex2D(float x, float y, float u, float w, ClipVertex& out) const {
+    out.position = states.back().model * glm::vec4(x, y, 0.0f, 1.0f);
+    memset(out.attr, 0, sizeof(out.attr));
+    out.attr[ATTR_COLOR + 3] = 1.0f;
+    out.attr[ATTR_UV] = u;
+    out.attr[ATTR_UV + 1] = w;
+}
+
+void SoftRasterizer::drawQuads(const float* vertices, int firstQuad, int quadCount) {
+    ClipVertex v[4];
+    for (int q = firstQuad; q < firstQuad + quadCount; q++) {
+        for (int k = 0; k < 4; k++) processVertex3D(vertices + (q * 4 + k) * VERTEX_3D_FLOATS, states.back().model, v[k]);
+        submit(&v[0], &v[1], &v[2]);
+        submit(&v[0], &v[2], &v[3]);
+    }
+}
+
+void SoftRasterizer::drawTriangles(const float* vertices, int vertexCount) {
+    ClipVertex v[3];
+    for (int i = 0; i + 2 < vertexCount; i += 3) {
+        for (int k = 0; k < 3; k++) processVertex3D(vertices + (i + k) * VERTEX_3D_FLOATS, skinnedModel(i + k), v[k]);
+        submit(&v[0], &v[1], &v[2]);
+    }
+}
+
+void SoftRasterizer::drawIndexed(const float* vertices, const uint32_t* indices, int indexCount) {
+    ClipVertex v[3];
+    for (int i = 0; i + 2 < indexCount; i += 3) {
+        for (int k = 0; k < 3; k++) {
+            processVertex3D(vertices + indices[i + k] * VERTEX_3D_FLOATS, skinnedModel(indices[i + k]), v[k]);
+        }
+        submit(&v[0], &v[1], &v[2]);
+    }
+}
+
+void SoftRasterizer::drawIndexed2D(const float* vertices, const unsigned int* indices, int indexCount) {
+    ClipVertex v[3];
+    for (int i = 0; i + 2 < indexCount; i += 3) {
+        for (int k = 0; k < 3; k++) {
+            const float* p = vertices + indices[i + k] * 4;
+            processVertex2D(p[0], p[1], p[2], p[3], v[k]);
+        }
+        submit(&v[0], &v[1], &v[2]);
+    }
+}
+
+void SoftRasterizer::drawFan2D(const float* points, int count) {
+    if (count < 3) return;
+    ClipVertex first, prev, cur;
+    processVertex2D(points[0], points[1], 0.0f, 0.0f, first);
+    processVertex2D(points[2], points[3], 0.0f, 0.0f, prev);
+    for (int i = 2; i < count; i++) {
+        processVertex2D(points[i * 2], points[i * 2 + 1], 0.0f, 0.0f, cur);
+        submit(&first, &prev, &cur);
+        prev = cur;
+    }
+}
+
+// Siroke linije kao u GL-u bez antialiasinga: segment se siri uspravno ako je vise vodoravan,
+// inace vodoravno, za width piksela. Linije se ne odstranjuju (face culling ih ne dira).
+void SoftRasterizer::drawLineStrip2D(const float* points, int count, float width) {
+    const glm::mat4& model = states.back().model;
+    float halfX = width / target->width;        // Pola sirine u NDC jedinicama
+    float halfY = width / target->height;
+
+    ClipVertex v[4];
+    for (int i = 0; i < 4; i++) processVertex2D(0.0f, 0.0f, 0.0f, 0.0f, v[i]);
+    for (int i = 0; i + 1 < count; i++) {
+        glm::vec4 p = model * glm::vec4(points[i * 2], points[i * 2 + 1], 0.0f, 1.0f);
+        glm::vec4 q = model * glm::vec4(points[i * 2 + 2], points[i * 2 + 3], 0.0f, 1.0f);
+        float dx = (q.x - p.x) * target->width, dy = (q.y - p.y) * target->height;
+        bool xMajor = std::fabs(dx) >= std::fabs(dy);
+        glm::vec4 offset = xMajor ? glm::vec4(0.0f, halfY, 0.0f, 0.0f) : glm::vec4(halfX, 0.0f, 0.0f, 0.0f);
+        // Smer pomaka bira se tako da kvadar bude CCW
+        if (xMajor ? dx < 0.0f : dy > 0.0f) offset = -offset;
+        v[0].position = p - offset;
+        v[1].position = q - offset;
+        v[2].position = q + offset;
+        v[3].position = p + offset;
+        submit(&v[0], &v[1], &v[2]);
+        submit(&v[0], &v[2], &v[3]);
+    }
+}
+
+// ========== ODSECANJE ==========
+// Ravni: blizu, daleko, pa rub po x i y. Rastojanje >= 0 znaci unutra.
+static float planeDistance(const glm::vec4& p, int plane) {
+    switch (plane) {
+    case 0: return p.z + p.w;
+    case 1: return p.w - p.z;
+    case 2: return p.x + GUARD_BAND * p.w;
+    case 3: return GUARD_BAND * p.w - p.x;
+    case 4: return p.y + GUARD_BAND * p.w;
+    default: return GUARD_BAND * p.w - p.y;
+    }
+}
+
+static bool lessVertex(const glm::vec4& a, const glm::vec4& b) {
+    if (a.x != b.x) return a.x < b.x;
+    if (a.y != b.y) return a.y < b.y;
+    if (a.z != b.z) return a.z < b.z;
+    return a.w < b.w;
+}
+
+void SoftRasterizer::submit(const ClipVertex* v0, const ClipVertex* v1, const ClipVertex* v2) {
+    const ClipVertex* in[3] = { v0, v1, v2 };
+    int outsideAny = 0;
+    for (int plane = 0; plane < 6; plane++) {
+        int outside = 0;
+        for (int k = 0; k < 3; k++) {
+            if (planeDistance(in[k]->position, plane) < 0.0f) outside++;
+        }
+        if (outside == 3) return;
+        outsideAny |= outside;
+    }
+    if (outsideAny == 0) {
+        setup(*v0, *v1, *v2);
+        return;
+    }
+
+    // Sutherland-Hodgman; presek ivice se uvek racuna od "manjeg" temena, pa ivica zajednicka
+    // za dva trougla daje isto teme u oba
+    ClipVertex bufferA[12], bufferB[12];
+    ClipVertex* src = bufferA;
+    ClipVertex* dst = bufferB;
+    int count = 3;
+    for (int k = 0; k < 3; k++) src[k] = *in[k];
+
+    for (int plane = 0; plane < 6 && count >= 3; plane++) {
+        int outCount = 0;
+        for (int i = 0; i < count; i++) {
+            const ClipVertex& a = src[i];
+            const ClipVertex& b = src[(i + 1) % count];
+            float da = planeDistance(a.position, plane);
+            float db = planeDistance(b.position, plane);
+            if (da >= 0.0f) dst[outCount++] = a;
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                bool swap = lessVertex(b.position, a.position);
+                const ClipVertex& p = swap ? b : a;
+                const ClipVertex& q = swap ? a : b;
+                float dp = swap ? db : da, dq = swap ? da : db;
+                float t = dp / (dp - dq);
+                ClipVertex& r = dst[outCount++];
+                r.position = p.position + (q.position - p.position) * t;
+                for (int k = 0; k < ATTRIBUTES; k++) r.attr[k] = p.attr[k] + (q.attr[k] - p.attr[k]) * t;
+            }
+        }
+        count = outCount;
+        std::swap(src, dst);
+    }
+
+    for (int i = 1; i + 1 < count; i++) setup(src[0], src[i], src[i + 1]);
+}
+
+// ========== PRIPREMA TROUGLA ==========
+void SoftRasterizer::setup(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c) {
+    const SoftDrawState& state = states.back();
+    const ClipVertex* v[3] = { &a, &b, &c };
+    float x[3], y[3];
+    Triangle tri;
+    for (int k = 0; k < 3; k++) {
+        float invW = 1.0f / v[k]->position.w;
+        x[k] = std::floor(((v[k]->position.x * invW) * 0.5f + 0.5f) * target->width * SUBPIXEL + 0.5f) / SUBPIXEL;
+        y[k] = std::floor(((v[k]->position.y * invW) * 0.5f + 0.5f) * target->height * SUBPIXEL + 0.5f) / SUBPIXEL;
+        tri.z[k] = (v[k]->position.z * invW) * 0.5f + 0.5f;
+        tri.invW[k] = invW;
+        for (int i = 0; i < ATTRIBUTES; i++) tri.attr[k][i] = v[k]->attr[i] * invW;
+    }
+
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0.0f) return;
+    if (area < 0.0f) {
+        // Zadnje lice (CW na ekranu); dalje se racuna kao CCW
+        if (state.cullBack) return;
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        std::swap(tri.z[1], tri.z[2]);
+        std::swap(tri.invW[1], tri.invW[2]);
+        for (int i = 0; i < ATTRIBUTES; i++) std::swap(tri.attr[1][i], tri.attr[2][i]);
+        area = -area;
+    }
+
+    // Temena 1 i 2 cuvaju razliku u odnosu na teme 0: tezine se ne sabiraju tacno u 1 kada je
+    // C ivicne funkcije veliko naspram povrsine (sitni, daleki trouglovi), a ovako greska
+    // tezina ne pomera dubinu ka kameri
+    for (int k = 1; k < 3; k++) {
+        tri.z[k] -= tri.z[0];
+        tri.invW[k] -= tri.invW[0];
+        for (int i = 0; i < ATTRIBUTES; i++) tri.attr[k][i] -= tri.attr[0][i];
+    }
+
+    // Ivica naspram temena k ide od temena k+1 do k+2; unutra je E > 0. Pravilo gore-levo:
+    // piksel tacno na ivici pripada trouglu samo ako je ivica leva ili gornja.
+    for (int k = 0; k < 3; k++) {
+        int p = (k + 1) % 3, q = (k + 2) % 3;
+        tri.A[k] = y[p] - y[q];
+        tri.B[k] = x[q] - x[p];
+        tri.C[k] = x[p] * y[q] - y[p] * x[q];
+        tri.topLeft[k] = tri.A[k] > 0.0f || (tri.A[k] == 0.0f && tri.B[k] < 0.0f);
+    }
+    tri.invArea = 1.0f / area;
+
+    tri.minX = std::max(0, (int)std::floor(std::min(std::min(x[0], x[1]), x[2])));
+    tri.minY = std::max(0, (int)std::floor(std::min(std::min(y[0], y[1]), y[2])));
+    tri.maxX = std::min(target->width - 1, (int)std::ceil(std::max(std::max(x[0], x[1]), x[2])));
+    tri.maxY = std::min(target->height - 1, (int)std::ceil(std::max(std::max(y[0], y[1]), y[2])));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) return;
+
+    tri.state = (uint32_t)states.size() - 1;
+    triangles.push_back(tri);
+}
+
+// ========== RASTERIZACIJA ==========
+void SoftRasterizer::flush() {
+    if (target == nullptr) return;
+    if (!triangles.empty() || clearPending) {
+        for (uint32_t i = 0; i < (uint32_t)triangles.size(); i++) {
+            const Triangle& tri = triangles[i];
+            for (int ty = tri.minY / SOFT_TILE_SIZE; ty <= tri.maxY / SOFT_TILE_SIZE; ty++) {
+                for (int tx = tri.minX / SOFT_TILE_SIZE; tx <= tri.maxX / SOFT_TILE_SIZE; tx++) {
+                    bins[ty * tilesX + tx].push_back(i);
+                }
+            }
+        }
+
+        // Po jedna plocica u seriji; prazne se preskacu, pa su serije vrlo razlicite duzine
+        auto renderTiles = [this](int first, int last) {
+            for (int t = first; t < last; t++) {
+                if (clearPending || !bins[t].empty()) renderTile(t);
+            }
+        };
+        int tileCount = tilesX * tilesY;
+        if (jobs != nullptr) jobs->parallelFor(tileCount, 1, renderTiles);
+        else renderTiles(0, tileCount);
+        trianglesDrawn += triangles.size();
+    }
+
+    triangles.clear();
+    for (std::vector<uint32_t>& bin : bins) bin.clear();
+    clearPending = false;
+    SoftDrawState last = states.back();
+    states.clear();
+    states.push_back(last);
+}
+
+void SoftRasterizer::renderTile(int tile) {
+    SoftFramebuffer& fb = *target;
+    int tileX0 = (tile % tilesX) * SOFT_TILE_SIZE;
+    int tileY0 = (tile / tilesX) * SOFT_TILE_SIZE;
+    int tileX1 = tileX0 + SOFT_TILE_SIZE - 1;
+    int tileY1 = tileY0 + SOFT_TILE_SIZE - 1;
+
+    if (clearPending) {
+        for (int y = tileY0; y <= tileY1; y++) {
+            std::fill_n(&fb.color[(size_t)y * fb.stride + tileX0], SOFT_TILE_SIZE, clearColor);
+            std::fill_n(&fb.depth[(size_t)y * fb.stride + tileX0], SOFT_TILE_SIZE, 1.0f);
+        }
+    }
+
+    const __m128 lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128i laneIndex = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128 zero = _mm_setzero_ps();
+    float attr[ATTRIBUTES];
+    alignas(16) float e[3][4];     // Tezine temena 1 i 2; teme 0 je implicitno
+    alignas(16) float zs[4];
+
+    for (uint32_t index : bins[tile]) {
+        const Triangle& tri = triangles[index];
+        const SoftDrawState& state = states[tri.state];
+        int minX = std::max(tri.minX, tileX0), maxX = std::min(tri.maxX, tileX1);
+        int minY = std::max(tri.minY, tileY0), maxY = std::min(tri.maxY, tileY1);
+        if (minX > maxX || minY > maxY) continue;
+
+        __m128 A[3], C[3], topLeft[3];
+        for (int k = 0; k < 3; k++) {
+            A[k] = _mm_set1_ps(tri.A[k]);
+            C[k] = _mm_set1_ps(tri.C[k]);
+            topLeft[k] = _mm_castsi128_ps(_mm_set1_epi32(tri.topLeft[k] ? -1 : 0));
+        }
+        __m128 invArea = _mm_set1_ps(tri.invArea);
+        __m128 z0 = _mm_set1_ps(tri.z[0]), z1 = _mm_set1_ps(tri.z[1]), z2 = _mm_set1_ps(tri.z[2]);
+        __m128i columnMin = _mm_set1_epi32(minX - 1), columnMax = _mm_set1_epi32(maxX + 1);
+        int startX = minX & ~3;
+
+        for (int y = minY; y <= maxY; y++) {
+            float py = y + 0.5f;
+            __m128 Bpy[3];
+            for (int k = 0; k < 3; k++) Bpy[k] = _mm_set1_ps(tri.B[k] * py);
+            uint32_t* colorRow = &fb.color[(size_t)y * fb.stride];
+            float* depthRow = &fb.depth[(size_t)y * fb.stride];
+
+            for (int x = startX; x <= maxX; x += 4) {
+                __m128 px = _mm_add_ps(_mm_set1_ps((float)x), lane);
+                __m128 inside = _mm_castsi128_ps(_mm_and_si128(
+                    _mm_cmpgt_epi32(_mm_add_epi32(_mm_set1_epi32(x), laneIndex), columnMin),
+                    _mm_cmplt_epi32(_mm_add_epi32(_mm_set1_epi32(x), laneIndex), columnMax)));
+                __m128 E[3];
+                for (int k = 0; k < 3; k++) {
+                    // (A*x + B*y) + C istim redom za oba trougla zajednicke ivice -> tacno suprotan znak
+                    E[k] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(A[k], px), Bpy[k]), C[k]);
+                    __m128 covered = _mm_or_ps(_mm_cmpgt_ps(E[k], zero), _mm_and_ps(_mm_cmpeq_ps(E[k], zero), topLeft[k]));
+                    inside = _mm_and_ps(inside, covered);
+                }
+                int mask = _mm_movemask_ps(inside);
+                if (mask == 0) continue;
+
+                __m128 b1 = _mm_mul_ps(E[1], invArea);
+                __m128 b2 = _mm_mul_ps(E[2], invArea);
+                __m128 z = _mm_add_ps(_mm_add_ps(z0, _mm_mul_ps(z1, b1)), _mm_mul_ps(z2, b2));
+                if (state.depthTest) {
+                    mask &= _mm_movemask_ps(_mm_cmplt_ps(z, _mm_loadu_ps(depthRow + x)));
+                    if (mask == 0) continue;
+                }
+                _mm_store_ps(e[1], b1);
+                _mm_store_ps(e[2], b2);
+                _mm_store_ps(zs, z);
+
+                for (int i = 0; i < 4; i++) {
+                    if (!(mask & (1 << i))) continue;
+                    float w1 = e[1][i], w2 = e[2][i];
+                    float invW = 1.0f / (tri.invW[0] + w1 * tri.invW[1] + w2 * tri.invW[2]);
+                    for (int k = 0; k < ATTRIBUTES; k++) {
+                        attr[k] = (tri.attr[0][k] + w1 * tri.attr[1][k] + w2 * tri.attr[2][k]) * invW;
+                    }
+                    glm::vec4 src = glm::clamp(shade(state, attr), 0.0f, 1.0f);
+                    if (src.a >= 1.0f) {
+                        colorRow[x + i] = packColor(src);
+                    } else {
+                        glm::vec4 dst = unpackColor(colorRow[x + i]);
+                        colorRow[x + i] = packColor(src * src.a + dst * (1.0f - src.a));
+                    }
+                    if (state.depthTest) depthRow[x + i] = zs[i];
+                }
+            }
+        }
+    }
+}
+
+// ========== SENCENJE ==========
+// basic3d.frag (lit) ili basic.frag, za varijantu opisanu stanjem
+glm::vec4 SoftRasterizer::shade(const SoftDrawState& state, const float* attr) const {
+    glm::vec4 vertexColor(attr[ATTR_COLOR], attr[ATTR_COLOR + 1], attr[ATTR_COLOR + 2], attr[ATTR_COLOR + 3]);
+    if (!state.lit) {
+        if (state.texture != nullptr) {
+            glm::vec4 t = state.texture->sample(attr[ATTR_UV], attr[ATTR_UV + 1]);
+            return glm::vec4(glm::vec3(t), t.a * state.alpha);
+        }
+        if (state.customColor) return glm::vec4(state.color, state.alpha);
+        return glm::vec4(glm::vec3(vertexColor), vertexColor.a * state.alpha);
+    }
+
+    glm::vec3 pos(attr[ATTR_POSITION], attr[ATTR_POSITION + 1], attr[ATTR_POSITION + 2]);
+    glm::vec3 normal(attr[ATTR_NORMAL], attr[ATTR_NORMAL + 1], attr[ATTR_NORMAL + 2]);
+    glm::vec3 norm = normal * (1.0f / std::sqrt(glm::dot(normal, normal)));
+    glm::vec3 lightDir = glm::normalize(state.light.position - pos);
+
+    const BakeLight& L = state.light;
+    const BakeMaterial& M = state.material;
+    glm::vec3 ambient = L.kA * M.kA;
+    float nD = maxZero(glm::dot(norm, lightDir));
+    glm::vec3 diffuse = L.kD * (nD * M.kD);
+    glm::vec3 viewDir = glm::normalize(state.viewPos - pos);
+    glm::vec3 reflectDir = -lightDir - 2.0f * glm::dot(norm, -lightDir) * norm;
+    float s = powShine(maxZero(glm::dot(viewDir, reflectDir)), M.shine);
+    glm::vec3 specular = L.kS * (s * M.kS);
+    glm::vec3 lighting = ambient + diffuse + specular;
+
+    if (state.texture != nullptr) {
+        glm::vec4 t = state.texture->sample(attr[ATTR_UV], attr[ATTR_UV + 1]);
+        return glm::vec4(glm::vec3(t) * lighting, state.transparent ? t.a : 1.0f);
+    }
+    glm::vec3 color = state.customColor ? state.color : glm::vec3(vertexColor);
+    return glm::vec4(color * lighting, vertexColor.a);
+}
+
+// ========== SLIKE ==========
+bool writePPM(const std::string& path, int width, int height, const std::vector<uint8_t>& rgba) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file << "P6\n" << width << " " << height << "\n255\n";
+    std::vector<uint8_t> row((size_t)width * 3);
+    for (int y = height - 1; y >= 0; y--) {
+        const uint8_t* src = &rgba[(size_t)y * width * 4];
+        for (int x = 0; x < width; x++) {
+            row[x * 3] = src[x * 4];
+            row[x * 3 + 1] = src[x * 4 + 1];
+            row[x * 3 + 2] = src[x * 4 + 2];
+        }
+        file.write((const char*)row.data(), row.size());
+    }
+    return (bool)file;
+}
+
+bool readPPM(const std::string& path, int& width, int& height, std::vector<uint8_t>& rgba) {
+    std::ifstream file(path, std::ios::binary);
+    std::string magic;
+    int maxValue = 0;
+    if (!(file >> magic >> width >> height >> maxValue) || magic != "P6" || maxValue != 255 || width <= 0 || height <= 0) {
+        return false;
+    }
+    file.get();
+    std::vector<uint8_t> row((size_t)width * 3);
+    rgba.resize((size_t)width * height * 4);
+    for (int y = height - 1; y >= 0; y--) {
+        if (!file.read((char*)row.data(), row.size())) return false;
+        uint8_t* dst = &rgba[(size_t)y * width * 4];
+        for (int x = 0; x < width; x++) {
+            dst[x * 4] = row[x * 3];
+            dst[x * 4 + 1] = row[x * 3 + 1];
+            dst[x * 4 + 2] = row[x * 3 + 2];
+            dst[x * 4 + 3] = 255;
+        }
+    }
+    return true;
+}
+
+ImageDiff compareImages(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, int pixelCount, int threshold,
+                        const std::vector<uint8_t>* mask) {
+    ImageDiff diff;
+    if (pixelCount <= 0) return diff;
+    uint64_t sum = 0;
+    int bad = 0, masked = 0;
+    for (int i = 0; i < pixelCount; i++) {
+        if (mask != nullptr && (*mask)[i] != 0) {
+            masked++;
+            continue;
+        }
+        int worst = 0;
+        for (int c = 0; c < 3; c++) {
+            int d = std::abs((int)a[i * 4 + c] - (int)b[i * 4 + c]);
+            sum += d;
+            worst = std::max(worst, d);
+        }
+        diff.maxError = std::max(diff.maxError, worst);
+        if (worst > threshold) bad++;
+    }
+    int compared = pixelCount - masked;
+    diff.maskedPixels = (double)masked / pixelCount;
+    if (compared == 0) return diff;
+    diff.meanError = (double)sum / (compared * 3.0);
+    diff.badPixels = (double)bad / compared;
+    return diff;
+}
@@ -0,0 +1,328 @@
+#include "../Header/SoftwareRenderer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../Header/stb_image.h"
+
+const int SOFT_DISPLAY_WIDTH = 800;
+const int SOFT_DISPLAY_HEIGHT = 600;
+
+// Kao loadImageToTexture: redovi se okrecu, a 1/2/3 kanala se sire kao GL_RED/GL_RG/GL_RGB
+static bool loadTexture(const char* path, SoftTexture& out) {
+    int width, height, channels;
+    unsigned char* data = stbi_load(path, &width, &height, &channels, 0);
+    if (data == NULL) {
+        std::cout << "Textura nije ucitana! Putanja texture: " << path << std::endl;
+        return false;
+    }
+    out.width = width;
+    out.height = height;
+    out.rgba.resize((size_t)width * height * 4);
+    for (int y = 0; y < height; y++) {
+        const unsigned char* src = data + (size_t)(height - 1 - y) * width * channels;
+        uint8_t* dst = &out.rgba[(size_t)y * width * 4];
+        for (int x = 0; x < width; x++) {
+            const unsigned char* t = src + x * channels;
+            dst[x * 4] = t[0];
+            dst[x * 4 + 1] = channels >= 2 ? t[1] : 0;
+            dst[x * 4 + 2] = channels >= 3 ? t[2] : 0;
+            dst[x * 4 + 3] = channels == 4 ? t[3] : 255;
+        }
+    }
+    stbi_image_free(data);
+    return true;
+}
+
+// GPU cita normalu i iz float-a posle poslednjeg temena (pomak 10); van bafera to je 0
+static void padLastNormal(std::vector<float>& vertices) {
+    vertices.push_back(0.0f);
+}
+
+// ========== INICIJALIZACIJA ==========
+bool SoftwareRenderer::init(int width, int height, const SoftSceneSettings& settings, JobSystem* jobs) {
+    scene = settings;
+    this->jobs = jobs;
+    rasterizer.init(jobs);
+    framebuffer.resize(width, height);
+    displayFramebuffer.resize(SOFT_DISPLAY_WIDTH, SOFT_DISPLAY_HEIGHT);
+
+    bool ok = loadTexture("Resource Files/Textures/2d_bus.png", busTexture);
+    ok &= loadTexture("Resource Files/Textures/bus_control.png", controlTexture);
+    ok &= loadTexture("Resource Files/Textures/closed_doors.png", doorClosedTexture);
+    ok &= loadTexture("Resource Files/Textures/opened_doors.png", doorOpenTexture);
+    ok &= loadTexture("Resource Files/Textures/author_text.png", authorTexture);
+    ok &= loadTexture("Resource Files/Textures/passangers_label.png", passengersLabelTexture);
+    ok &= loadTexture("Resource Files/Textures/fines.png", finesLabelTexture);
+    for (int i = 0; i < 10; i++) {
+        std::string path = "Resource Files/Textures/number_" + std::to_string(i) + ".png";
+        ok &= loadTexture(path.c_str(), numberTextures[i]);
+    }
+    if (!ok) return false;
+
+    initStationPositions(stations, NUM_STATIONS);
+    buildPathVertices(stations, NUM_STATIONS, 30, pathVertices);
+    buildCircleVertices(50, circleVertices);
+
+    buildRoadVertices(scene.roadLength, roadVertices);
+    buildStationVertices(stationVertices);
+    buildCabinVertices(cabinVertices);
+    buildHumanoidVariants(passengerMeshes);
+    buildHumanoidTriangles(defaultHumanoidParams(), crowdVertices, crowdBones);
+    buildHumanoidSkeleton(defaultHumanoidParams(), crowdSkeleton);
+
+    for (std::vector<float>* v : { &roadVertices, &stationVertices, &cabinVertices, &crowdVertices,
+                                   &passengerMeshes.vertices }) {
+        padLastNormal(*v);
+    }
+
+    initialized = true;
+    return true;
+}
+
+void SoftwareRenderer::destroy() {
+    initialized = false;
+}
+
+void SoftwareRenderer::setModel(const glm::mat4& model) {
+    state.model = model;
+    rasterizer.setState(state);
+}
+
+// ========== 2D DISPLEJ ==========
+// Isto kao render2DDisplay u Main-u
+void SoftwareRenderer::drawTexture2D(const SoftTexture& texture, float x, float y, float w, float h) {
+    static const float quad[] = {
+        -0.5f, -0.5f,   0.0f, 0.0f,
+         0.5f, -0.5f,   1.0f, 0.0f,
+         0.5f,  0.5f,   1.0f, 1.0f,
+        -0.5f,  0.5f,   0.0f, 1.0f
+    };
+    static const unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
+
+    state.texture = &texture;
+    state.customColor = false;
+    state.alpha = 1.0f;
+    setModel(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(x, y, 0.0f)), glm::vec3(w, h, 1.0f)));
+    rasterizer.drawIndexed2D(quad, indices, 6);
+}
+
+void SoftwareRenderer::drawCircle2D(float x, float y, float radius, const glm::vec3& color) {
+    state.texture = nullptr;
+    state.customColor = true;
+    state.color = color;
+    state.alpha = 1.0f;
+    setModel(glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(x, y, 0.0f)), glm::vec3(radius, radius, 1.0f)));
+    rasterizer.drawFan2D(circleVertices.data(), (int)circleVertices.size() / 2);
+}
+
+void SoftwareRenderer::renderDisplay(const SimSnapshot& snap) {
+    rasterizer.begin(displayFramebuffer);
+    rasterizer.clear(glm::vec4(0.15f, 0.2f, 0.25f, 1.0f));
+
+    state = SoftDrawState();
+    state.lit = false;
+    state.depthTest = false;
+    state.cullBack = snap.faceCullingEnabled;
+    state.customColor = true;
+    state.color = glm::vec3(0.8f, 0.1f, 0.1f);
+    setModel(glm::mat4(1.0f));
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        rasterizer.drawLineStrip2D(&pathVertices[i * 31 * 2], 31, 3.0f);
+    }
+
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        drawCircle2D(stations[i].position.x, stations[i].position.y, 0.06f, glm::vec3(0.8f, 0.1f, 0.1f));
+    }
+    for (int i = 0; i < NUM_STATIONS; i++) {
+        drawTexture2D(numberTextures[i], stations[i].position.x, stations[i].position.y, 0.05f, 0.06f);
+    }
+
+    Vec2 busPos;
+    if (snap.busAtStation) {
+        busPos = stations[snap.currentStation].position;
+    }
+    else {
+        Vec2 p0 = stations[snap.currentStation].position;
+        Vec2 p2 = stations[snap.nextStation].position;
+        busPos = bezierQuadratic(p0, pathControlPoint(p0, p2, snap.currentStation), p2, snap.busProgress);
+    }
+    drawTexture2D(busTexture, busPos.x, busPos.y, 0.15f, 0.08f);
+
+    drawTexture2D(snap.busAtStation ? doorOpenTexture : doorClosedTexture, -0.85f, 0.75f, 0.12f, 0.18f);
+
+    drawTexture2D(passengersLabelTexture, -0.90f, -0.65f, 0.20f, 0.08f);
+    drawTexture2D(numberTextures[snap.passengers / 10], -0.90f, -0.75f, 0.08f, 0.1f);
+    drawTexture2D(numberTextures[snap.passengers % 10], -0.80f, -0.75f, 0.08f, 0.1f);
+
+    drawTexture2D(finesLabelTexture, -0.90f, -0.83f, 0.20f, 0.08f);
+    drawTexture2D(numberTextures[(snap.totalFines / 10) % 10], -0.90f, -0.93f, 0.08f, 0.1f);
+    drawTexture2D(numberTextures[snap.totalFines % 10], -0.80f, -0.93f, 0.08f, 0.1f);
+
+    if (snap.isInspectorInBus) {
+        drawTexture2D(controlTexture, 0.85f, 0.75f, 0.12f, 0.12f);
+    }
+
+    rasterizer.flush();
+    displayFramebuffer.toTexture(displayTexture);
+}
+
+// ========== 3D SCENA ==========
+// Isti redosled agenata kao recordBonePalette u Main-u; poze se racunaju na ovoj niti
+void SoftwareRenderer::evaluateAnimation(const SimSnapshot& snap) {
+    animatedAgents.clear();
+    for (const Passenger& p : snap.activePassengers) {
+        const HumanoidVariant& variant = passengerMeshes.variants[clampHumanoidVariant(p.characterModel)];
+        animatedAgents.push_back({ &variant.skeleton, p.animation });
+    }
+    for (int a = 0; a < snap.crowdCount; a++) {
+        animatedAgents.push_back({ &crowdSkeleton, crowdAnimationState(snap.crowdAnimation[a * 2], snap.crowdAnimation[a * 2 + 1]) });
+    }
+    evaluatePalettes(animatedAgents, jobs, bonePalette);
+}
+
+// Delovi varijante istim redom i bojama kao Main
+void SoftwareRenderer::drawPassenger(const Passenger& p, const glm::mat4& model, const float* palette) {
+    const HumanoidVariant& variant = passengerMeshes.variants[clampHumanoidVariant(p.characterModel)];
+    const float* vertices = passengerMeshes.vertices.data() + (size_t)variant.baseVertex * VERTEX_3D_FLOATS;
+    auto drawPart = [&](HumanoidPart part) {
+        const HumanoidIndexRange& range = variant.parts[part];
+        if (range.count > 0) rasterizer.drawIndexed(vertices, passengerMeshes.indices.data() + range.first, range.count);
+    };
+
+    state.customColor = true;
+    state.color = glm::vec3(1.0f, 0.85f, 0.7f);
+    state.bones = passengerMeshes.bones.data() + variant.baseVertex;
+    state.palette = palette;
+    setModel(model);
+    drawPart(HUMANOID_SKIN);
+
+    state.color = p.shirtColor;
+    rasterizer.setState(state);
+    drawPart(HUMANOID_SHIRT);
+
+    state.color = p.pantsColor;
+    rasterizer.setState(state);
+    drawPart(HUMANOID_LEFT_LEG);
+    drawPart(HUMANOID_RIGHT_LEG);
+
+    state.color = variant.params.cap ? glm::vec3(0.02f, 0.02f, 0.08f) : p.hairColor;
+    rasterizer.setState(state);
+    drawPart(HUMANOID_HEADWEAR);
+
+    state.bones = nullptr;
+    state.palette = nullptr;
+}
+
+void SoftwareRenderer::render(const SimSnapshot& snap) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    renderDisplay(snap);
+    evaluateAnimation(snap);
+
+    rasterizer.begin(framebuffer);
+    rasterizer.clear(scene.clearColor);
+
+    glm::mat4 view = glm::lookAt(scene.cameraPos, scene.cameraPos + snap.cameraFront, scene.cameraUp);
+    float aspect = (float)framebuffer.width / (float)framebuffer.height;
+    glm::mat4 projection = glm::perspective(glm::radians(snap.fov), aspect, scene.zNear, scene.zFar);
+
+    state = SoftDrawState();
+    state.viewProjection = projection * view;
+    state.light = scene.light;
+    state.material = scene.material;
+    state.viewPos = scene.cameraPos;
+    state.depthTest = snap.depthTestEnabled;
+    state.cullBack = snap.faceCullingEnabled;
+
+    // Put
+    setModel(glm::mat4(1.0f));
+    rasterizer.drawQuads(roadVertices.data(), 0, 4);
+
+    // Stanice i guzva na peronima
+    busScene.update(snap, scene.stationDistance);
+    for (int i = 0; i < VISIBLE_STATIONS; i++) {
+        setModel(busScene.station(i));
+        rasterizer.drawQuads(stationVertices.data(), 0, 9);
+    }
+
+    int crowdVertexCount = (int)crowdVertices.size() / VERTEX_3D_FLOATS;
+    size_t crowdPalette = snap.activePassengers.size() * PALETTE_FLOATS_PER_AGENT;
+    state.bones = crowdBones.data();
+    for (int i = 0; i < VISIBLE_STATIONS; i++) {
+        for (int a = 0; a < busScene.crowdSize(); a++) {
+            // Kao INSTANCED u basic3d.vert
+            state.palette = bonePalette.data() + crowdPalette + a * PALETTE_FLOATS_PER_AGENT;
+            setModel(busScene.station(i) * busScene.crowdInstances()[a]);
+            rasterizer.drawTriangles(crowdVertices.data(), crowdVertexCount);
+        }
+    }
+    state.bones = nullptr;
+    state.palette = nullptr;
+
+    // Kabina
+    const glm::mat4& shakeModel = busScene.cabin();
+    panelModel = shakeModel;
+    panelViewProjection = state.viewProjection;
+    setModel(shakeModel);
+    rasterizer.drawQuads(cabinVertices.data(), 0, 11);
+
+    setModel(busScene.wheel());
+    rasterizer.drawQuads(cabinVertices.data(), 11, 1);
+
+    state.texture = &displayTexture;
+    state.transparent = true;
+    setModel(shakeModel);
+    rasterizer.drawQuads(cabinVertices.data(), 12, 1);
+    state.texture = nullptr;
+    state.transparent = false;
+
+    setModel(shakeModel);
+    rasterizer.drawQuads(cabinVertices.data(), 13, 7);
+
+    setModel(busScene.door());
+    rasterizer.drawQuads(cabinVertices.data(), 20, 1);
+
+    setModel(shakeModel);
+    rasterizer.drawQuads(cabinVertices.data(), 21, 2);
+
+    for (size_t i = 0; i < snap.activePassengers.size(); i++) {
+        drawPassenger(snap.activePassengers[i], busScene.passenger(i), bonePalette.data() + i * PALETTE_FLOATS_PER_AGENT);
+    }
+
+    // Potpis autora preko scene, bez depth testa
+    SoftDrawState overlay;
+    overlay.lit = false;
+    overlay.depthTest = false;
+    overlay.cullBack = snap.faceCullingEnabled;
+    state = overlay;
+    drawTexture2D(authorTexture, 0.7f, 0.8f, 0.25f, 0.15f);
+
+    rasterizer.flush();
+    renderMs = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// Ceo obris oba kvadra panela, bez depth testa (i delovi iza volana i putnika)
+void SoftwareRenderer::panelMask(std::vector<uint8_t>& mask) {
+    maskFramebuffer.resize(framebuffer.width, framebuffer.height);
+    rasterizer.begin(maskFramebuffer);
+    rasterizer.clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+
+    state = SoftDrawState();
+    state.lit = false;
+    state.customColor = true;
+    state.depthTest = false;
+    state.viewProjection = panelViewProjection;
+    setModel(panelModel);
+    rasterizer.drawQuads(cabinVertices.data(), 0, 2);
+    rasterizer.flush();
+
+    std::vector<uint8_t> pixels;
+    maskFramebuffer.readPixels(pixels);
+    mask.resize(pixels.size() / 4);
+    for (size_t i = 0; i < mask.size(); i++) mask[i] = pixels[i * 4] != 0 ? 1 : 0;
+}
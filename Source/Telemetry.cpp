@@ -0,0 +1,129 @@
+#include "../Header/Telemetry.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+static const char TELEMETRY_MAGIC[4] = { 'K', 'T', 'E', 'L' };
+static const size_t TELEMETRY_BATCH = 512;
+
+const char* telemetryEventName(uint16_t type) {
+    switch (type) {
+    case TELEMETRY_BOARD: return "board";
+    case TELEMETRY_ALIGHT: return "alight";
+    case TELEMETRY_DEPART: return "depart";
+    case TELEMETRY_ARRIVE: return "arrive";
+    case TELEMETRY_INSPECTOR_BOARD: return "inspector_board";
+    case TELEMETRY_INSPECTOR_EXIT: return "inspector_exit";
+    case TELEMETRY_INSPECTOR_REJECTED: return "inspector_rejected";
+    default: return "unknown";
+    }
+}
+
+std::string telemetrySegmentPath(const std::string& prefix, uint32_t index) {
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), "_%03u.ktl", index);
+    return prefix + suffix;
+}
+
+// ========== UPIS ==========
+TelemetryWriter::~TelemetryWriter() {
+    close();
+}
+
+bool TelemetryWriter::open(const std::string& path, size_t bytesPerSegment, uint32_t keepSegments) {
+    if (isOpen()) return true;
+
+    prefix = path;
+    segmentBytes = bytesPerSegment;
+    maxSegments = keepSegments;
+    segmentIndex = 0;
+    runId = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    if (!openSegment(0)) {
+        return false;
+    }
+
+    running.store(true);
+    writer = std::thread(&TelemetryWriter::writerLoop, this);
+    return true;
+}
+
+void TelemetryWriter::close() {
+    if (!running.exchange(false)) return;
+
+    // Nit isprazni ostatak prstena pre izlaska
+    writer.join();
+    file.close();
+
+    if (dropped.load() > 0) {
+        std::cout << "Telemetrija: odbaceno " << dropped.load() << " dogadjaja (pun prsten)" << std::endl;
+    }
+}
+
+bool TelemetryWriter::openSegment(uint32_t index) {
+    if (file.is_open()) file.close();
+
+    std::string path = telemetrySegmentPath(prefix, index);
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Telemetrija: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+        return false;
+    }
+
+    TelemetrySegmentHeader header;
+    memcpy(header.magic, TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC));
+    header.version = TELEMETRY_VERSION;
+    header.segmentIndex = index;
+    header.recordSize = sizeof(TelemetryEvent);
+    header.runId = runId;
+    file.write((const char*)&header, sizeof(header));
+
+    segmentIndex = index;
+    segmentSize = sizeof(header);
+
+    // Rotacija: brise se najstariji segment van prozora
+    if (maxSegments > 0 && index >= maxSegments) {
+        std::remove(telemetrySegmentPath(prefix, index - maxSegments).c_str());
+    }
+    return true;
+}
+
+void TelemetryWriter::writeBatch(const TelemetryEvent* events, size_t count) {
+    while (count > 0) {
+        if (segmentSize + sizeof(TelemetryEvent) > segmentBytes && segmentSize > sizeof(TelemetrySegmentHeader)) {
+            file.flush();
+            if (!openSegment(segmentIndex + 1)) return;
+        }
+
+        size_t room = segmentSize < segmentBytes ? (segmentBytes - segmentSize) / sizeof(TelemetryEvent) : 0;
+        size_t n = count < room ? count : room;
+        if (n == 0) n = 1;  // Segment manji od jednog zapisa
+
+        file.write((const char*)events, n * sizeof(TelemetryEvent));
+        segmentSize += n * sizeof(TelemetryEvent);
+        written.fetch_add(n, std::memory_order_relaxed);
+        events += n;
+        count -= n;
+    }
+}
+
+void TelemetryWriter::writerLoop() {
+    TelemetryEvent batch[TELEMETRY_BATCH];
+
+    while (true) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        size_t n = ring.popBatch(batch, TELEMETRY_BATCH);
+        if (n > 0) {
+            writeBatch(batch, n);
+            continue;
+        }
+        if (stopping) break;
+
+        // Prsten je prazan - fajl se prazni na disk tek kada nema posla
+        file.flush();
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    file.flush();
+}
@@ -0,0 +1,65 @@
+#include "../Header/TelemetryReader.h"
+
+#include <cstring>
+#include <iostream>
+
+// ========== SEGMENT ==========
+bool TelemetrySegment::open(const std::string& path) {
+    close();
+    if (!file.open(path, true) || file.size() < sizeof(TelemetrySegmentHeader)) {
+        close();
+        return false;
+    }
+
+    const TelemetrySegmentHeader* header = (const TelemetrySegmentHeader*)file.data();
+    if (memcmp(header->magic, "KTEL", 4) != 0 || header->version != TELEMETRY_VERSION ||
+        header->recordSize != sizeof(TelemetryEvent)) {
+        std::cout << "Telemetrija: \"" << path << "\" nije ispravan segment!" << std::endl;
+        close();
+        return false;
+    }
+
+    segmentIndex = header->segmentIndex;
+    runId = header->runId;
+    records = (const TelemetryEvent*)(file.data() + sizeof(TelemetrySegmentHeader));
+    // Nedovrsen poslednji zapis (segment u toku upisa) se ignorise
+    count = (file.size() - sizeof(TelemetrySegmentHeader)) / sizeof(TelemetryEvent);
+    return true;
+}
+
+void TelemetrySegment::close() {
+    file.close();
+    records = nullptr;
+    count = 0;
+}
+
+// ========== CEO DNEVNIK ==========
+bool TelemetryLog::open(const std::string& prefix, uint32_t maxMissing) {
+    segments.clear();
+
+    uint32_t missing = 0;
+    for (uint32_t index = 0; missing <= maxMissing; index++) {
+        TelemetrySegment segment;
+        if (segment.open(telemetrySegmentPath(prefix, index))) {
+            if (segment.index() != index ||
+                (!segments.empty() && segment.run() != segments.front().run())) {
+                if (!segments.empty()) break;  // Ostatak starijeg dnevnika
+                missing++;
+                continue;
+            }
+            segments.push_back(std::move(segment));
+            missing = 0;
+        } else if (!segments.empty()) {
+            break;  // Kraj niza
+        } else {
+            missing++;
+        }
+    }
+    return !segments.empty();
+}
+
+size_t TelemetryLog::totalEvents() const {
+    size_t total = 0;
+    for (const auto& segment : segments) total += segment.size();
+    return total;
+}
@@ -0,0 +1,252 @@
+#include "../Header/TextureStreamer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+#include "../Header/stb_image.h"
+
+// ========== ZIVOTNI CIKLUS ==========
+TextureStreamer::~TextureStreamer() {
+    destroy();
+}
+
+void TextureStreamer::init(GLRenderBackend* backend, size_t budget) {
+    if (initialized) return;
+    renderBackend = backend;
+    frameBudget = budget;
+
+    const uint8_t gray[4] = { 128, 128, 128, 255 };
+    placeholder = renderBackend->createTexture(1, 1, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, gray, GL_NEAREST);
+
+    for (Pbo& p : pbos) {
+        glGenBuffers(1, &p.id);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, p.id);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)frameBudget, NULL, GL_STREAM_DRAW);
+        p.bytes = frameBudget;
+        p.fence = 0;
+        renderBackend->memory().add(GPU_MEMORY_BUFFERS, p.bytes);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    initialized = true;
+    running.store(true);
+    decoder = std::thread(&TextureStreamer::decoderLoop, this);
+}
+
+void TextureStreamer::destroy() {
+    if (!initialized) return;
+    initialized = false;
+
+    running.store(false, std::memory_order_release);
+    decoder.join();
+    // Rezultati koje nit nije stigla da preda
+    DecodeResult result;
+    while (decoded.popBatch(&result, 1) > 0) stbi_image_free(result.pixels);
+
+    for (int i = 0; i < STREAM_MAX_TEXTURES; i++) release(i);
+    for (Pbo& p : pbos) {
+        if (p.fence != 0) glDeleteSync(p.fence);
+        glDeleteBuffers(1, &p.id);
+        renderBackend->memory().remove(GPU_MEMORY_BUFFERS, p.bytes);
+        p = Pbo();
+    }
+    renderBackend->releaseTexture(placeholder);
+    placeholder = RENDER_NONE;
+}
+
+// ========== ZAHTEVI ==========
+int TextureStreamer::request(const std::string& path) {
+    if (!initialized) return -1;
+    for (int i = 0; i < STREAM_MAX_TEXTURES; i++) {
+        Entry& e = entries[i];
+        if (e.state != ENTRY_FREE) continue;
+        // Prsten moze biti pun i kad u tabeli ima mesta: zahtev oslobodjene rucke ostaje u
+        // prstenu dok ga dekoder ne preskoci. Tada se ne zauzima nista i vraca -1.
+        if (!requests.push({ i, e.generation, path })) return -1;
+        e.state = ENTRY_DECODING;
+        e.path = path;
+        e.width = e.height = 0;
+        e.pixels = NULL;
+        e.texture = RENDER_NONE;
+        e.nextRow = 0;
+        e.stripsInFlight = 0;
+        e.frames = 0;
+        return i;
+    }
+    return -1;
+}
+
+void TextureStreamer::release(int handle) {
+    if (handle < 0 || handle >= STREAM_MAX_TEXTURES) return;
+    Entry& e = entries[handle];
+    if (e.state == ENTRY_FREE) return;
+    if (e.texture != RENDER_NONE) renderBackend->releaseTexture(e.texture);
+    stbi_image_free(e.pixels);
+    e.pixels = NULL;
+    e.texture = RENDER_NONE;
+    e.state = ENTRY_FREE;
+    // Dekodiranje ili trake u letu za staru generaciju se odbacuju
+    e.generation++;
+}
+
+uint32_t TextureStreamer::texture(int handle) const {
+    if (handle < 0 || handle >= STREAM_MAX_TEXTURES || entries[handle].state != ENTRY_READY) return placeholder;
+    return entries[handle].texture;
+}
+
+bool TextureStreamer::isReady(int handle) const {
+    return handle >= 0 && handle < STREAM_MAX_TEXTURES && entries[handle].state == ENTRY_READY;
+}
+
+int TextureStreamer::pendingCount() const {
+    int count = 0;
+    for (const Entry& e : entries) {
+        if (e.state == ENTRY_DECODING || e.state == ENTRY_UPLOADING) count++;
+    }
+    return count;
+}
+
+// ========== POZADINSKA NIT ==========
+void TextureStreamer::decoderLoop() {
+    while (running.load(std::memory_order_acquire)) {
+        DecodeRequest req;
+        if (requests.popBatch(&req, 1) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        DecodeResult result = { req.entry, req.generation, 0, 0, NULL };
+        int channels;
+        result.pixels = stbi_load(req.path.c_str(), &result.width, &result.height, &channels, 4);
+        if (result.pixels != NULL) {
+            // Kao loadImageToTexture: red 0 je dole
+            size_t rowBytes = (size_t)result.width * 4;
+            for (int y = 0; y < result.height / 2; y++) {
+                uint8_t* a = result.pixels + (size_t)y * rowBytes;
+                uint8_t* b = result.pixels + (size_t)(result.height - 1 - y) * rowBytes;
+                std::swap_ranges(a, a + rowBytes, b);
+            }
+        }
+        while (!decoded.push(result)) {
+            if (!running.load(std::memory_order_acquire)) {
+                stbi_image_free(result.pixels);
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+// ========== GLAVNA NIT ==========
+void TextureStreamer::receiveDecoded() {
+    DecodeResult result;
+    while (decoded.popBatch(&result, 1) > 0) {
+        Entry& e = entries[result.entry];
+        if (e.state != ENTRY_DECODING || e.generation != result.generation) {
+            stbi_image_free(result.pixels);
+            continue;
+        }
+        if (result.pixels == NULL) {
+            std::cout << "Textura nije ucitana! Putanja texture: " << e.path << std::endl;
+            e.state = ENTRY_FAILED;
+            continue;
+        }
+        // Skladiste bez sadrzaja; trake ga pune u narednim frejmovima
+        e.width = result.width;
+        e.height = result.height;
+        e.pixels = result.pixels;
+        e.texture = renderBackend->createTexture(e.width, e.height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, NULL, GL_LINEAR);
+        e.state = ENTRY_UPLOADING;
+    }
+}
+
+void TextureStreamer::retireStrips() {
+    for (Pbo& p : pbos) {
+        if (p.fence == 0) continue;
+        GLenum status = glClientWaitSync(p.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) continue;
+        glDeleteSync(p.fence);
+        p.fence = 0;
+
+        Entry& e = entries[p.entry];
+        if (e.state != ENTRY_UPLOADING || e.generation != p.generation) continue;
+        e.stripsInFlight--;
+        if (e.nextRow == e.height && e.stripsInFlight == 0) {
+            stbi_image_free(e.pixels);
+            e.pixels = NULL;
+            e.state = ENTRY_READY;
+            std::cout << "Tekstura " << e.path << ": " << e.width << "x" << e.height
+                      << ", stigla za " << e.frames << " frejmova" << std::endl;
+        }
+    }
+}
+
+void TextureStreamer::uploadStrip(Pbo& pbo, Entry& entry, int entryIndex, int rows) {
+    size_t rowBytes = (size_t)entry.width * 4;
+    size_t bytes = (size_t)rows * rowBytes;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.id);
+    if (bytes > pbo.bytes) {
+        // Red siri od budzeta - PBO raste i ostaje veci
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)bytes, NULL, GL_STREAM_DRAW);
+        renderBackend->memory().resize(GPU_MEMORY_BUFFERS, pbo.bytes, bytes);
+        pbo.bytes = bytes;
+    }
+    void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (dst != NULL) {
+        memcpy(dst, entry.pixels + (size_t)entry.nextRow * rowBytes, bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        bindTexture(GL_TEXTURE_2D, renderBackend->glTexture(entry.texture));
+        texSubImage2D(GL_TEXTURE_2D, 0, entry.nextRow, entry.width, rows, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)0);
+        bindTexture(GL_TEXTURE_2D, 0);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (dst == NULL) {
+        // Traka ce se poslati ponovo u sledecem frejmu
+        return;
+    }
+
+    pbo.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    pbo.entry = entryIndex;
+    pbo.generation = entry.generation;
+    entry.nextRow += rows;
+    entry.stripsInFlight++;
+    uploaded += bytes;
+}
+
+void TextureStreamer::update() {
+    if (!initialized) return;
+    receiveDecoded();
+    retireStrips();
+
+    for (Entry& e : entries) {
+        if (e.state == ENTRY_UPLOADING) e.frames++;
+    }
+
+    // Slike se salju redom iz tabele; svaka traka ide u slobodan PBO
+    size_t sent = 0;
+    int current = 0;
+    for (Pbo& p : pbos) {
+        if (p.fence != 0) continue;
+        while (current < STREAM_MAX_TEXTURES &&
+               (entries[current].state != ENTRY_UPLOADING || entries[current].nextRow == entries[current].height)) {
+            current++;
+        }
+        if (current == STREAM_MAX_TEXTURES) break;
+
+        Entry& e = entries[current];
+        size_t rowBytes = (size_t)e.width * 4;
+        int rows = (int)((frameBudget - sent) / rowBytes);
+        if (rows == 0) {
+            if (sent > 0) break;
+            rows = 1;
+        }
+        rows = std::min(rows, e.height - e.nextRow);
+        uploadStrip(p, e, current, rows);
+        sent += (size_t)rows * rowBytes;
+        if (sent >= frameBudget) break;
+    }
+}
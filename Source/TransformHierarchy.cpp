@@ -0,0 +1,50 @@
+#include "../Header/TransformHierarchy.h"
+
+// ========== CVOROVI ==========
+void TransformHierarchy::clear() {
+    parents.clear();
+    localMatrices.clear();
+    worldMatrices.clear();
+    dirtyFlags.clear();
+    changedFlags.clear();
+}
+
+int TransformHierarchy::add(int parent, const glm::mat4& local) {
+    int node = size();
+    parents.push_back(parent < node ? parent : -1);
+    localMatrices.push_back(local);
+    worldMatrices.push_back(local);
+    dirtyFlags.push_back(1);
+    changedFlags.push_back(0);
+    return node;
+}
+
+void TransformHierarchy::setLocal(int node, const glm::mat4& local) {
+    if (localMatrices[node] == local) return;
+    localMatrices[node] = local;
+    dirtyFlags[node] = 1;
+}
+
+// ========== AZURIRANJE ==========
+// Roditelj je uvek vec obradjen, pa je njegov changed flag za ovaj update vec postavljen
+int TransformHierarchy::update() {
+    int recomputed = 0;
+    for (int node = 0; node < size(); node++) {
+        int parent = parents[node];
+        bool recompute = dirtyFlags[node] || (parent >= 0 && changedFlags[parent]);
+        changedFlags[node] = recompute ? 1 : 0;
+        if (!recompute) continue;
+
+        worldMatrices[node] = parent < 0 ? localMatrices[node] : worldMatrices[parent] * localMatrices[node];
+        dirtyFlags[node] = 0;
+        recomputed++;
+    }
+    return recomputed;
+}
+
+bool TransformHierarchy::anyChanged(int first, int count) const {
+    for (int node = first; node < first + count; node++) {
+        if (changedFlags[node]) return true;
+    }
+    return false;
+}
@@ -1,4 +1,5 @@
 #include "../Header/Util.h";
+#include "../Header/GLStats.h"
 
 #define _CRT_SECURE_NO_WARNINGS
 #include <fstream>
@@ -18,7 +19,7 @@ int endProgram(std::string message) {
     return -1;
 }
 
-unsigned int compileShader(GLenum type, const char* source)
+unsigned int compileShader(GLenum type, const char* source, const char* defines)
 {
     //Uzima kod u fajlu na putanji "source", kompajlira ga i vraca sejder tipa "type"
     //Citanje izvornog koda iz fajla
@@ -36,6 +37,15 @@ unsigned int compileShader(GLenum type, const char* source)
         std::cout << "Greska pri citanju fajla sa putanje \"" << source << "\"!" << std::endl;
     }
     std::string temp = ss.str();
+
+    //Preambula sa #define-ovima ide odmah posle #version linije (ona mora biti prva)
+    if (defines != NULL && defines[0] != '\0')
+    {
+        size_t versionLine = temp.find("#version");
+        size_t insertAt = versionLine == std::string::npos ? 0 : temp.find('\n', versionLine);
+        insertAt = insertAt == std::string::npos ? temp.size() : insertAt + 1;
+        temp.insert(insertAt, defines);
+    }
     const char* sourceCode = temp.c_str(); //Izvorni kod sejdera koji citamo iz fajla na putanji "source"
 
     int shader = glCreateShader(type); //Napravimo prazan sejder odredjenog tipa (vertex ili fragment)
@@ -58,7 +68,7 @@ unsigned int compileShader(GLenum type, const char* source)
     }
     return shader;
 }
-unsigned int createShader(const char* vsSource, const char* fsSource)
+unsigned int createShader(const char* vsSource, const char* fsSource, const char* defines)
 {
     //Pravi objedinjeni sejder program koji se sastoji od Vertex sejdera ciji je kod na putanji vsSource
 
@@ -68,13 +78,17 @@ unsigned int createShader(const char* vsSource, const char* fsSource)
 
     program = glCreateProgram(); //Napravi prazan objedinjeni sejder program
 
-    vertexShader = compileShader(GL_VERTEX_SHADER, vsSource); //Napravi i kompajliraj vertex sejder
-    fragmentShader = compileShader(GL_FRAGMENT_SHADER, fsSource); //Napravi i kompajliraj fragment sejder
+    vertexShader = compileShader(GL_VERTEX_SHADER, vsSource, defines); //Napravi i kompajliraj vertex sejder
+    fragmentShader = compileShader(GL_FRAGMENT_SHADER, fsSource, defines); //Napravi i kompajliraj fragment sejder
 
     //Zakaci verteks i fragment sejdere za objedinjeni program
     glAttachShader(program, vertexShader);
     glAttachShader(program, fragmentShader);
 
+    //Dozvoli citanje binarnog oblika programa (kes prevedenih varijanti), ako drajver to podrzava
+    if (GLEW_ARB_get_program_binary)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
     glLinkProgram(program); //Povezi ih u jedan objedinjeni sejder program
     glValidateProgram(program); //Izvrsi provjeru novopecenog programa
 
@@ -119,9 +133,9 @@ unsigned loadImageToTexture(const char* filePath) {
 
         unsigned int Texture;
         glGenTextures(1, &Texture);
-        glBindTexture(GL_TEXTURE_2D, Texture);
-        glTexImage2D(GL_TEXTURE_2D, 0, InternalFormat, TextureWidth, TextureHeight, 0, InternalFormat, GL_UNSIGNED_BYTE, ImageData);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        bindTexture(GL_TEXTURE_2D, Texture);
+        texImage2D(GL_TEXTURE_2D, InternalFormat, TextureWidth, TextureHeight, InternalFormat, GL_UNSIGNED_BYTE, ImageData);
+        bindTexture(GL_TEXTURE_2D, 0);
         // oslobadjanje memorije zauzete sa stbi_load posto vise nije potrebna
         stbi_image_free(ImageData);
         return Texture;
@@ -0,0 +1,450 @@
+#include "../Header/VideoRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+// ========== PNG ==========
+// Deflate sa fiksnim Huffman kodovima i LZ77 (hes poslednje pozicije za 3 bajta), bez
+// zlib-a. Redovi se filtriraju sa Sub ili Up (manji zbir), pa jednobojne povrsine
+// postaju nizovi nula koje LZ77 sabija.
+static const uint16_t LENGTH_BASE[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                          35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t LENGTH_EXTRA[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                          3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DISTANCE_BASE[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+                                            513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t DISTANCE_EXTRA[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+                                            8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+struct BitWriter {
+    std::vector<uint8_t>& out;
+    uint32_t bits = 0;
+    int count = 0;
+
+    explicit BitWriter(std::vector<uint8_t>& target) : out(target) {}
+
+    // Deflate pakuje od najnizeg bita
+    void put(uint32_t value, int n) {
+        bits |= value << count;
+        count += n;
+        while (count >= 8) {
+            out.push_back((uint8_t)bits);
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+    // Huffman kodovi idu od najviseg bita
+    void putCode(uint32_t code, int n) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; i++) reversed |= ((code >> i) & 1u) << (n - 1 - i);
+        put(reversed, n);
+    }
+    void flush() {
+        if (count > 0) out.push_back((uint8_t)bits);
+        bits = 0;
+        count = 0;
+    }
+};
+
+static void putSymbol(BitWriter& w, int symbol) {
+    if (symbol < 144) w.putCode(0x30 + symbol, 8);
+    else if (symbol < 256) w.putCode(0x190 + symbol - 144, 9);
+    else if (symbol < 280) w.putCode(symbol - 256, 7);
+    else w.putCode(0xc0 + symbol - 280, 8);
+}
+
+static void putMatch(BitWriter& w, int length, int distance) {
+    int l = 28;
+    while (LENGTH_BASE[l] > length) l--;
+    putSymbol(w, 257 + l);
+    w.put(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+    int d = 29;
+    while (DISTANCE_BASE[d] > distance) d--;
+    w.putCode(d, 5);
+    w.put(distance - DISTANCE_BASE[d], DISTANCE_EXTRA[d]);
+}
+
+static uint32_t adler32(const uint8_t* data, size_t n) {
+    uint32_t a = 1, b = 0;
+    while (n > 0) {
+        size_t chunk = std::min(n, (size_t)5552);   // Najvise bez prekoracenja pre modula
+        for (size_t i = 0; i < chunk; i++) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+        data += chunk;
+        n -= chunk;
+    }
+    return (b << 16) | a;
+}
+
+// zlib tok: zaglavlje, jedan deflate blok sa fiksnim kodovima, Adler-32
+static void deflate(const std::vector<uint8_t>& data, std::vector<uint8_t>& out) {
+    const int HASH_BITS = 15;
+    const size_t WINDOW = 32768;
+    std::vector<int32_t> head((size_t)1 << HASH_BITS, -1);
+
+    out.clear();
+    out.push_back(0x78);
+    out.push_back(0x01);
+    BitWriter w(out);
+    w.put(1, 1);    // Poslednji blok
+    w.put(1, 2);    // Fiksni Huffman kodovi
+
+    const size_t n = data.size();
+    size_t i = 0;
+    while (i < n) {
+        int length = 0;
+        size_t distance = 0;
+        if (i + 3 <= n) {
+            uint32_t key = (uint32_t)data[i] << 16 | (uint32_t)data[i + 1] << 8 | data[i + 2];
+            uint32_t h = (key * 2654435761u) >> (32 - HASH_BITS);
+            int32_t candidate = head[h];
+            head[h] = (int32_t)i;
+            if (candidate >= 0 && i - candidate <= WINDOW) {
+                size_t limit = std::min((size_t)258, n - i);
+                size_t len = 0;
+                while (len < limit && data[candidate + len] == data[i + len]) len++;
+                if (len >= 3) {
+                    length = (int)len;
+                    distance = i - candidate;
+                }
+            }
+        }
+        if (length > 0) {
+            putMatch(w, length, (int)distance);
+            i += length;
+        } else {
+            putSymbol(w, data[i]);
+            i++;
+        }
+    }
+    putSymbol(w, 256);
+    w.flush();
+
+    uint32_t adler = adler32(data.data(), n);
+    for (int s = 24; s >= 0; s -= 8) out.push_back((uint8_t)(adler >> s));
+}
+
+static uint32_t crc32(const uint8_t* data, size_t n, uint32_t crc = 0) {
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+        tableReady = true;
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < n; i++) crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void writeChunk(std::ofstream& file, const char* type, const std::vector<uint8_t>& data) {
+    uint8_t header[8];
+    uint32_t size = (uint32_t)data.size();
+    for (int i = 0; i < 4; i++) header[i] = (uint8_t)(size >> (24 - 8 * i));
+    memcpy(header + 4, type, 4);
+    uint32_t crc = crc32(header + 4, 4);
+    crc = crc32(data.data(), data.size(), crc);
+    uint8_t tail[4];
+    for (int i = 0; i < 4; i++) tail[i] = (uint8_t)(crc >> (24 - 8 * i));
+    file.write((const char*)header, 8);
+    file.write((const char*)data.data(), data.size());
+    file.write((const char*)tail, 4);
+}
+
+// RGB PNG iz BGRA; red 0 je dole (kao glReadPixels)
+static bool writePNG(const std::string& path, int width, int height, const uint8_t* bgra,
+                     std::vector<uint8_t>& filtered, std::vector<uint8_t>& compressed) {
+    const size_t stride = (size_t)width * 3;
+    filtered.resize((stride + 1) * height);
+    std::vector<uint8_t> row(stride), previous(stride, 0), sub(stride), up(stride);
+    for (int y = 0; y < height; y++) {
+        const uint8_t* src = bgra + (size_t)(height - 1 - y) * width * 4;
+        for (int x = 0; x < width; x++) {
+            row[x * 3] = src[x * 4 + 2];
+            row[x * 3 + 1] = src[x * 4 + 1];
+            row[x * 3 + 2] = src[x * 4];
+        }
+        uint32_t subSum = 0, upSum = 0;
+        for (size_t i = 0; i < stride; i++) {
+            sub[i] = (uint8_t)(row[i] - (i >= 3 ? row[i - 3] : 0));
+            up[i] = (uint8_t)(row[i] - previous[i]);
+            subSum += std::min<uint32_t>(sub[i], 256 - sub[i]);
+            upSum += std::min<uint32_t>(up[i], 256 - up[i]);
+        }
+        uint8_t* dst = &filtered[(stride + 1) * y];
+        bool useSub = subSum <= upSum;
+        dst[0] = useSub ? 1 : 2;
+        memcpy(dst + 1, useSub ? sub.data() : up.data(), stride);
+        previous.swap(row);
+    }
+    deflate(filtered, compressed);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    static const uint8_t SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    file.write((const char*)SIGNATURE, 8);
+    std::vector<uint8_t> ihdr(13, 0);
+    for (int i = 0; i < 4; i++) {
+        ihdr[i] = (uint8_t)(width >> (24 - 8 * i));
+        ihdr[4 + i] = (uint8_t)(height >> (24 - 8 * i));
+    }
+    ihdr[8] = 8;    // Bita po kanalu
+    ihdr[9] = 2;    // RGB
+    writeChunk(file, "IHDR", ihdr);
+    writeChunk(file, "IDAT", compressed);
+    writeChunk(file, "IEND", std::vector<uint8_t>());
+    return (bool)file;
+}
+
+// ========== Y4M ==========
+// BT.601 ogranicen opseg; hroma je prosek bloka 2x2
+static void bgraToI420(const uint8_t* bgra, int width, int height, std::vector<uint8_t>& out) {
+    int chromaW = (width + 1) / 2, chromaH = (height + 1) / 2;
+    out.resize((size_t)width * height + 2 * (size_t)chromaW * chromaH);
+    uint8_t* yPlane = out.data();
+    uint8_t* uPlane = yPlane + (size_t)width * height;
+    uint8_t* vPlane = uPlane + (size_t)chromaW * chromaH;
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t* src = bgra + (size_t)(height - 1 - y) * width * 4;
+        uint8_t* dst = yPlane + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            int b = src[x * 4], g = src[x * 4 + 1], r = src[x * 4 + 2];
+            dst[x] = (uint8_t)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        }
+    }
+    for (int cy = 0; cy < chromaH; cy++) {
+        for (int cx = 0; cx < chromaW; cx++) {
+            int r = 0, g = 0, b = 0, count = 0;
+            for (int dy = 0; dy < 2; dy++) {
+                int y = std::min(cy * 2 + dy, height - 1);
+                const uint8_t* src = bgra + (size_t)(height - 1 - y) * width * 4;
+                for (int dx = 0; dx < 2; dx++) {
+                    int x = std::min(cx * 2 + dx, width - 1);
+                    b += src[x * 4];
+                    g += src[x * 4 + 1];
+                    r += src[x * 4 + 2];
+                    count++;
+                }
+            }
+            r /= count;
+            g /= count;
+            b /= count;
+            uPlane[(size_t)cy * chromaW + cx] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            vPlane[(size_t)cy * chromaW + cx] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+}
+
+// ========== ZIVOTNI CIKLUS ==========
+static bool endsWith(const std::string& s, const char* suffix) {
+    size_t n = strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+VideoRecorder::~VideoRecorder() {
+    close();
+}
+
+bool VideoRecorder::open(const std::string& outputPath, int frameWidth, int frameHeight, int fps, GpuMemory* gpuMemory) {
+    if (opened) return true;
+
+    path = outputPath;
+    width = frameWidth;
+    height = frameHeight;
+    frameBytes = (size_t)width * height * 4;
+    if (endsWith(path, ".y4m")) format = VIDEO_Y4M;
+    else if (endsWith(path, ".raw")) format = VIDEO_RAW;
+    else {
+        format = VIDEO_PNG;
+        if (endsWith(path, ".png")) path.resize(path.size() - 4);
+    }
+
+    if (format != VIDEO_PNG) {
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cout << "Video: ne mogu da otvorim \"" << path << "\"!" << std::endl;
+            return false;
+        }
+        if (format == VIDEO_Y4M) {
+            char header[96];
+            snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps);
+            file << header;
+        }
+    }
+
+    for (Slot& s : slots) {
+        glGenBuffers(1, &s.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)frameBytes, NULL, GL_STREAM_READ);
+        s.fence = 0;
+        s.state = SLOT_FREE;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    memory = gpuMemory;
+    if (memory != nullptr) {
+        for (int i = 0; i < VIDEO_PBO_COUNT; i++) memory->add(GPU_MEMORY_BUFFERS, frameBytes);
+    }
+
+    next = oldestReading = reading = mapped = 0;
+    frameIndex = captured = dropped = written = 0;
+
+    opened = true;
+    running.store(true);
+    writer = std::thread(&VideoRecorder::writerLoop, this);
+
+    static const char* const FORMAT_NAMES[] = { "Y4M", "BGRA", "PNG" };
+    std::cout << "Video: " << width << "x" << height << " " << FORMAT_NAMES[format] << " -> " << path
+              << (format == VIDEO_PNG ? "_NNNNNN.png" : "") << std::endl;
+    return true;
+}
+
+void VideoRecorder::close() {
+    if (!opened) return;
+    opened = false;
+
+    collect(true);
+    running.store(false, std::memory_order_release);
+    writer.join();
+    if (file.is_open()) file.close();
+
+    for (Slot& s : slots) {
+        glDeleteBuffers(1, &s.pbo);
+        s = Slot();
+        if (memory != nullptr) memory->remove(GPU_MEMORY_BUFFERS, frameBytes);
+    }
+
+    std::cout << "Video: " << written << " frejmova -> " << path << (format == VIDEO_PNG ? "_NNNNNN.png" : "");
+    if (dropped > 0) std::cout << ", odbaceno " << dropped << " (nit za upis ne stize)";
+    std::cout << std::endl;
+}
+
+// ========== GLAVNA NIT ==========
+void VideoRecorder::captureFrame(GLuint framebuffer) {
+    if (!opened) return;
+    collect(false);
+
+    uint64_t frame = frameIndex++;
+    Slot& s = slots[next];
+    if (s.state != SLOT_FREE) {
+        dropped++;
+        return;
+    }
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pbo);
+    glReadPixels(0, 0, width, height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    s.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    s.frame = frame;
+    s.state = SLOT_READING;
+    next = (next + 1) % VIDEO_PBO_COUNT;
+    reading++;
+    captured++;
+}
+
+void VideoRecorder::poll() {
+    if (opened) collect(false);
+}
+
+void VideoRecorder::unmapReturned() {
+    int slot;
+    while (doneSlots.popBatch(&slot, 1) > 0) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slots[slot].pbo);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        slots[slot].state = SLOT_FREE;
+        mapped--;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void VideoRecorder::collect(bool wait) {
+    unmapReturned();
+
+    // Slotovi se citaju i mapiraju redom kojim su zapoceti
+    while (reading > 0) {
+        Slot& s = slots[oldestReading];
+        GLuint64 timeout = wait ? 1000000000ull : 0;   // 1 s pri zatvaranju
+        GLenum status = glClientWaitSync(s.fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        bool done = status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+        if (!done && !wait) return;
+
+        glDeleteSync(s.fence);
+        s.fence = 0;
+        oldestReading = (oldestReading + 1) % VIDEO_PBO_COUNT;
+        reading--;
+
+        const void* pixels = NULL;
+        if (done) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, s.pbo);
+            pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)frameBytes, GL_MAP_READ_BIT);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        if (pixels == NULL) {
+            // GPU nije zavrsio ni za 1 s ili mapiranje nije uspelo
+            s.state = SLOT_FREE;
+            dropped++;
+            continue;
+        }
+        s.state = SLOT_MAPPED;
+        mapped++;
+        int slot = (int)(&s - slots);
+        ready.push({ slot, s.frame, (const uint8_t*)pixels });
+    }
+
+    while (wait && mapped > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        unmapReturned();
+    }
+}
+
+// ========== POZADINSKA NIT ==========
+void VideoRecorder::writerLoop() {
+    while (true) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        Job job;
+        if (ready.popBatch(&job, 1) > 0) {
+            writeFrame(job);
+            doneSlots.push(job.slot);
+            continue;
+        }
+        if (stopping) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (file.is_open()) file.flush();
+}
+
+void VideoRecorder::writeFrame(const Job& job) {
+    switch (format) {
+    case VIDEO_Y4M:
+        bgraToI420(job.pixels, width, height, scratch);
+        file << "FRAME\n";
+        file.write((const char*)scratch.data(), scratch.size());
+        break;
+    case VIDEO_RAW:
+        for (int y = height - 1; y >= 0; y--) {
+            file.write((const char*)job.pixels + (size_t)y * width * 4, (size_t)width * 4);
+        }
+        break;
+    case VIDEO_PNG: {
+        char suffix[16];
+        snprintf(suffix, sizeof(suffix), "_%06llu.png", (unsigned long long)job.frame);
+        if (!writePNG(path + suffix, width, height, job.pixels, scratch, compressed)) {
+            std::cout << "Video: ne mogu da upisem \"" << path << suffix << "\"!" << std::endl;
+            return;
+        }
+        break;
+    }
+    }
+    written++;
+}
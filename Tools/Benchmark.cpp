@@ -0,0 +1,454 @@
+// ========== MIKROBENCHMARK ==========
+// Merenje vrucih putanja simulacije i geometrije bez OpenGL konteksta.
+// Svaki benchmark se kalibrise (broj iteracija po uzorku), pa se meri zadati broj uzoraka;
+// izlaz je JSON sa medijanom, p99 i MAD (medijana apsolutnih odstupanja od medijane) u ns po operaciji,
+// da bi se rezultati mogli porediti izmedju commit-ova.
+//
+// Prevodjenje (iz korena repozitorijuma):
+//   g++ -O2 -std=c++14 -Ipackages/glm.1.0.3/build/native/include Tools/Benchmark.cpp
+//       Source/BusSimulation.cpp Source/SeatMap.cpp Source/CrowdSim.cpp Source/Telemetry.cpp
+//       Source/Geometry.cpp Source/LightGrid.cpp Source/SkeletalAnimation.cpp Source/JobSystem.cpp
+//       Source/NavGrid.cpp Source/TransformHierarchy.cpp Source/Checkpoint.cpp Source/MappedFile.cpp
+//       -pthread -o benchmark
+//
+// Primer:
+//   benchmark --samples 51 --out bench.json
+//   benchmark --filter passengers
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Header/stb_image.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../Header/BusSimulation.h"
+#include "../Header/Checkpoint.h"
+#include "../Header/CrowdSim.h"
+#include "../Header/Geometry.h"
+#include "../Header/JobSystem.h"
+#include "../Header/LightGrid.h"
+#include "../Header/NavGrid.h"
+#include "../Header/Random.h"
+#include "../Header/SkeletalAnimation.h"
+#include "../Header/TransformHierarchy.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+typedef std::chrono::steady_clock BenchClock;
+
+// Sprecava da kompajler izbaci racunanje ciji se rezultat ne koristi
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#ifdef _MSC_VER
+    static const void* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+struct BenchResult {
+    std::string name;
+    uint64_t itemsPerOp;        // Koliko elemenata (agenata, tacaka...) obradi jedna operacija
+    uint64_t iterations;        // Operacija po uzorku
+    std::vector<double> samples; // ns po operaciji
+    double median, p99, mad, mean, minimum;
+};
+
+struct BenchOptions {
+    int samples = 31;
+    double targetSampleMs = 5.0;
+    std::string filter;
+};
+
+static double medianOf(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    size_t n = values.size();
+    return (n % 2 == 1) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+static void summarize(BenchResult& r) {
+    std::vector<double> sorted = r.samples;
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+
+    r.median = medianOf(sorted);
+    size_t p99Index = (size_t)std::ceil(0.99 * n);
+    r.p99 = sorted[p99Index > 0 ? p99Index - 1 : 0];
+    r.minimum = sorted[0];
+
+    double sum = 0.0;
+    std::vector<double> deviations(n);
+    for (size_t i = 0; i < n; i++) {
+        sum += sorted[i];
+        deviations[i] = std::fabs(sorted[i] - r.median);
+    }
+    r.mean = sum / n;
+    r.mad = medianOf(deviations);
+}
+
+// setup - poziva se pre svakog uzorka (ne meri se), body - jedna operacija
+// maxIterations ogranicava uzorak za benchmark-e cije stanje evoluira (npr. putnici stignu do mesta)
+static void runBenchmark(const BenchOptions& options, std::vector<BenchResult>& results,
+                         const std::string& name, uint64_t itemsPerOp,
+                         const std::function<void()>& setup, const std::function<void()>& body,
+                         uint64_t maxIterations = 0) {
+    if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+
+    // Kalibracija: udvostrucava broj iteracija dok uzorak ne traje targetSampleMs
+    uint64_t iterations = 1;
+    while (true) {
+        setup();
+        auto start = BenchClock::now();
+        for (uint64_t i = 0; i < iterations; i++) body();
+        double ms = std::chrono::duration<double, std::milli>(BenchClock::now() - start).count();
+        if (ms >= options.targetSampleMs || (maxIterations > 0 && iterations >= maxIterations)) break;
+        uint64_t grow = (ms > 0.01) ? (uint64_t)(iterations * options.targetSampleMs / ms) : iterations * 10;
+        iterations = std::max(iterations * 2, std::min(grow, iterations * 100));
+        if (maxIterations > 0) iterations = std::min(iterations, maxIterations);
+    }
+
+    BenchResult r;
+    r.name = name;
+    r.itemsPerOp = itemsPerOp;
+    r.iterations = iterations;
+
+    // Zagrevanje pa merenje
+    setup();
+    for (uint64_t i = 0; i < iterations; i++) body();
+    for (int s = 0; s < options.samples; s++) {
+        setup();
+        auto start = BenchClock::now();
+        for (uint64_t i = 0; i < iterations; i++) body();
+        double ns = std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+        r.samples.push_back(ns / iterations);
+    }
+
+    summarize(r);
+    fprintf(stderr, "%-36s median %12.1f ns  p99 %12.1f ns  MAD %9.1f ns  (%llu it x %d)\n",
+            name.c_str(), r.median, r.p99, r.mad, (unsigned long long)iterations, options.samples);
+    results.push_back(r);
+}
+
+// ========== PODACI ZA BENCHMARK ==========
+// Putnici u svim fazama kretanja (ulazak, hodanje do mesta, izlazak), deterministicki iz seed-a.
+// Svaka putanja ima bar 2 tacke, pa su indeksi -1..1 uvek ispravni.
+static std::vector<Passenger> makePassengers(int count, uint64_t seed) {
+    SeatLayout layout = makeSoloBusLayout();
+    Pcg32 rng(seed);
+
+    std::vector<Passenger> out(count);
+    for (int i = 0; i < count; i++) {
+        Passenger& p = out[i];
+        p.seatIndex = (int)rng.nextBelow((uint32_t)layout.places.size());
+        p.exiting = rng.nextBelow(2) == 1;
+        p.waypointIndex = p.exiting ? (int)rng.nextBelow(3) - 1 : (int)rng.nextBelow(2);
+        p.finalPosition = layout.places[p.seatIndex].position;
+        p.position = glm::vec3(rng.range(-1.0f, 1.2f), -0.3f, rng.range(-0.3f, 0.15f));
+        p.targetPosition = glm::vec3(rng.range(-1.0f, 1.2f), -0.3f, rng.range(-0.3f, 0.15f));
+        p.moveSpeed = 1.2f;
+        p.isMoving = true;
+        p.animation.clip = CLIP_WALK;
+        p.animation.time = rng.range(0.0f, 6.28f);
+        p.isInspector = false;
+    }
+    return out;
+}
+
+static bool readFile(const std::string& path, std::vector<unsigned char>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static void writeJson(std::ostream& os, const std::vector<BenchResult>& results, const BenchOptions& options) {
+    os << "{\n  \"samples\": " << options.samples << ",\n  \"unit\": \"ns\",\n  \"benchmarks\": [\n";
+    char line[512];
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        snprintf(line, sizeof(line),
+                 "    {\"name\": \"%s\", \"items_per_op\": %llu, \"iterations\": %llu, "
+                 "\"median\": %.2f, \"p99\": %.2f, \"mad\": %.2f, \"mean\": %.2f, \"min\": %.2f, "
+                 "\"median_per_item\": %.3f}%s\n",
+                 r.name.c_str(), (unsigned long long)r.itemsPerOp, (unsigned long long)r.iterations,
+                 r.median, r.p99, r.mad, r.mean, r.minimum,
+                 r.median / (double)r.itemsPerOp, (i + 1 < results.size()) ? "," : "");
+        os << line;
+    }
+    os << "  ]\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    std::string outPath;
+    std::string texturesDir = "Resource Files/Textures";
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--samples" && i + 1 < argc) options.samples = std::max(1, atoi(argv[++i]));
+        else if (arg == "--sample-ms" && i + 1 < argc) options.targetSampleMs = atof(argv[++i]);
+        else if (arg == "--filter" && i + 1 < argc) options.filter = argv[++i];
+        else if (arg == "--out" && i + 1 < argc) outPath = argv[++i];
+        else if (arg == "--textures" && i + 1 < argc) texturesDir = argv[++i];
+        else {
+            std::cout << "Upotreba: benchmark [--samples N] [--sample-ms MS] [--filter TEKST] [--out FAJL] [--textures DIR]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<BenchResult> results;
+    const float dt = 1.0f / 75.0f;
+
+    // ===== updatePassengers =====
+    // Stanje se vraca na pocetno pre svakog uzorka; uzorak je najvise 60 koraka (< 1 s simulacije),
+    // da putnici ne bi svi stigli do mesta i merili samo mirovanje.
+    const int passengerCounts[] = { 50, 1000, 100000 };
+    for (int count : passengerCounts) {
+        BusSimulation sim;
+        sim.crowdEnabled = false;
+        sim.logToConsole = false;
+        std::vector<Passenger> initial = makePassengers(count, 1234);
+        runBenchmark(options, results, "updatePassengers/" + std::to_string(count), count,
+                     [&]() { sim.activePassengers = initial; },
+                     [&]() { sim.updatePassengers(dt); doNotOptimize(sim.activePassengers.data()); },
+                     60);
+    }
+
+    // ===== Guzva (platform = podrazumevani peron 2.6 x 0.7, open = 300 x 300) =====
+    // Stanje se ne vraca izmedju uzoraka: meri se guzva koja se vec razmestila
+    {
+        JobSystem jobs;
+        jobs.init(0);
+        struct CrowdCase { const char* area; int count; bool parallel; };
+        const CrowdCase crowdCases[] = {
+            { "platform", 1000, false }, { "platform", 10000, false }, { "platform", 100000, false },
+            { "open", 100000, false }, { "open", 100000, true },
+        };
+        for (const CrowdCase& c : crowdCases) {
+            CrowdParams params;
+            if (std::string(c.area) == "open") {
+                params.areaMin = glm::vec2(-150.0f);
+                params.areaMax = glm::vec2(150.0f);
+            }
+            CrowdSim crowd(params);
+            crowd.seed(1234);
+            crowd.spawn(c.count);
+            if (c.parallel) crowd.setJobSystem(&jobs);
+            std::string name = std::string("crowd/") + c.area + "/" + std::to_string(c.count) + (c.parallel ? "/jobs" : "");
+            runBenchmark(options, results, name, c.count, []() {}, [&]() {
+                crowd.update(dt);
+                doNotOptimize(&crowd);
+            });
+        }
+    }
+
+    // ===== Krive i putanja =====
+    Station stations[NUM_STATIONS];
+    initStationPositions(stations, NUM_STATIONS);
+
+    const int BEZIER_POINTS = 1024;
+    runBenchmark(options, results, "bezierQuadratic", BEZIER_POINTS, []() {}, [&]() {
+        Vec2 p0 = stations[0].position, p2 = stations[1].position;
+        Vec2 p1 = pathControlPoint(p0, p2, 0);
+        float sum = 0.0f;
+        for (int i = 0; i < BEZIER_POINTS; i++) {
+            Vec2 v = bezierQuadratic(p0, p1, p2, i * (1.0f / BEZIER_POINTS));
+            sum += v.x + v.y;
+        }
+        doNotOptimize(sum);
+    });
+
+    std::vector<float> vertices;
+    runBenchmark(options, results, "buildPathVertices/30", NUM_STATIONS * 31, []() {}, [&]() {
+        buildPathVertices(stations, NUM_STATIONS, 30, vertices);
+        doNotOptimize(vertices.data());
+    });
+    runBenchmark(options, results, "buildPathVertices/1000", NUM_STATIONS * 1001, []() {}, [&]() {
+        buildPathVertices(stations, NUM_STATIONS, 1000, vertices);
+        doNotOptimize(vertices.data());
+    });
+
+    // ===== Matrice putnika (kao u petlji za crtanje) =====
+    const int matrixCounts[] = { 50, 1000 };
+    for (int count : matrixCounts) {
+        std::vector<Passenger> passengers = makePassengers(count, 99);
+        for (int i = 0; i < count; i += 3) passengers[i].isMoving = false;  // Deo sedi
+        glm::mat4 shakeModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.003f, 0.0f));
+        runBenchmark(options, results, "passengerModelMatrix/" + std::to_string(count), count, []() {}, [&]() {
+            for (const auto& p : passengers) {
+                glm::mat4 model = passengerModelMatrix(shakeModel, p);
+                doNotOptimize(model);
+            }
+        });
+    }
+
+    // ===== Paleta kostiju (poze svih agenata, kao recordBonePalette) =====
+    // Mesavina hoda, mirovanja i pretapanja; jedna nit pa sve niti kroz JobSystem
+    static const int parents[HUMANOID_BONES] = { -1, BONE_PELVIS, BONE_SPINE, BONE_SPINE, BONE_SPINE, BONE_PELVIS, BONE_PELVIS };
+    Skeleton skeleton;
+    for (int b = 0; b < HUMANOID_BONES; b++) {
+        skeleton.parent[b] = parents[b];
+        skeleton.pivot[b] = glm::vec3(0.0f, 0.1f * b, 0.0f);
+    }
+    JobSystem jobs;
+    jobs.init(0);
+    const int agentCounts[] = { 1000, 10000 };
+    for (int count : agentCounts) {
+        Pcg32 rng(7);
+        std::vector<AnimatedAgent> agents(count);
+        for (AnimatedAgent& agent : agents) {
+            agent.skeleton = &skeleton;
+            agent.state = crowdAnimationState(rng.range(0.0f, 20.0f), rng.range(0.0f, 1.0f));
+        }
+        std::vector<float> palette;
+        runBenchmark(options, results, "evaluatePalettes/" + std::to_string(count), count, []() {}, [&]() {
+            evaluatePalettes(agents, nullptr, palette);
+            doNotOptimize(palette.data());
+        });
+        runBenchmark(options, results, "evaluatePalettes/jobs/" + std::to_string(count), count, []() {}, [&]() {
+            evaluatePalettes(agents, &jobs, palette);
+            doNotOptimize(palette.data());
+        });
+    }
+    jobs.destroy();
+
+    // ===== Generisanje temena (setupPathMesh / setupCircleMesh / setupRoad3D / setupStation3D bez upload-a) =====
+    runBenchmark(options, results, "buildCircleVertices/50", 51, []() {}, [&]() {
+        buildCircleVertices(50, vertices);
+        doNotOptimize(vertices.data());
+    });
+    runBenchmark(options, results, "buildRoadVertices", 16, []() {}, [&]() {
+        buildRoadVertices(500.0f, vertices);
+        doNotOptimize(vertices.data());
+    });
+    runBenchmark(options, results, "buildStationVertices", 36, []() {}, [&]() {
+        buildStationVertices(vertices);
+        doNotOptimize(vertices.data());
+    });
+
+    // ===== Klasterovana svetla (nocna voznja, pogled iz kabine) =====
+    const int lightCounts[] = { 1, 100, 500 };
+    for (int count : lightCounts) {
+        std::vector<PointLight> lights;
+        LightGrid grid;
+        glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, 0.15f), glm::vec3(0.0f, 0.0f, -0.85f), glm::vec3(0.0f, 1.0f, 0.0f));
+        runBenchmark(options, results, "lightGrid/" + std::to_string(count), count, []() {}, [&]() {
+            buildRouteLights(-23.0f, 50.0f, 500.0f, 12.5, count, lights);
+            grid.build(lights, view, glm::radians(60.0f), 16.0f / 9.0f, 0.05f, 1000.0f);
+            doNotOptimize(grid.lightIndices().data());
+        });
+    }
+
+    // ===== Navigaciona mreza (build = A* za sve parove ulaz-mesto, path = citanje iz kesa) =====
+    SeatLayout navLayouts[] = { makeSoloBusLayout(), makeArticulatedBusLayout() };
+    for (const SeatLayout& layout : navLayouts) {
+        NavGrid nav;
+        int pairs = (int)(layout.doors.size() * layout.places.size());
+        runBenchmark(options, results, "navGrid/build/" + layout.name, pairs, []() {}, [&]() {
+            nav.build(layout);
+            doNotOptimize(nav.path(0, 0).data());
+        });
+        runBenchmark(options, results, "navGrid/path/" + layout.name, pairs, []() {}, [&]() {
+            size_t points = 0;
+            for (int d = 0; d < nav.doorCount(); d++) {
+                for (int place = 0; place < (int)layout.places.size(); place++) points += nav.path(d, place).size();
+            }
+            doNotOptimize(points);
+        });
+    }
+
+    // ===== Hijerarhija transformacija (static = nista oznaceno, root = pomeren koren celog stabla) =====
+    const int nodeCounts[] = { 1000, 10000 };
+    for (int count : nodeCounts) {
+        TransformHierarchy transforms;
+        int root = transforms.add(-1);
+        for (int i = 1; i < count; i++) transforms.add(root, glm::translate(glm::mat4(1.0f), glm::vec3((float)i, 0.0f, 0.0f)));
+        transforms.update();
+        runBenchmark(options, results, "transformHierarchy/static/" + std::to_string(count), count, []() {}, [&]() {
+            doNotOptimize(transforms.update());
+        });
+        float shake = 0.0f;
+        runBenchmark(options, results, "transformHierarchy/root/" + std::to_string(count), count, []() {}, [&]() {
+            shake += 0.001f;
+            transforms.setLocal(root, glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, shake, 0.0f)));
+            doNotOptimize(transforms.update());
+        });
+    }
+
+    // ===== Checkpoint (pun autobus i guzva; write = serijalizacija u bafer na niti simulacije) =====
+    {
+        BusSimulation sim;
+        sim.logToConsole = false;
+        sim.seed(1234);
+        sim.activePassengers = makePassengers(MAX_PASSENGERS, 1234);
+        for (int i = 0; i < MAX_PASSENGERS; i++) {
+            Passenger& p = sim.activePassengers[i];
+            p.seatIndex = i;
+            p.finalPosition = sim.seatMap.place(i).position;
+        }
+        sim.passengers = MAX_PASSENGERS;
+        CheckpointDriverState driver;
+        std::vector<uint8_t> buffer;
+        runBenchmark(options, results, "checkpoint/write", MAX_PASSENGERS, []() {}, [&]() {
+            writeCheckpoint(sim, driver, buffer);
+            doNotOptimize(buffer.data());
+        });
+
+        const char* checkpointPath = "benchmark_checkpoint.kchk";
+        CheckpointFile file;
+        if (saveCheckpoint(checkpointPath, sim, driver) && file.open(checkpointPath)) {
+            BusSimulation restored;
+            restored.logToConsole = false;
+            runBenchmark(options, results, "checkpoint/restore", MAX_PASSENGERS, []() {}, [&]() {
+                file.restore(restored, &driver);
+                doNotOptimize(restored.activePassengers.data());
+            });
+            file.close();
+        }
+        std::remove(checkpointPath);
+    }
+
+    // ===== Dekodiranje tekstura =====
+    const char* textures[] = {
+        "2d_bus.png", "bus_station.png", "bus_control.png", "closed_doors.png", "opened_doors.png",
+        "author_text.png", "passangers_label.png", "fines.png", "number_0.png"
+    };
+    for (const char* texture : textures) {
+        std::vector<unsigned char> encoded;
+        if (!readFile(texturesDir + "/" + texture, encoded)) {
+            fprintf(stderr, "Preskacem %s (fajl nije pronadjen u \"%s\")\n", texture, texturesDir.c_str());
+            continue;
+        }
+        int w = 0, h = 0, channels = 0;
+        stbi_info_from_memory(encoded.data(), (int)encoded.size(), &w, &h, &channels);
+        runBenchmark(options, results, std::string("stbi_load/") + texture, (uint64_t)w * h, []() {}, [&]() {
+            int width, height, comp;
+            unsigned char* pixels = stbi_load_from_memory(encoded.data(), (int)encoded.size(), &width, &height, &comp, 0);
+            doNotOptimize(pixels);
+            stbi_image_free(pixels);
+        });
+    }
+
+    if (outPath.empty()) {
+        writeJson(std::cout, results, options);
+    } else {
+        std::ofstream out(outPath);
+        writeJson(out, results, options);
+        fprintf(stderr, "Rezultati upisani u %s\n", outPath.c_str());
+    }
+    return 0;
+}
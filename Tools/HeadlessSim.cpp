@@ -0,0 +1,152 @@
+// ========== HEADLESS SIMULACIJA ==========
+// Pokrece BusSimulation bez prozora i OpenGL-a, fiksnim korakom i najvecom mogucom brzinom.
+// Ulaz (ulazak/izlazak putnika, kontrola) generise se sinteticki iz zadatih verovatnoca.
+//
+// Prevodjenje (iz korena repozitorijuma):
+//   g++ -O2 -std=c++14 -Ipackages/glm.1.0.3/build/native/include Tools/HeadlessSim.cpp
+//       Source/BusSimulation.cpp Source/SeatMap.cpp Source/CrowdSim.cpp Source/Telemetry.cpp
+//       Source/SkeletalAnimation.cpp Source/JobSystem.cpp Source/NavGrid.cpp Source/Checkpoint.cpp
+//       Source/MappedFile.cpp -pthread -o headless_sim
+//
+// Primer:
+//   headless_sim --hours 24 --seed 42 --board 0.6 --alight 0.4 --inspector 0.05
+//   headless_sim --hours 1 --checkpoint run.kchk && headless_sim --hours 1 --restore run.kchk
+//
+// Sa --checkpoint se stanje cuva periodicno (u pozadinskoj niti) i jos jednom na kraju.
+// --restore nastavlja od checkpoint-a, ukljucujuci generator dogadjaja, pa je 1 h + 1 h
+// isto sto i 2 h u jednom pokretanju; --hours je tada trajanje nastavka.
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "../Header/BusSimulation.h"
+#include "../Header/Checkpoint.h"
+
+const float SIM_DT = 1.0f / 75.0f;  // Isti korak kao TARGET_FPS u aplikaciji
+
+int main(int argc, char** argv)
+{
+    double hours = 1.0;
+    uint64_t seed = (uint64_t)time(NULL);
+    float boardRate = 0.5f;         // Ocekivan broj ulazaka u sekundi dok autobus stoji
+    float alightRate = 0.3f;        // Ocekivan broj izlazaka u sekundi dok autobus stoji
+    float inspectorChance = 0.1f;   // Verovatnoca da kontrola udje na stanici
+    bool crowd = false;
+    const char* telemetryPrefix = NULL;
+    const char* checkpointPath = NULL;
+    double checkpointInterval = 60.0;
+    const char* restorePath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--hours" && i + 1 < argc) hours = atof(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc) seed = strtoull(argv[++i], NULL, 10);
+        else if (arg == "--board" && i + 1 < argc) boardRate = (float)atof(argv[++i]);
+        else if (arg == "--alight" && i + 1 < argc) alightRate = (float)atof(argv[++i]);
+        else if (arg == "--inspector" && i + 1 < argc) inspectorChance = (float)atof(argv[++i]);
+        else if (arg == "--crowd") crowd = true;
+        else if (arg == "--telemetry" && i + 1 < argc) telemetryPrefix = argv[++i];
+        else if (arg == "--checkpoint" && i + 1 < argc) checkpointPath = argv[++i];
+        else if (arg == "--checkpoint-every" && i + 1 < argc) checkpointInterval = atof(argv[++i]);
+        else if (arg == "--restore" && i + 1 < argc) restorePath = argv[++i];
+        else {
+            std::cout << "Upotreba: headless_sim [--hours H] [--seed N] [--board R] [--alight R] [--inspector P] [--crowd] [--telemetry PREFIKS]"
+                      << " [--checkpoint FAJL] [--checkpoint-every S] [--restore FAJL]" << std::endl;
+            return 1;
+        }
+    }
+
+    BusSimulation sim;
+    sim.logToConsole = false;
+    sim.crowdEnabled = crowd;
+    sim.seed(seed);
+
+    TelemetryWriter telemetry;
+    if (telemetryPrefix != NULL && telemetry.open(telemetryPrefix)) {
+        sim.telemetry = &telemetry;
+    }
+
+    // Generator dogadjaja je odvojen od generatora simulacije
+    Pcg32 events;
+    events.seed(seed, 0x9e3779b97f4a7c15ULL);
+    int lastStation = -1;
+
+    if (restorePath != NULL) {
+        CheckpointDriverState driver;
+        if (!loadCheckpoint(restorePath, sim, &driver)) return 1;
+        events.state = driver.eventRngState;
+        events.inc = driver.eventRngInc;
+        lastStation = driver.lastStation;
+        std::cout << "Nastavak iz \"" << restorePath << "\": " << sim.simTime << " s simulacije" << std::endl;
+    }
+
+    CheckpointWriter checkpoints;
+    if (checkpointPath != NULL) checkpoints.open(checkpointPath, checkpointInterval);
+    auto driverState = [&]() {
+        CheckpointDriverState driver;
+        driver.eventRngState = events.state;
+        driver.eventRngInc = events.inc;
+        driver.lastStation = lastStation;
+        return driver;
+    };
+
+    const uint64_t steps = (uint64_t)(hours * 3600.0 / SIM_DT + 0.5);
+    uint64_t boardings = 0, alightings = 0, inspections = 0;
+
+    std::cout << "Headless simulacija: " << hours << " h (" << steps << " koraka), seed " << seed << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint64_t i = 0; i < steps; i++) {
+        SimInput input;
+        if (sim.busAtStation) {
+            // Kontrola se odlucuje jednom po dolasku na stanicu
+            if (sim.currentStation != lastStation) {
+                lastStation = sim.currentStation;
+                input.sendInspector = events.nextFloat() < inspectorChance;
+            }
+            input.addPassenger = events.nextFloat() < boardRate * SIM_DT;
+            input.removePassenger = !input.addPassenger && events.nextFloat() < alightRate * SIM_DT;
+        }
+
+        int before = sim.passengers;
+        bool inspectorBefore = sim.isInspectorInBus;
+        sim.step(SIM_DT, input);
+
+        if (input.sendInspector && !inspectorBefore && sim.isInspectorInBus) inspections++;
+        else if (sim.passengers > before) boardings++;
+        else if (sim.passengers < before && sim.isInspectorInBus == inspectorBefore) alightings++;
+
+        if (checkpoints.isOpen()) checkpoints.update(sim, driverState());
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    telemetry.close();
+
+    // Poslednji checkpoint je tacno kraj pokretanja, za nastavak sa --restore
+    if (checkpoints.isOpen()) {
+        checkpoints.close();
+        saveCheckpoint(checkpointPath, sim, driverState());
+    }
+
+    double wallSeconds = std::chrono::duration<double>(end - start).count();
+    double simSeconds = steps * (double)SIM_DT;
+
+    std::cout << "Vreme simulacije:   " << simSeconds << " s" << std::endl;
+    std::cout << "Stvarno vreme:      " << wallSeconds << " s" << std::endl;
+    std::cout << "Brzina:             " << (wallSeconds > 0.0 ? simSeconds / wallSeconds : 0.0) << " sim-s / s" << std::endl;
+    std::cout << "Posecenih stanica:  " << sim.stationsVisited << std::endl;
+    std::cout << "Ulazaka / izlazaka: " << boardings << " / " << alightings << std::endl;
+    std::cout << "Kontrola:           " << inspections << std::endl;
+    std::cout << "Putnika u autobusu: " << sim.passengers << std::endl;
+    std::cout << "Ukupno kazni:       " << sim.totalFines << std::endl;
+    if (sim.telemetry != nullptr) {
+        std::cout << "Telemetrija:        " << telemetry.writtenCount() << " zapisa, odbaceno " << telemetry.droppedCount() << std::endl;
+    }
+    if (checkpointPath != NULL) {
+        std::cout << "Checkpoint:         " << checkpoints.writtenCount() << " usput, preskoceno " << checkpoints.skippedCount()
+                  << ", poslednji u \"" << checkpointPath << "\"" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+// ========== PONOVNO IZVRSAVANJE SNIMKA FREJMA ==========
+// Ucitava snimak frejma (F10 ili --capture-at u aplikaciji): listu komandi crtanja i sve
+// bafere, teksture, mreze i sejdere na koje pokazuje. Lista se izvrsava u petlji u skrivenom
+// prozoru, bez simulacije i bez logike frejma, pa se meri samo crtanje. Svaka iteracija se
+// zavrsava sa glFinish, tako da vreme ukljucuje i rad GPU-a. Sa --out se poslednja
+// iteracija upisuje u PPM (isti format kao F12), npr. za poredjenje sa screenshot_gl.ppm.
+//
+// Prevodjenje (iz korena repozitorijuma):
+//   g++ -O2 -std=c++14 -msse2 -Ipackages/glfw.3.4.0/build/native/include -Ipackages/glm.1.0.3/build/native/include
+//       Tools/RenderReplay.cpp Source/GLRenderBackend.cpp Source/RenderCapture.cpp Source/RenderCommands.cpp
+//       Source/ShaderCache.cpp Source/GLStats.cpp Source/GpuMemory.cpp Source/Util.cpp Source/SoftRasterizer.cpp
+//       Source/JobSystem.cpp Source/Geometry.cpp -lglfw -lGLEW -lGL -pthread -o render_replay
+//
+// Primer (pokretati iz korena repozitorijuma - sejderi se prevode iz Resource Files/Shaders):
+//   render_replay frame_capture.rcap --frames 500
+//   render_replay frame_capture.rcap --frames 1 --out replay.ppm
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Header/GLRenderBackend.h"
+#include "../Header/SoftRasterizer.h"
+
+int main(int argc, char** argv)
+{
+    const char* capturePath = NULL;
+    int frames = 100;
+    int warmup = 5;                 // Iteracije pre merenja (prevodjenje varijanti, drajver)
+    const char* outPath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--frames" && i + 1 < argc) frames = std::max(1, atoi(argv[++i]));
+        else if (arg == "--warmup" && i + 1 < argc) warmup = std::max(0, atoi(argv[++i]));
+        else if (arg == "--out" && i + 1 < argc) outPath = argv[++i];
+        else if (capturePath == NULL && arg.compare(0, 2, "--") != 0) capturePath = argv[i];
+        else {
+            capturePath = NULL;
+            break;
+        }
+    }
+    if (capturePath == NULL) {
+        std::cout << "Upotreba: render_replay SNIMAK.rcap [--frames N] [--warmup N] [--out SLIKA.ppm]" << std::endl;
+        return 1;
+    }
+
+    // ========== SKRIVEN PROZOR ==========
+    if (!glfwInit()) {
+        std::cout << "GLFW nije inicijalizovan!" << std::endl;
+        return 1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(64, 64, "render_replay", NULL, NULL);
+    if (window == NULL) {
+        std::cout << "Prozor nije kreiran!" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    glfwMakeContextCurrent(window);
+    if (glewInit() != GLEW_OK) {
+        std::cout << "GLEW nije inicijalizovan!" << std::endl;
+        return 1;
+    }
+
+    // ========== UCITAVANJE SNIMKA ==========
+    GLRenderBackend backend;
+    RenderCommandList list;
+    backend.init(1, 1);
+    if (!backend.loadCapture(capturePath, list)) {
+        backend.destroy();
+        glfwTerminate();
+        return 1;
+    }
+
+    // Ekran iz snimka postaje framebuffer iste velicine
+    int width = backend.screenWidth(), height = backend.screenHeight();
+    uint32_t offscreen = backend.createTarget(width, height);
+    backend.setScreenTarget(backend.framebuffer(offscreen));
+    std::cout << capturePath << ": " << width << "x" << height << ", " << list.commands().size() << " komandi, "
+              << glGetString(GL_RENDERER) << std::endl;
+
+    // ========== MERENJE ==========
+    std::vector<float> times;
+    for (int i = 0; i < warmup + frames; i++) {
+        glStats.reset();
+        auto start = std::chrono::high_resolution_clock::now();
+        backend.execute(list);
+        glFinish();
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+        if (i >= warmup) times.push_back(elapsed.count());
+    }
+
+    std::sort(times.begin(), times.end());
+    float total = 0.0f;
+    for (float t : times) total += t;
+    size_t p95 = std::min(times.size() - 1, times.size() * 95 / 100);
+    std::cout << frames << " frejmova: najbolje " << times.front() << " ms, prosek " << total / frames
+              << " ms, p95 " << times[p95] << " ms, najgore " << times.back() << " ms" << std::endl;
+    GLCounters counters = glStats.total();
+    std::cout << "Po frejmu: " << counters.drawCalls << " poziva crtanja, " << counters.triangles << " trouglova, "
+              << counters.stateChanges << " promena stanja, " << counters.uniformUploads << " uniformi, "
+              << counters.uploadBytes() / 1024 << " KB uploada" << std::endl;
+    for (int i = 0; i < glStats.passCount; i++) {
+        const GLPassStats& pass = glStats.passes[i];
+        if (pass.name[0] == '\0') continue;
+        std::cout << "  " << pass.name << ": " << pass.counters.drawCalls << " poziva crtanja, "
+                  << pass.counters.uploadBytes() / 1024 << " KB uploada" << std::endl;
+    }
+
+    int result = 0;
+    if (outPath != NULL) {
+        std::vector<uint8_t> pixels((size_t)width * height * 4);
+        glBindFramebuffer(GL_FRAMEBUFFER, backend.framebuffer(offscreen));
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        if (writePPM(outPath, width, height, pixels)) {
+            std::cout << "Slika: " << outPath << std::endl;
+        } else {
+            std::cout << "GRESKA: Slika nije upisana: " << outPath << std::endl;
+            result = 1;
+        }
+    }
+
+    backend.destroy();
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return result;
+}
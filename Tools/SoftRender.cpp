@@ -0,0 +1,154 @@
+// ========== SOFTVERSKO CRTANJE BEZ PROZORA ==========
+// Pokrece BusSimulation kao headless_sim i crta izabrane frejmove kroz SoftwareRenderer
+// (bez GPU-a i OpenGL-a) u PPM slike. Sa --compare poredi frejm sa referentnom slikom,
+// npr. snimkom GL putanje (F12 u aplikaciji pravi screenshot_gl.ppm).
+//
+// Prevodjenje (iz korena repozitorijuma):
+//   g++ -O2 -std=c++14 -msse2 -Ipackages/glm.1.0.3/build/native/include Tools/SoftRender.cpp
+//       Source/SoftRasterizer.cpp Source/SoftwareRenderer.cpp Source/Geometry.cpp Source/SimThread.cpp
+//       Source/InputRecorder.cpp Source/BusSimulation.cpp Source/SeatMap.cpp Source/CrowdSim.cpp
+//       Source/Telemetry.cpp Source/HumanoidGenerator.cpp Source/SkeletalAnimation.cpp Source/JobSystem.cpp
+//       Source/NavGrid.cpp Source/BusScene.cpp Source/TransformHierarchy.cpp Source/Checkpoint.cpp
+//       Source/MappedFile.cpp -pthread -o soft_render
+//
+// Primer:
+//   soft_render --seed 42 --time 20 --frames 3 --interval 5 --out frame
+//   soft_render --seed 42 --width 1920 --height 1080 --compare screenshot_gl.ppm
+//
+// Poredjenje prolazi ako je udeo piksela sa razlikom vecom od --tolerance najvise --max-bad
+// procenata. Dva kvadra kontrolnog panela kabine leze u istoj ravni, pa se na GPU-u bore za
+// dubinu (pruge, oko 3% slike na 1280x720). Zato se pikseli panela (oko 10% slike) ne porede
+// (SoftwareRenderer::panelMask). Van panela je na 1280x720 oko 0.2% piksela preko praga,
+// skoro svi na dalekom delu bele linije, 1 cm iznad asfalta, gde preciznost dubine opet ne
+// razdvaja dve ravni.
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "../Header/stb_image.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+#include "../Header/BusSimulation.h"
+#include "../Header/JobSystem.h"
+#include "../Header/SimThread.h"
+#include "../Header/SoftwareRenderer.h"
+
+const float SIM_DT = 1.0f / 75.0f;  // Isti korak kao TARGET_FPS u aplikaciji
+
+int main(int argc, char** argv)
+{
+    int width = 1280, height = 720;
+    uint64_t seed = (uint64_t)time(NULL);
+    double firstFrame = 10.0;       // Sekunde simulacije pre prvog frejma
+    double interval = 1.0;
+    int frames = 1;
+    int repeat = 1;                 // Koliko puta se crta svaki frejm (za merenje)
+    int threads = 0;
+    bool crowd = false;
+    const char* outPrefix = "soft_frame";
+    const char* comparePath = NULL;
+    int tolerance = 8;
+    double maxBad = 1.0;            // Procenat piksela
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--width" && i + 1 < argc) width = std::max(1, atoi(argv[++i]));
+        else if (arg == "--height" && i + 1 < argc) height = std::max(1, atoi(argv[++i]));
+        else if (arg == "--seed" && i + 1 < argc) seed = strtoull(argv[++i], NULL, 10);
+        else if (arg == "--time" && i + 1 < argc) firstFrame = atof(argv[++i]);
+        else if (arg == "--interval" && i + 1 < argc) interval = atof(argv[++i]);
+        else if (arg == "--frames" && i + 1 < argc) frames = std::max(1, atoi(argv[++i]));
+        else if (arg == "--repeat" && i + 1 < argc) repeat = std::max(1, atoi(argv[++i]));
+        else if (arg == "--threads" && i + 1 < argc) threads = std::max(0, atoi(argv[++i]));
+        else if (arg == "--crowd") crowd = true;
+        else if (arg == "--out" && i + 1 < argc) outPrefix = argv[++i];
+        else if (arg == "--compare" && i + 1 < argc) comparePath = argv[++i];
+        else if (arg == "--tolerance" && i + 1 < argc) tolerance = std::max(0, atoi(argv[++i]));
+        else if (arg == "--max-bad" && i + 1 < argc) maxBad = std::max(0.0, atof(argv[++i]));
+        else {
+            std::cout << "Upotreba: soft_render [--width W] [--height H] [--seed N] [--time S] [--interval S] [--frames N]"
+                      << " [--repeat N] [--threads N] [--crowd] [--out PREFIKS] [--compare REF.ppm] [--tolerance T] [--max-bad P]" << std::endl;
+            return 1;
+        }
+    }
+
+    JobSystem jobs;
+    jobs.init(threads);
+    SoftwareRenderer renderer;
+    if (!renderer.init(width, height, SoftSceneSettings(), &jobs)) {
+        std::cout << "GRESKA: Teksture nisu ucitane (pokrenuti iz korena repozitorijuma)" << std::endl;
+        return 1;
+    }
+    std::cout << "Softversko crtanje " << width << "x" << height << ", " << renderer.threadCount() << " niti, seed " << seed << std::endl;
+
+    BusSimulation sim;
+    sim.logToConsole = false;
+    sim.crowdEnabled = crowd;
+    sim.stationCrowd.setJobSystem(&jobs);
+    sim.seed(seed);
+
+    // Isti sinteticki ulaz kao headless_sim
+    Pcg32 events;
+    events.seed(seed, 0x9e3779b97f4a7c15ULL);
+    int lastStation = -1;
+    auto stepTo = [&](double simTime) {
+        while (sim.simTime < simTime) {
+            SimInput input;
+            if (sim.busAtStation) {
+                if (sim.currentStation != lastStation) {
+                    lastStation = sim.currentStation;
+                    input.sendInspector = events.nextFloat() < 0.1f;
+                }
+                input.addPassenger = events.nextFloat() < 0.5f * SIM_DT;
+                input.removePassenger = !input.addPassenger && events.nextFloat() < 0.3f * SIM_DT;
+            }
+            sim.step(SIM_DT, input);
+        }
+    };
+
+    SimSnapshot snap;
+    std::vector<uint8_t> pixels, mask;
+    int failed = 0;
+    for (int f = 0; f < frames; f++) {
+        stepTo(firstFrame + f * interval);
+        copySimulationState(sim, snap);
+
+        float best = 1e30f, total = 0.0f;
+        for (int r = 0; r < repeat; r++) {
+            renderer.render(snap);
+            best = std::min(best, renderer.lastRenderMs());
+            total += renderer.lastRenderMs();
+        }
+        renderer.frame().readPixels(pixels);
+
+        std::string path = std::string(outPrefix) + "_" + std::to_string(f) + ".ppm";
+        if (!writePPM(path, width, height, pixels)) {
+            std::cout << "GRESKA: Slika nije upisana: " << path << std::endl;
+            return 1;
+        }
+        std::cout << path << ": t = " << snap.simTime << " s, " << snap.activePassengers.size() << " putnika, "
+                  << best << " ms (najbolje), " << total / repeat << " ms (prosek)" << std::endl;
+
+        if (comparePath != NULL) {
+            int refWidth, refHeight;
+            std::vector<uint8_t> reference;
+            if (!readPPM(comparePath, refWidth, refHeight, reference) || refWidth != width || refHeight != height) {
+                std::cout << "GRESKA: Referentna slika nije ucitana ili nije " << width << "x" << height << std::endl;
+                return 1;
+            }
+            renderer.panelMask(mask);
+            ImageDiff diff = compareImages(pixels, reference, width * height, tolerance, &mask);
+            bool pass = diff.badPixels * 100.0 <= maxBad;
+            std::cout << "  poredjenje (bez panela, " << diff.maskedPixels * 100.0 << "% slike): srednja greska "
+                      << diff.meanError << ", najveca " << diff.maxError
+                      << ", " << diff.badPixels * 100.0 << "% piksela preko " << tolerance
+                      << (pass ? " - OK" : " - RAZLIKA") << std::endl;
+            if (!pass) failed++;
+        }
+    }
+    return failed > 0 ? 2 : 0;
+}
@@ -0,0 +1,75 @@
+// ========== PREGLED TELEMETRIJE ==========
+// Cita segmente binarnog dnevnika (mapirane u memoriju) i ispisuje dogadjaje ili zbirni pregled.
+//
+// Prevodjenje (iz korena repozitorijuma):
+//   g++ -O2 -std=c++14 Tools/TelemetryDump.cpp Source/Telemetry.cpp Source/TelemetryReader.cpp Source/MappedFile.cpp -pthread -o telemetry_dump
+//
+// Primer:
+//   telemetry_dump telemetry            zbirni pregled svih segmenata telemetry_NNN.ktl
+//   telemetry_dump telemetry --events   svaki dogadjaj u posebnom redu
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "../Header/TelemetryReader.h"
+
+const int MAX_EVENT_TYPES = 8;
+const int MAX_STATIONS = 16;
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cout << "Upotreba: telemetry_dump PREFIKS [--events]" << std::endl;
+        return 1;
+    }
+    std::string prefix = argv[1];
+    bool printEvents = argc > 2 && std::string(argv[2]) == "--events";
+
+    auto start = std::chrono::high_resolution_clock::now();
+    TelemetryLog log;
+    if (!log.open(prefix)) {
+        std::cout << "Nema segmenata za \"" << prefix << "\"" << std::endl;
+        return 1;
+    }
+
+    if (printEvents) {
+        log.forEach([](const TelemetryEvent& e) {
+            printf("%10u %10.3f %-18s stanica %2u putnika %2u vrednost %d\n",
+                   e.step, e.time, telemetryEventName(e.type), e.station, e.passengers, e.value);
+        });
+        return 0;
+    }
+
+    // Zbirni pregled - jedan prolaz kroz mapirane zapise
+    size_t perType[MAX_EVENT_TYPES] = {};
+    size_t boardingsPerStation[MAX_STATIONS] = {};
+    long long fines = 0;
+    int maxPassengers = 0;
+    double lastTime = 0.0;
+    log.forEach([&](const TelemetryEvent& e) {
+        if (e.type < MAX_EVENT_TYPES) perType[e.type]++;
+        if (e.type == TELEMETRY_BOARD && e.station < MAX_STATIONS) boardingsPerStation[e.station]++;
+        if (e.type == TELEMETRY_INSPECTOR_EXIT) fines += e.value;
+        if (e.passengers > maxPassengers) maxPassengers = e.passengers;
+        lastTime = e.time;
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    size_t total = log.totalEvents();
+    std::cout << "Segmenata: " << log.getSegments().size() << ", dogadjaja: " << total
+              << ", vreme simulacije: " << lastTime << " s" << std::endl;
+    for (int t = 0; t < MAX_EVENT_TYPES; t++) {
+        if (perType[t] > 0) printf("  %-18s %zu\n", telemetryEventName((uint16_t)t), perType[t]);
+    }
+    std::cout << "Ulasci po stanicama:";
+    for (int i = 0; i < MAX_STATIONS; i++) {
+        if (boardingsPerStation[i] > 0) std::cout << " " << i << ":" << boardingsPerStation[i];
+    }
+    std::cout << std::endl;
+    std::cout << "Ukupno kazni: " << fines << ", najvise putnika: " << maxPassengers << std::endl;
+    std::cout << "Citanje: " << ms << " ms (" << (ms > 0.0 ? total / ms / 1000.0 : 0.0) << " M dogadjaja/s)" << std::endl;
+    return 0;
+}